@@ -1,6 +1,7 @@
 #!/bin/sh
 
 [ -d m4 ] || mkdir m4
+libtoolize --copy --force
 aclocal -I m4
 autoheader
 automake -a -c --foreign
@@ -0,0 +1,628 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/time.h>
+#include <sys/wait.h>
+
+#include <err.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <ftw.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "conv-tools.h"
+
+/*
+ * Benchmark harness.  Generates a reproducible text corpus and directory
+ * tree from a seed, times the classification and conversion primitives
+ * in-process and the mixconv and dirconv binaries as child processes,
+ * and prints one JSON object per result.
+ */
+
+static const char *bindir;	/* location of the mixconv and dirconv */
+static const char *enc8 =
+    "iso8859-1";		/* presumed 8-bit encoding */
+static FILE *out;		/* results */
+static unsigned int opt_r = 5;	/* repetitions */
+static int opt_k;		/* keep work directory */
+
+/* text corpus */
+static size_t corpus_size = 16 * 1024 * 1024;
+static unsigned int line_len = 80;
+static unsigned int mix[4] = { 70, 10, 15, 5 };
+static const char *const mix_names[4] = { "ascii", "latin1", "utf8", "wtf8" };
+
+/* directory tree */
+static unsigned int tree_fanout = 8;
+static unsigned int tree_depth = 3;
+static unsigned int tree_files = 16;
+static unsigned int tree_non_utf = 10;
+
+/*
+ * Random number generator (xorshift64*).  Not good for anything but
+ * generating the same test data every time.
+ */
+static uint64_t seed = 1;
+
+static uint32_t
+rnd(void)
+{
+
+	seed ^= seed >> 12;
+	seed ^= seed << 25;
+	seed ^= seed >> 27;
+	return ((seed * 2685821657736338717ULL) >> 32);
+}
+
+/*
+ * Append one Latin-1 character to a buffer in the requested form: as is,
+ * encoded as UTF-8, or encoded as UTF-8 twice.
+ */
+static size_t
+putchar8(char *p, unsigned char c, unsigned int form)
+{
+	char tmp[2];
+
+	if (c < 0x80 || form == 1) {
+		*p = c;
+		return (1);
+	}
+	tmp[0] = 0xc0 | c >> 6;
+	tmp[1] = 0x80 | (c & 0x3f);
+	if (form == 2) {
+		memcpy(p, tmp, 2);
+		return (2);
+	}
+	return (putchar8(p, tmp[0], 2) + putchar8(p + 2, tmp[1], 2));
+}
+
+/*
+ * Generate a line or name of roughly the requested length in the given
+ * form (0 through 3 correspond to the entries in mix_names[]).  Words
+ * are lowercase ASCII with about one accented letter in eight.  The
+ * result is not terminated.
+ */
+static size_t
+gentext(char *p, size_t len, unsigned int form, int spaces)
+{
+	size_t i;
+	uint32_t r;
+
+	for (i = 0; i < len; ) {
+		r = rnd();
+		if (spaces && r % 7 == 0 && i > 0 && p[i - 1] != ' ')
+			p[i++] = ' ';
+		else if (form > 0 && r % 8 == 1)
+			i += putchar8(p + i, 0xc0 + (r >> 8) % 0x40, form);
+		else
+			p[i++] = 'a' + (r >> 8) % 26;
+	}
+	return (i);
+}
+
+static unsigned int
+pickform(void)
+{
+	unsigned int i, r, total;
+
+	total = mix[0] + mix[1] + mix[2] + mix[3];
+	r = rnd() % total;
+	for (i = 0; r >= mix[i]; ++i)
+		r -= mix[i];
+	return (i);
+}
+
+/*
+ * Generate the text corpus and record the start of each line.
+ */
+struct corpus {
+	char *buf;
+	size_t len;
+	size_t *lines;
+	size_t nlines;
+};
+
+static void
+gencorpus(struct corpus *c)
+{
+	size_t len, max;
+
+	/* worst case is a line of WTF-8, four bytes per character */
+	if ((c->buf = malloc(corpus_size + 8 * line_len + 8)) == NULL)
+		err(1, "malloc()");
+	max = corpus_size / (line_len / 2 + 1) + 1;
+	if ((c->lines = malloc((max + 1) * sizeof *c->lines)) == NULL)
+		err(1, "malloc()");
+	c->len = c->nlines = 0;
+	while (c->len < corpus_size && c->nlines < max) {
+		c->lines[c->nlines++] = c->len;
+		len = line_len / 2 + rnd() % (line_len + 1);
+		c->len += gentext(c->buf + c->len, len, pickform(), 1);
+		c->buf[c->len++] = '\n';
+	}
+	c->lines[c->nlines] = c->len;
+}
+
+static void
+writefile(const char *path, const char *buf, size_t len)
+{
+	ssize_t wlen;
+	int fd;
+
+	if ((fd = open(path, O_WRONLY|O_CREAT|O_TRUNC, 0644)) < 0)
+		err(1, "%s", path);
+	while (len > 0) {
+		if ((wlen = write(fd, buf, len)) < 0)
+			err(1, "%s", path);
+		buf += wlen;
+		len -= wlen;
+	}
+	close(fd);
+}
+
+/*
+ * Generate the directory tree.  Each directory contains tree_files files
+ * and, above the bottom level, tree_fanout subdirectories.  The given
+ * percentage of names is Latin-1, the rest is split evenly between ASCII
+ * and UTF-8.  The names are also added to a list for the in-process
+ * benchmarks.
+ */
+struct names {
+	char *buf;
+	size_t len, size;
+	size_t *off;
+	size_t n, max;
+};
+
+static void
+addname(struct names *nl, const char *name, size_t len)
+{
+
+	if (nl->n + 1 >= nl->max) {
+		nl->max = nl->max ? nl->max * 2 : 1024;
+		if ((nl->off = realloc(nl->off,
+		    nl->max * sizeof *nl->off)) == NULL)
+			err(1, "realloc()");
+	}
+	if (nl->len + len > nl->size) {
+		nl->size = nl->size ? nl->size * 2 : 65536;
+		if ((nl->buf = realloc(nl->buf, nl->size)) == NULL)
+			err(1, "realloc()");
+	}
+	memcpy(nl->buf + nl->len, name, len);
+	nl->off[nl->n++] = nl->len;
+	nl->len += len;
+	nl->off[nl->n] = nl->len;
+}
+
+static size_t
+genname(char *name, unsigned int i)
+{
+	unsigned int form;
+	size_t len;
+
+	if (rnd() % 100 < tree_non_utf)
+		form = 1;
+	else
+		form = rnd() % 2 ? 2 : 0;
+	len = snprintf(name, 16, "%u-", i);
+	len += gentext(name + len, 4 + rnd() % 20, form, 0);
+	name[len] = '\0';
+	return (len);
+}
+
+static size_t
+gentree(char *path, size_t plen, unsigned int depth, struct names *nl)
+{
+	char name[128];
+	size_t len, n;
+	unsigned int i;
+	int fd;
+
+	if (mkdir(path, 0755) != 0)
+		err(1, "%s", path);
+	path[plen++] = '/';
+	for (i = 0, n = 1; i < tree_files; ++i) {
+		len = genname(name, i);
+		addname(nl, name, len);
+		memcpy(path + plen, name, len + 1);
+		if ((fd = open(path, O_WRONLY|O_CREAT|O_EXCL, 0644)) < 0)
+			err(1, "%s", path);
+		close(fd);
+		++n;
+	}
+	for (i = 0; depth < tree_depth && i < tree_fanout; ++i) {
+		len = genname(name, tree_files + i);
+		addname(nl, name, len);
+		memcpy(path + plen, name, len + 1);
+		n += gentree(path, plen + len, depth + 1, nl);
+	}
+	path[--plen] = '\0';
+	return (n);
+}
+
+static int
+rmentry(const char *path, const struct stat *st, int type, struct FTW *ftw)
+{
+
+	(void)st;
+	(void)ftw;
+	if ((type == FTW_DP ? rmdir(path) : unlink(path)) != 0)
+		warn("%s", path);
+	return (0);
+}
+
+/*
+ * Timing and reporting.
+ */
+static double
+now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (ts.tv_sec + ts.tv_nsec / 1e9);
+}
+
+static long
+maxrss_self(void)
+{
+	struct rusage ru;
+
+	getrusage(RUSAGE_SELF, &ru);
+	return (ru.ru_maxrss);
+}
+
+static int
+dblcmp(const void *a, const void *b)
+{
+	double x = *(const double *)a, y = *(const double *)b;
+
+	return (x < y ? -1 : x > y);
+}
+
+/*
+ * Report the best and median of a set of timings.  Rates are computed
+ * from the best time; counts which don't apply to a benchmark are zero
+ * and omitted.
+ */
+static void
+report(const char *bench, const char *variant, double *t, size_t bytes,
+    size_t lines, size_t entries, long maxrss)
+{
+	double best;
+
+	qsort(t, opt_r, sizeof *t, dblcmp);
+	best = t[0] > 0 ? t[0] : 1e-9;
+	fprintf(out, "{\"bench\":\"%s\",\"variant\":\"%s\","
+	    "\"reps\":%u,\"best_s\":%.6f,\"median_s\":%.6f",
+	    bench, variant, opt_r, t[0], t[opt_r / 2]);
+	if (bytes > 0)
+		fprintf(out, ",\"bytes\":%zu,\"mb_s\":%.2f",
+		    bytes, bytes / best / 1e6);
+	if (lines > 0)
+		fprintf(out, ",\"lines\":%zu,\"lines_s\":%.0f",
+		    lines, lines / best);
+	if (entries > 0)
+		fprintf(out, ",\"entries\":%zu,\"entries_s\":%.0f",
+		    entries, entries / best);
+	fprintf(out, ",\"maxrss_kb\":%ld}\n", maxrss);
+	fflush(out);
+}
+
+/*
+ * In-process benchmarks.  The list of names is short compared to the
+ * text corpus, so it is run through several times per repetition.
+ */
+#define NAME_PASSES 64
+
+static volatile unsigned int sink;
+
+static void
+bench_classify(const char *bench, const char *buf, const size_t *off,
+    size_t n, unsigned int passes, int lines)
+{
+	const char *const *impls;
+	double t[opt_r];
+	unsigned int i, p, r;
+	size_t j;
+
+	for (impls = cv_impl_list(); *impls != NULL; ++impls) {
+		if (cv_impl_select(*impls) != 0)
+			continue;
+		for (r = 0; r < opt_r; ++r) {
+			t[r] = now();
+			for (p = 0, i = 0; p < passes; ++p)
+				for (j = 0; j < n; ++j)
+					i += cv_classify(buf + off[j],
+					    off[j + 1] - off[j]);
+			t[r] = now() - t[r];
+			sink += i;
+		}
+		report(bench, *impls, t, passes * (off[n] - off[0]),
+		    lines ? passes * n : 0, lines ? 0 : passes * n,
+		    maxrss_self());
+	}
+	cv_impl_select(NULL);
+}
+
+static void
+bench_convstr(const struct names *nl)
+{
+	char utfname[3 * NAME_MAX + 1];
+	struct names n8;
+	double t[opt_r];
+	unsigned int p, r;
+	size_t j, len;
+	cv_ctx *ctx;
+
+	/* pick out the 8-bit names, NUL-terminated like readdir() does */
+	memset(&n8, 0, sizeof n8);
+	for (j = 0; j < nl->n; ++j) {
+		len = nl->off[j + 1] - nl->off[j];
+		if (cv_classify(nl->buf + nl->off[j], len) == CV_NC_8BIT)
+			addname(&n8, nl->buf + nl->off[j], len + 1);
+	}
+	if (n8.n == 0)
+		goto done;
+	if ((ctx = cv_open(enc8, 0)) == NULL)
+		err(1, "%s", enc8);
+	for (r = 0; r < opt_r; ++r) {
+		t[r] = now();
+		for (p = 0; p < NAME_PASSES; ++p) {
+			for (j = 0; j < n8.n; ++j) {
+				len = n8.off[j + 1] - n8.off[j] - 1;
+				if (cv_convstr(ctx, CV_FWD, n8.buf + n8.off[j],
+				    len, utfname, sizeof utfname) == (size_t)-1)
+					err(1, "cv_convstr()");
+			}
+		}
+		t[r] = now() - t[r];
+	}
+	report("convstr", cv_charset(ctx), t,
+	    NAME_PASSES * (n8.len - n8.n), 0, NAME_PASSES * n8.n,
+	    maxrss_self());
+	cv_close(ctx);
+done:
+	free(n8.buf);
+	free(n8.off);
+}
+
+/*
+ * Child process benchmarks.  Output goes to /dev/null; the peak RSS is
+ * the highest reported for any of the runs.
+ */
+static void
+bench_exec(const char *bench, const char *variant, char *const argv[],
+    size_t bytes, size_t lines, size_t entries)
+{
+	struct rusage ru;
+	double t[opt_r];
+	unsigned int r;
+	long maxrss;
+	pid_t pid;
+	int fd, status;
+
+	if (access(argv[0], X_OK) != 0) {
+		warn("%s", argv[0]);
+		return;
+	}
+	for (r = 0, maxrss = 0; r < opt_r; ++r) {
+		t[r] = now();
+		if ((pid = fork()) < 0)
+			err(1, "fork()");
+		if (pid == 0) {
+			if ((fd = open("/dev/null", O_RDWR)) < 0)
+				err(1, "/dev/null");
+			dup2(fd, STDOUT_FILENO);
+			execv(argv[0], argv);
+			err(1, "%s", argv[0]);
+		}
+		if (wait4(pid, &status, 0, &ru) < 0)
+			err(1, "wait4()");
+		t[r] = now() - t[r];
+		if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+			errx(1, "%s failed", argv[0]);
+		if (ru.ru_maxrss > maxrss)
+			maxrss = ru.ru_maxrss;
+	}
+	report(bench, variant, t, bytes, lines, entries, maxrss);
+}
+
+static void
+usage(void)
+{
+
+	fprintf(stderr, "usage: convbench [-k] [-b bindir] [-D depth] "
+	    "[-E files] [-F fanout]\n"
+	    "                 [-f charset] [-L length] [-m ratios] "
+	    "[-N percent] [-o output]\n"
+	    "                 [-r reps] [-S megabytes] [-s seed] "
+	    "[-w workdir]\n");
+	exit(1);
+}
+
+static unsigned int
+number(const char *str, unsigned int min, unsigned int max)
+{
+	unsigned long n;
+	char *end;
+
+	errno = 0;
+	n = strtoul(str, &end, 10);
+	if (*str == '\0' || *end != '\0' || errno != 0 || n < min || n > max)
+		usage();
+	return (n);
+}
+
+int
+main(int argc, char *argv[])
+{
+	char path[PATH_MAX], corpusfile[PATH_MAX], treedir[PATH_MAX];
+	char tmpl[] = "/tmp/convbench.XXXXXXXX";
+	char mixconv[PATH_MAX], dirconv[PATH_MAX];
+	char variant[32], *p, *workdir;
+	struct corpus c;
+	struct names nl;
+	size_t ntree;
+	long nthr;
+	int opt;
+
+	out = stdout;
+	workdir = NULL;
+	while ((opt = getopt(argc, argv, "b:D:E:F:f:kL:m:N:o:r:S:s:w:")) != -1)
+		switch (opt) {
+		case 'b':
+			bindir = optarg;
+			break;
+		case 'D':
+			tree_depth = number(optarg, 0, 8);
+			break;
+		case 'E':
+			tree_files = number(optarg, 0, 100000);
+			break;
+		case 'F':
+			tree_fanout = number(optarg, 0, 1000);
+			break;
+		case 'f':
+			enc8 = optarg;
+			break;
+		case 'k':
+			++opt_k;
+			break;
+		case 'L':
+			line_len = number(optarg, 1, 1024 * 1024);
+			break;
+		case 'm':
+			if (sscanf(optarg, "%u,%u,%u,%u", &mix[0], &mix[1],
+			    &mix[2], &mix[3]) != 4 ||
+			    mix[0] + mix[1] + mix[2] + mix[3] == 0)
+				usage();
+			break;
+		case 'N':
+			tree_non_utf = number(optarg, 0, 100);
+			break;
+		case 'o':
+			if ((out = fopen(optarg, "w")) == NULL)
+				err(1, "%s", optarg);
+			break;
+		case 'r':
+			opt_r = number(optarg, 1, 1000);
+			break;
+		case 'S':
+			corpus_size = (size_t)number(optarg, 1, 4096) << 20;
+			break;
+		case 's':
+			seed = number(optarg, 1, UINT_MAX);
+			break;
+		case 'w':
+			workdir = optarg;
+			break;
+		default:
+			usage();
+		}
+	if (optind != argc)
+		usage();
+	if (workdir == NULL && (workdir = mkdtemp(tmpl)) == NULL)
+		err(1, "mkdtemp()");
+	snprintf(corpusfile, sizeof corpusfile, "%s/corpus.txt", workdir);
+	snprintf(treedir, sizeof treedir, "%s/tree", workdir);
+
+	fprintf(out, "{\"bench\":\"config\",\"package\":\"%s\","
+	    "\"seed\":%llu,\"charset\":\"%s\",\"corpus_size\":%zu,"
+	    "\"line_len\":%u,\"mix\":{", PACKAGE_STRING,
+	    (unsigned long long)seed, enc8, corpus_size, line_len);
+	for (opt = 0; opt < 4; ++opt)
+		fprintf(out, "%s\"%s\":%u", opt ? "," : "",
+		    mix_names[opt], mix[opt]);
+	fprintf(out, "},\"tree_fanout\":%u,\"tree_depth\":%u,"
+	    "\"tree_files\":%u,\"tree_non_utf\":%u,\"impl\":\"%s\"}\n",
+	    tree_fanout, tree_depth, tree_files, tree_non_utf,
+	    cv_impl_name());
+
+	/* generate test data */
+	gencorpus(&c);
+	writefile(corpusfile, c.buf, c.len);
+	memset(&nl, 0, sizeof nl);
+	/* names are less than 128 bytes long, see genname() */
+	if (strlen(treedir) + (tree_depth + 1) * 128 >= sizeof path)
+		errx(1, "%s: path too long", treedir);
+	memcpy(path, treedir, strlen(treedir) + 1);
+	ntree = gentree(path, strlen(path), 0, &nl);
+
+	/* in-process */
+	bench_classify("classify", nl.buf, nl.off, nl.n, NAME_PASSES, 0);
+	bench_classify("classify-lines", c.buf, c.lines, c.nlines, 1, 1);
+	bench_convstr(&nl);
+
+	/* child processes */
+	if (bindir != NULL) {
+		snprintf(mixconv, sizeof mixconv, "%s/mixconv/mixconv", bindir);
+		snprintf(dirconv, sizeof dirconv, "%s/dirconv/dirconv", bindir);
+		bench_exec("mixconv", "j1", (char *[]){ mixconv, "-f",
+		    (char *)enc8, corpusfile, NULL }, c.len, c.nlines, 0);
+		if ((nthr = sysconf(_SC_NPROCESSORS_ONLN)) > 1) {
+			snprintf(variant, sizeof variant, "j%ld", nthr);
+			p = variant + 1;
+			bench_exec("mixconv", variant, (char *[]){ mixconv,
+			    "-f", (char *)enc8, "-j", p, corpusfile, NULL },
+			    c.len, c.nlines, 0);
+		}
+		bench_exec("dirconv", "rn", (char *[]){ dirconv, "-rn",
+		    "-f", (char *)enc8, treedir, NULL }, 0, 0, ntree);
+	}
+
+	if (!opt_k) {
+		nftw(treedir, rmentry, 64, FTW_DEPTH | FTW_PHYS);
+		unlink(corpusfile);
+		if (workdir == tmpl)
+			rmdir(workdir);
+	} else {
+		fprintf(stderr, "test data left in %s\n", workdir);
+	}
+	free(c.buf);
+	free(c.lines);
+	free(nl.buf);
+	free(nl.off);
+	if (out != stdout)
+		fclose(out);
+	exit(0);
+}
@@ -0,0 +1,379 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <err.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "dccache.h"
+
+/*
+ * The cache file consists of a header, the key (padded to a multiple of
+ * eight bytes), an array of records sorted by device and inode, and the
+ * names of the subdirectories of each directory, NUL-terminated.  It is
+ * written in native byte order, since it is not meant to be shared
+ * between machines; a file we don't recognize is simply ignored.
+ */
+#define DCC_MAGIC	"dircache"
+#define DCC_VERSION	1
+
+struct dcchdr {
+	char magic[8];
+	uint32_t version;
+	uint32_t keylen;
+	uint64_t nrecs;
+	uint64_t strsize;
+};
+
+struct dccrec {
+	uint64_t dev;
+	uint64_t ino;
+	int64_t mtime;
+	int64_t ctime;
+	uint32_t mtime_ns;
+	uint32_t ctime_ns;
+	uint64_t kids;		/* offset of subdirectory names */
+	uint32_t kidslen;	/* length of subdirectory names */
+	uint32_t spare;
+};
+
+#define DCC_PAD(n)	(((n) + 7) & ~(size_t)7)
+
+struct dclog {
+	struct dccrec *recs;
+	size_t nrecs, recsize;
+	char *strs;
+	size_t strlen, strsize;
+};
+
+static void *map;
+static size_t mapsize;
+static const struct dccrec *recs;
+static size_t nrecs;
+static const char *strs;
+static size_t strsize;
+static const char *cache_key;
+static time_t start;
+
+/*
+ * Load the cache file, if there is one and it was written with the same
+ * key.  Returns the number of directories in the cache.
+ */
+size_t
+dccache_open(const char *path, const char *key)
+{
+	const struct dcchdr *hdr;
+	struct stat st;
+	size_t keylen, off;
+	int fd;
+
+	cache_key = key;
+	start = time(NULL);
+	if ((fd = open(path, O_RDONLY)) < 0) {
+		if (errno != ENOENT)
+			warn("%s", path);
+		return (0);
+	}
+	if (fstat(fd, &st) != 0 || st.st_size < (off_t)sizeof *hdr) {
+		close(fd);
+		return (0);
+	}
+	mapsize = st.st_size;
+	map = mmap(NULL, mapsize, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (map == MAP_FAILED) {
+		warn("%s", path);
+		map = NULL;
+		return (0);
+	}
+	hdr = map;
+	keylen = strlen(key);
+	off = sizeof *hdr + DCC_PAD(keylen);
+	if (memcmp(hdr->magic, DCC_MAGIC, sizeof hdr->magic) != 0 ||
+	    hdr->version != DCC_VERSION || hdr->keylen != keylen ||
+	    mapsize < off ||
+	    memcmp((const char *)map + sizeof *hdr, key, keylen) != 0 ||
+	    hdr->nrecs > (mapsize - off) / sizeof *recs ||
+	    hdr->strsize != mapsize - off - hdr->nrecs * sizeof *recs ||
+	    (hdr->strsize > 0 &&
+	    ((const char *)map)[mapsize - 1] != '\0')) {
+		/* stale or damaged, start over */
+		dccache_close();
+		return (0);
+	}
+	recs = (const struct dccrec *)((const char *)map + off);
+	nrecs = hdr->nrecs;
+	strs = (const char *)(recs + nrecs);
+	strsize = hdr->strsize;
+	return (nrecs);
+}
+
+static int
+dccrec_cmp(uint64_t dev, uint64_t ino, const struct dccrec *r)
+{
+
+	if (dev != r->dev)
+		return (dev < r->dev ? -1 : 1);
+	if (ino != r->ino)
+		return (ino < r->ino ? -1 : 1);
+	return (0);
+}
+
+/*
+ * Look up a directory.  If it is in the cache and has not changed since,
+ * return its subdirectories as a sequence of NUL-terminated names.
+ */
+const char *
+dccache_lookup(const struct stat *st, size_t *len)
+{
+	const struct dccrec *r;
+	size_t lo, hi, mid;
+	int cmp;
+
+	lo = 0;
+	hi = nrecs;
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		r = &recs[mid];
+		cmp = dccrec_cmp(st->st_dev, st->st_ino, r);
+		if (cmp < 0) {
+			hi = mid;
+		} else if (cmp > 0) {
+			lo = mid + 1;
+		} else {
+			if (r->mtime != st->st_mtim.tv_sec ||
+			    r->mtime_ns != (uint32_t)st->st_mtim.tv_nsec ||
+			    r->ctime != st->st_ctim.tv_sec ||
+			    r->ctime_ns != (uint32_t)st->st_ctim.tv_nsec ||
+			    r->kids > strsize ||
+			    r->kidslen > strsize - r->kids ||
+			    (r->kidslen > 0 &&
+			    strs[r->kids + r->kidslen - 1] != '\0'))
+				return (NULL);
+			*len = r->kidslen;
+			return (strs + r->kids);
+		}
+	}
+	return (NULL);
+}
+
+void
+dccache_close(void)
+{
+
+	if (map != NULL)
+		munmap(map, mapsize);
+	map = NULL;
+	recs = NULL;
+	nrecs = strsize = 0;
+	strs = NULL;
+}
+
+struct dclog *
+dclog_new(void)
+{
+	struct dclog *log;
+
+	if ((log = calloc(1, sizeof *log)) == NULL)
+		err(1, "calloc()");
+	return (log);
+}
+
+/*
+ * Record a directory which contained nothing of interest.  Directories
+ * which changed after the start of the run (or within the same second,
+ * since not all file systems have finer timestamps) are not recorded;
+ * neither are their subdirectories, so the caller should only call
+ * dclog_kid() if this returns non-zero.
+ */
+int
+dclog_add(struct dclog *log, const struct stat *st)
+{
+	struct dccrec *r;
+
+	if (st->st_mtime >= start || st->st_ctime >= start)
+		return (0);
+	if (log->nrecs == log->recsize) {
+		log->recsize = log->recsize ? log->recsize * 2 : 256;
+		if ((r = realloc(log->recs,
+		    log->recsize * sizeof *r)) == NULL)
+			err(1, "realloc()");
+		log->recs = r;
+	}
+	r = &log->recs[log->nrecs++];
+	memset(r, 0, sizeof *r);
+	r->dev = st->st_dev;
+	r->ino = st->st_ino;
+	r->mtime = st->st_mtim.tv_sec;
+	r->mtime_ns = st->st_mtim.tv_nsec;
+	r->ctime = st->st_ctim.tv_sec;
+	r->ctime_ns = st->st_ctim.tv_nsec;
+	r->kids = log->strlen;
+	return (1);
+}
+
+/*
+ * Add a subdirectory to the last directory recorded.
+ */
+void
+dclog_kid(struct dclog *log, const char *name, size_t len)
+{
+	char *tmp;
+
+	if (log->strlen + len + 1 > log->strsize) {
+		while (log->strlen + len + 1 > log->strsize)
+			log->strsize = log->strsize ? log->strsize * 2 : 4096;
+		if ((tmp = realloc(log->strs, log->strsize)) == NULL)
+			err(1, "realloc()");
+		log->strs = tmp;
+	}
+	memcpy(log->strs + log->strlen, name, len);
+	log->strs[log->strlen + len] = '\0';
+	log->strlen += len + 1;
+	log->recs[log->nrecs - 1].kidslen += len + 1;
+}
+
+void
+dclog_free(struct dclog *log)
+{
+
+	free(log->recs);
+	free(log->strs);
+	free(log);
+}
+
+/*
+ * Sort the records from all the logs by device and inode.
+ */
+struct dclogrec {
+	const struct dccrec *rec;
+	const char *kids;
+};
+
+static int
+dclogrec_cmp(const void *a, const void *b)
+{
+	const struct dclogrec *x = a, *y = b;
+
+	return (dccrec_cmp(x->rec->dev, x->rec->ino, y->rec));
+}
+
+/*
+ * Write the directories recorded in the logs to a new cache file, and
+ * replace the old one with it.
+ */
+int
+dccache_save(const char *path, struct dclog **logs, unsigned int nlogs)
+{
+	static const char zero[8];
+	struct dcchdr hdr;
+	struct dccrec rec;
+	struct dclogrec *all;
+	char *tmppath;
+	size_t i, j, n, len;
+	uint64_t off;
+	FILE *f;
+	int fd, ret;
+
+	for (i = n = 0; i < nlogs; ++i)
+		n += logs[i]->nrecs;
+	if ((all = calloc(n ? n : 1, sizeof *all)) == NULL)
+		err(1, "calloc()");
+	for (i = n = 0; i < nlogs; ++i) {
+		for (j = 0; j < logs[i]->nrecs; ++j, ++n) {
+			all[n].rec = &logs[i]->recs[j];
+			all[n].kids = logs[i]->strs + logs[i]->recs[j].kids;
+		}
+	}
+	qsort(all, n, sizeof *all, dclogrec_cmp);
+
+	/* the same directory may have been reached by more than one path */
+	for (i = j = 0; i < n; ++i)
+		if (j == 0 || dclogrec_cmp(&all[j - 1], &all[i]) != 0)
+			all[j++] = all[i];
+	n = j;
+
+	len = strlen(path) + sizeof ".XXXXXX";
+	if ((tmppath = malloc(len)) == NULL)
+		err(1, "malloc()");
+	snprintf(tmppath, len, "%s.XXXXXX", path);
+	if ((fd = mkstemp(tmppath)) < 0 || (f = fdopen(fd, "w")) == NULL) {
+		warn("%s", tmppath);
+		if (fd >= 0) {
+			close(fd);
+			unlink(tmppath);
+		}
+		free(tmppath);
+		free(all);
+		return (-1);
+	}
+	memset(&hdr, 0, sizeof hdr);
+	memcpy(hdr.magic, DCC_MAGIC, sizeof hdr.magic);
+	hdr.version = DCC_VERSION;
+	hdr.keylen = strlen(cache_key);
+	hdr.nrecs = n;
+	for (i = 0; i < n; ++i)
+		hdr.strsize += all[i].rec->kidslen;
+	fwrite(&hdr, sizeof hdr, 1, f);
+	fwrite(cache_key, 1, hdr.keylen, f);
+	fwrite(zero, 1, DCC_PAD(hdr.keylen) - hdr.keylen, f);
+	for (i = off = 0; i < n; ++i) {
+		rec = *all[i].rec;
+		rec.kids = off;
+		off += rec.kidslen;
+		fwrite(&rec, sizeof rec, 1, f);
+	}
+	for (i = 0; i < n; ++i)
+		fwrite(all[i].kids, 1, all[i].rec->kidslen, f);
+	free(all);
+	ret = ferror(f);
+	if (fclose(f) != 0 || ret != 0 || rename(tmppath, path) != 0) {
+		warn("%s", path);
+		unlink(tmppath);
+		free(tmppath);
+		return (-1);
+	}
+	free(tmppath);
+	return (0);
+}
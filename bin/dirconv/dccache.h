@@ -0,0 +1,55 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef DCCACHE_H_INCLUDED
+#define DCCACHE_H_INCLUDED
+
+/*
+ * Persistent scan cache.  For every directory which contained nothing of
+ * interest during the previous run, the cache file records its device,
+ * inode, modification and change times, and the names of its
+ * subdirectories.  If those times have not changed, the directory does
+ * not need to be read again, although its subdirectories still need to
+ * be visited.
+ *
+ * The cache is loaded once, looked up by all threads, and replaced at
+ * the end of the run by the directories recorded in each thread's log.
+ */
+struct dclog;
+
+size_t dccache_open(const char *, const char *);
+const char *dccache_lookup(const struct stat *, size_t *);
+int dccache_save(const char *, struct dclog **, unsigned int);
+void dccache_close(void);
+struct dclog *dclog_new(void);
+int dclog_add(struct dclog *, const struct stat *);
+void dclog_kid(struct dclog *, const char *, size_t);
+void dclog_free(struct dclog *);
+
+#endif
@@ -0,0 +1,354 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <err.h>
+#include <fnmatch.h>
+#include <limits.h>
+#include <regex.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dcexcl.h"
+
+/*
+ * Literals, including globs without any special characters, are kept
+ * in a hash table for names and one for paths, and are looked up before
+ * anything else, so that in the common case, the cost of the filter is
+ * proportional to the length of the name, no matter how many patterns
+ * there are.  The regular expressions are combined into one alternation
+ * for names and one for paths.  Only globs are tried one by one.
+ */
+#define FNV_OFFSET	0xcbf29ce484222325ULL
+#define FNV_PRIME	0x100000001b3ULL
+
+struct dcxlit {
+	uint64_t hash;
+	const char *str;
+	size_t len;
+};
+
+struct dcxset {
+	struct dcxlit *tab;
+	size_t mask;
+};
+
+struct dcxlist {
+	const char **v;
+	size_t n, size;
+};
+
+static struct dcxlist all;		/* every pattern, as given */
+static struct dcxlist owned;		/* our copies of the patterns */
+static struct dcxlist lits[2];		/* literals: names, paths */
+static struct dcxlist globs[2];		/* globs: names, paths */
+static struct dcxlist res[2];		/* regexes: names, paths */
+static struct dcxset sets[2];
+static regex_t re[2];
+static int have_re[2];
+static char *key;
+
+static uint64_t
+fnv(uint64_t h, const char *str, size_t len)
+{
+
+	while (len-- > 0)
+		h = (h ^ (unsigned char)*str++) * FNV_PRIME;
+	return (h);
+}
+
+static void
+dcxlist_add(struct dcxlist *l, const char *str)
+{
+	const char **tmp;
+
+	if (l->n == l->size) {
+		l->size = l->size ? l->size * 2 : 8;
+		if ((tmp = realloc(l->v, l->size * sizeof *tmp)) == NULL)
+			err(1, "realloc()");
+		l->v = tmp;
+	}
+	l->v[l->n++] = str;
+}
+
+/*
+ * Build an open-addressing hash table of literals.
+ */
+static void
+dcxset_init(struct dcxset *set, const struct dcxlist *l)
+{
+	struct dcxlit *e;
+	uint64_t h;
+	size_t i, len, size;
+
+	for (size = 16; size < l->n * 2; size *= 2)
+		/* nothing */;
+	if ((set->tab = calloc(size, sizeof *set->tab)) == NULL)
+		err(1, "calloc()");
+	set->mask = size - 1;
+	for (i = 0; i < l->n; ++i) {
+		len = strlen(l->v[i]);
+		h = fnv(FNV_OFFSET, l->v[i], len);
+		for (e = &set->tab[h & set->mask]; e->str != NULL;
+		     e = &set->tab[(e - set->tab + 1) & set->mask])
+			/* nothing */;
+		e->hash = h;
+		e->str = l->v[i];
+		e->len = len;
+	}
+}
+
+static int
+dcxset_find(const struct dcxset *set, uint64_t h, const char *str,
+    size_t len)
+{
+	const struct dcxlit *e;
+
+	for (e = &set->tab[h & set->mask]; e->str != NULL;
+	     e = &set->tab[(e - set->tab + 1) & set->mask])
+		if (e->hash == h && e->len == len &&
+		    memcmp(e->str, str, len) == 0)
+			return (1);
+	return (0);
+}
+
+/*
+ * Add a pattern.  The prefix determines its type: "path:" for a literal
+ * name or path, "glob:" for a shell glob, and "re:" or none for a
+ * regular expression.  Leading and trailing slashes are stripped from
+ * literals and globs, which are always anchored anyway.
+ */
+void
+dcexcl_add(const char *pattern)
+{
+	regex_t tmp;
+	char msg[256], *pat, *p;
+	int glob, ispath, lit, ret;
+
+	dcxlist_add(&all, pattern);
+	glob = lit = 0;
+	if (strncmp(pattern, "path:", 5) == 0) {
+		lit = 1;
+		pattern += 5;
+	} else if (strncmp(pattern, "glob:", 5) == 0) {
+		glob = 1;
+		pattern += 5;
+	} else if (strncmp(pattern, "re:", 3) == 0) {
+		pattern += 3;
+	}
+	if ((pat = strdup(pattern)) == NULL)
+		err(1, "strdup()");
+	dcxlist_add(&owned, pat);
+	if (glob && strpbrk(pat, "*?[\\") == NULL) {
+		glob = 0;
+		lit = 1;
+	}
+	if (lit || glob)
+		for (p = pat + strlen(pat); p > pat && p[-1] == '/'; )
+			*--p = '\0';
+	ispath = strchr(pat, '/') != NULL;
+	if (lit || glob)
+		for (p = pat; *p == '/'; ++p)
+			/* nothing */;
+	else
+		p = pat;
+	if (*p == '\0')
+		errx(1, "empty exclusion pattern");
+	if (lit) {
+		dcxlist_add(&lits[ispath], p);
+	} else if (glob) {
+		dcxlist_add(&globs[ispath], p);
+	} else {
+		if ((ret = regcomp(&tmp, p, REG_EXTENDED|REG_NOSUB)) != 0) {
+			regerror(ret, &tmp, msg, sizeof msg);
+			errx(1, "invalid exclusion filter regex %s: %s",
+			    p, msg);
+		}
+		regfree(&tmp);
+		dcxlist_add(&res[ispath], p);
+	}
+}
+
+/*
+ * Prepare the filter once all patterns have been added.
+ */
+void
+dcexcl_init(void)
+{
+	char *alt;
+	size_t i, len;
+	unsigned int k;
+
+	for (k = 0; k < 2; ++k) {
+		if (lits[k].n > 0)
+			dcxset_init(&sets[k], &lits[k]);
+		if (res[k].n == 0)
+			continue;
+		for (i = len = 0; i < res[k].n; ++i)
+			len += strlen(res[k].v[i]) + 3;
+		if ((alt = malloc(len)) == NULL)
+			err(1, "malloc()");
+		if (res[k].n == 1)
+			strcpy(alt, res[k].v[0]);
+		else
+			for (i = len = 0; i < res[k].n; ++i)
+				len += sprintf(alt + len, "%s(%s)",
+				    i > 0 ? "|" : "", res[k].v[i]);
+		if (regcomp(&re[k], alt, REG_EXTENDED|REG_NOSUB) != 0)
+			errx(1, "invalid exclusion filter regex %s", alt);
+		have_re[k] = 1;
+		free(alt);
+	}
+}
+
+/*
+ * Return all patterns, as given, for use in the cache key, or NULL if
+ * there are none.
+ */
+const char *
+dcexcl_key(void)
+{
+	size_t i, len;
+
+	if (all.n == 0)
+		return (NULL);
+	if (key == NULL) {
+		for (i = len = 0; i < all.n; ++i)
+			len += strlen(all.v[i]) + 1;
+		if ((key = malloc(len)) == NULL)
+			err(1, "malloc()");
+		for (i = len = 0; i < all.n; ++i)
+			len += sprintf(key + len, "%s%s",
+			    i > 0 ? "\n" : "", all.v[i]);
+	}
+	return (key);
+}
+
+/*
+ * Return non-zero if any pattern needs the path of the entry.
+ */
+int
+dcexcl_paths(void)
+{
+
+	return (lits[1].n > 0 || globs[1].n > 0 || have_re[1]);
+}
+
+/*
+ * Set up the relative path of the directory about to be read, or the
+ * empty string for a root.
+ */
+void
+dcexcl_dir(struct dcxdir *xd, const char *path, size_t len)
+{
+	char *tmp;
+	size_t size;
+
+	if (xd->bufsize < len + NAME_MAX + 2) {
+		size = len + NAME_MAX + 2;
+		if ((tmp = realloc(xd->buf, size)) == NULL)
+			err(1, "realloc()");
+		xd->buf = tmp;
+		xd->bufsize = size;
+	}
+	memcpy(xd->buf, path, len);
+	if (len > 0)
+		xd->buf[len++] = '/';
+	xd->len = len;
+	xd->hash = fnv(FNV_OFFSET, xd->buf, len);
+}
+
+/*
+ * Check whether an entry in the directory described by xd, which is
+ * only used if there are path patterns, should be excluded.  The name
+ * must be NUL-terminated.
+ */
+int
+dcexcl_match(struct dcxdir *xd, const char *name, size_t len)
+{
+	size_t i;
+
+	if (lits[0].n > 0 &&
+	    dcxset_find(&sets[0], fnv(FNV_OFFSET, name, len), name, len))
+		return (1);
+	if (dcexcl_paths()) {
+		memcpy(xd->buf + xd->len, name, len + 1);
+		if (lits[1].n > 0 && dcxset_find(&sets[1],
+		    fnv(xd->hash, name, len), xd->buf, xd->len + len))
+			return (1);
+	}
+	for (i = 0; i < globs[0].n; ++i)
+		if (fnmatch(globs[0].v[i], name, 0) == 0)
+			return (1);
+	for (i = 0; i < globs[1].n; ++i)
+		if (fnmatch(globs[1].v[i], xd->buf, FNM_PATHNAME) == 0)
+			return (1);
+	if (have_re[0] && regexec(&re[0], name, 0, NULL, 0) == 0)
+		return (1);
+	if (have_re[1] && regexec(&re[1], xd->buf, 0, NULL, 0) == 0)
+		return (1);
+	return (0);
+}
+
+/*
+ * Free the filter, leaving it empty.
+ */
+void
+dcexcl_fini(void)
+{
+	size_t i;
+	unsigned int k;
+
+	for (k = 0; k < 2; ++k) {
+		if (have_re[k])
+			regfree(&re[k]);
+		free(sets[k].tab);
+		free(lits[k].v);
+		free(globs[k].v);
+		free(res[k].v);
+	}
+	for (i = 0; i < owned.n; ++i)
+		free((void *)(uintptr_t)owned.v[i]);
+	free(owned.v);
+	free(all.v);
+	free(key);
+	memset(&all, 0, sizeof all);
+	memset(&owned, 0, sizeof owned);
+	memset(lits, 0, sizeof lits);
+	memset(globs, 0, sizeof globs);
+	memset(res, 0, sizeof res);
+	memset(sets, 0, sizeof sets);
+	memset(have_re, 0, sizeof have_re);
+	key = NULL;
+}
@@ -0,0 +1,60 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef DCEXCL_H_INCLUDED
+#define DCEXCL_H_INCLUDED
+
+/*
+ * Exclusion filter.  Patterns are literal names or paths, shell globs,
+ * or POSIX extended regular expressions.  A pattern which contains a
+ * slash is matched against the path of each entry relative to the path
+ * being scanned, anything else against its name alone.  Since excluded
+ * directories are never queued, excluding a directory prunes the whole
+ * subtree beneath it.
+ *
+ * The filter is set up once, before the scan, and is then read-only.
+ * Each thread describes the directory it is reading in a struct dcxdir,
+ * so that path patterns only cost as much as the entry's own name.
+ */
+struct dcxdir {
+	char *buf;			/* relative path, slash, and name */
+	size_t bufsize;
+	size_t len;			/* length of path and slash */
+	uint64_t hash;			/* hash of path and slash */
+};
+
+void dcexcl_add(const char *);
+void dcexcl_init(void);
+const char *dcexcl_key(void);
+int dcexcl_paths(void);
+void dcexcl_dir(struct dcxdir *, const char *, size_t);
+int dcexcl_match(struct dcxdir *, const char *, size_t);
+void dcexcl_fini(void);
+
+#endif
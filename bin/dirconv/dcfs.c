@@ -0,0 +1,313 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/types.h>
+#include <sys/param.h>
+#ifdef HAVE_SYS_VFS_H
+#include <sys/vfs.h>
+#else
+#include <sys/mount.h>
+#endif
+
+#include <err.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#include "dcfs.h"
+
+/*
+ * The visited set is split into shards, each with its own lock and
+ * open-addressing table, so that threads rarely wait for each other.
+ * A slot is empty if both fields are zero; the unlikely directory with
+ * device and inode number zero is remembered separately.
+ */
+#define DCFS_NSHARDS	64
+
+struct dcfsdir {
+	uint64_t dev;
+	uint64_t ino;
+};
+
+struct dcfsshard {
+	pthread_mutex_t lock;
+	struct dcfsdir *tab;
+	size_t mask, count;
+	int zero;
+};
+
+static struct dcfsshard shards[DCFS_NSHARDS];
+
+static uint64_t
+dcfs_hash(uint64_t dev, uint64_t ino)
+{
+	uint64_t h;
+
+	h = ino ^ (dev * 0x9e3779b97f4a7c15ULL);
+	h ^= h >> 33;
+	h *= 0xff51afd7ed558ccdULL;
+	h ^= h >> 33;
+	return (h);
+}
+
+void
+dcfs_init(void)
+{
+	unsigned int i;
+
+	for (i = 0; i < DCFS_NSHARDS; ++i)
+		pthread_mutex_init(&shards[i].lock, NULL);
+}
+
+static void
+dcfs_grow(struct dcfsshard *s)
+{
+	struct dcfsdir *otab, *d;
+	size_t i, osize, size;
+
+	otab = s->tab;
+	osize = otab != NULL ? s->mask + 1 : 0;
+	size = osize ? osize * 2 : 64;
+	if ((s->tab = calloc(size, sizeof *s->tab)) == NULL)
+		err(1, "calloc()");
+	s->mask = size - 1;
+	for (i = 0; i < osize; ++i) {
+		if (otab[i].dev == 0 && otab[i].ino == 0)
+			continue;
+		/* the low bits of the hash chose the shard */
+		for (d = &s->tab[(dcfs_hash(otab[i].dev, otab[i].ino) >> 6) &
+		     s->mask]; d->dev != 0 || d->ino != 0;
+		     d = &s->tab[(d - s->tab + 1) & s->mask])
+			/* nothing */;
+		*d = otab[i];
+	}
+	free(otab);
+}
+
+/*
+ * Record a directory.  Returns 0 the first time, 1 if it has been
+ * visited before.
+ */
+int
+dcfs_visit(dev_t dev, ino_t ino)
+{
+	struct dcfsshard *s;
+	struct dcfsdir *d;
+	uint64_t h;
+	int ret;
+
+	h = dcfs_hash(dev, ino);
+	s = &shards[h % DCFS_NSHARDS];
+	pthread_mutex_lock(&s->lock);
+	if (dev == 0 && ino == 0) {
+		ret = s->zero;
+		s->zero = 1;
+		pthread_mutex_unlock(&s->lock);
+		return (ret);
+	}
+	if (s->tab == NULL || (s->count + 1) * 4 > (s->mask + 1) * 3)
+		dcfs_grow(s);
+	for (d = &s->tab[(h >> 6) & s->mask]; d->dev != 0 || d->ino != 0;
+	     d = &s->tab[(d - s->tab + 1) & s->mask])
+		if (d->dev == (uint64_t)dev && d->ino == (uint64_t)ino)
+			break;
+	ret = d->dev != 0 || d->ino != 0;
+	if (!ret) {
+		d->dev = dev;
+		d->ino = ino;
+		s->count++;
+	}
+	pthread_mutex_unlock(&s->lock);
+	return (ret);
+}
+
+/*
+ * File system types, as given with -T.  If the list starts with "no",
+ * it lists the types not to descend into; otherwise, the only ones to
+ * descend into.
+ */
+static char **types;
+static size_t ntypes;
+static int negate;
+
+#ifdef HAVE_SYS_VFS_H
+/*
+ * Linux only tells us the magic number of the file system, so we need
+ * to know the numbers of those we want to be able to name.  Any other
+ * can be specified by number.  Where several names share a number, the
+ * first is the one we print.
+ */
+static const struct { const char *name; unsigned long magic; } magics[] = {
+	{ "autofs",	0x0187 },
+	{ "btrfs",	0x9123683e },
+	{ "ceph",	0x00c36400 },
+	{ "cgroup2",	0x63677270 },
+	{ "cifs",	0xff534d42 },
+	{ "devpts",	0x1cd1 },
+	{ "exfat",	0x2011bab0 },
+	{ "ext4",	0xef53 },
+	{ "ext2",	0xef53 },
+	{ "ext3",	0xef53 },
+	{ "f2fs",	0xf2f52010 },
+	{ "fuse",	0x65735546 },
+	{ "gfs2",	0x01161970 },
+	{ "iso9660",	0x9660 },
+	{ "lustre",	0x0bd00bd0 },
+	{ "vfat",	0x4d44 },
+	{ "msdos",	0x4d44 },
+	{ "nfs",	0x6969 },
+	{ "nfs4",	0x6969 },
+	{ "ntfs",	0x5346544e },
+	{ "overlay",	0x794c7630 },
+	{ "proc",	0x9fa0 },
+	{ "ramfs",	0x858458f6 },
+	{ "smb2",	0xfe534d42 },
+	{ "smb3",	0xfe534d42 },
+	{ "squashfs",	0x73717368 },
+	{ "sysfs",	0x62656572 },
+	{ "tmpfs",	0x01021994 },
+	{ "xfs",	0x58465342 },
+	{ "zfs",	0x2fc12fc1 },
+};
+
+static unsigned long
+dcfs_magic(const char *name)
+{
+	unsigned long magic;
+	unsigned int i;
+	char *end;
+
+	for (i = 0; i < sizeof magics / sizeof magics[0]; ++i)
+		if (strcasecmp(name, magics[i].name) == 0)
+			return (magics[i].magic);
+	magic = strtoul(name, &end, 0);
+	if (end == name || *end != '\0' || magic == 0)
+		errx(1, "unknown file system type: %s", name);
+	return (magic);
+}
+
+static const char *
+dcfs_name(unsigned long magic, char *buf, size_t size)
+{
+	unsigned int i;
+
+	for (i = 0; i < sizeof magics / sizeof magics[0]; ++i)
+		if (magics[i].magic == magic)
+			return (magics[i].name);
+	snprintf(buf, size, "%#lx", magic);
+	return (buf);
+}
+#endif
+
+void
+dcfs_types(const char *list)
+{
+	char *copy, *p, *q, **tmp;
+
+	if ((copy = strdup(list)) == NULL)
+		err(1, "strdup()");
+	p = copy;
+	if (strncmp(p, "no", 2) == 0) {
+		negate = 1;
+		p += 2;
+	}
+	while ((q = strsep(&p, ",")) != NULL) {
+		if (*q == '\0')
+			continue;
+#ifdef HAVE_SYS_VFS_H
+		(void)dcfs_magic(q);
+#endif
+		if ((tmp = realloc(types, (ntypes + 1) * sizeof *tmp)) == NULL)
+			err(1, "realloc()");
+		types = tmp;
+		if ((types[ntypes++] = strdup(q)) == NULL)
+			err(1, "strdup()");
+	}
+	free(copy);
+	if (ntypes == 0)
+		errx(1, "no file system types specified");
+}
+
+/*
+ * Decide whether to descend into the file system of the given open
+ * directory, according to the list of types, and store the name of its
+ * type in the buffer for the caller's messages.  If the type can't be
+ * determined, it doesn't match anything.
+ */
+int
+dcfs_cross(int fd, char *buf, size_t size)
+{
+	struct statfs sf;
+	const char *name;
+	size_t i;
+	int match;
+
+	snprintf(buf, size, "unknown");
+	if (fstatfs(fd, &sf) != 0)
+		return (negate || ntypes == 0);
+#ifdef HAVE_SYS_VFS_H
+	name = dcfs_name((unsigned long)sf.f_type, buf, size);
+	for (i = 0, match = 0; i < ntypes && !match; ++i)
+		match = dcfs_magic(types[i]) == (unsigned long)sf.f_type;
+#else
+	name = sf.f_fstypename;
+	for (i = 0, match = 0; i < ntypes && !match; ++i)
+		match = strcmp(types[i], name) == 0;
+#endif
+	if (name != buf)
+		snprintf(buf, size, "%s", name);
+	return (ntypes == 0 || match != negate);
+}
+
+void
+dcfs_fini(void)
+{
+	unsigned int i;
+	size_t j;
+
+	for (i = 0; i < DCFS_NSHARDS; ++i) {
+		free(shards[i].tab);
+		shards[i].tab = NULL;
+		shards[i].mask = shards[i].count = 0;
+		shards[i].zero = 0;
+		pthread_mutex_destroy(&shards[i].lock);
+	}
+	for (j = 0; j < ntypes; ++j)
+		free(types[j]);
+	free(types);
+	types = NULL;
+	ntypes = 0;
+}
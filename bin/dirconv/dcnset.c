@@ -0,0 +1,180 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <err.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "dcnset.h"
+
+#define FNV_OFFSET	0x811c9dc5U
+#define FNV_PRIME	0x01000193U
+
+static uint32_t
+fnv(const char *str, size_t len)
+{
+	uint32_t h;
+
+	for (h = FNV_OFFSET; len-- > 0; )
+		h = (h ^ (unsigned char)*str++) * FNV_PRIME;
+	return (h);
+}
+
+/*
+ * Locate the slot which holds the given name, or the empty slot where it
+ * belongs.  The table is never more than half full, so there always is
+ * one.
+ */
+static struct dcnslot *
+dcnset_slot(const struct dcnset *set, uint32_t h, const char *str,
+    size_t len)
+{
+	struct dcnslot *s;
+
+	for (s = &set->tab[h & set->mask]; s->gen == set->gen;
+	     s = &set->tab[(s - set->tab + 1) & set->mask])
+		if (s->hash == h && s->len == len &&
+		    memcmp(set->buf + s->off, str, len) == 0)
+			break;
+	return (s);
+}
+
+static void
+dcnset_grow(struct dcnset *set)
+{
+	struct dcnslot *otab, *s, *t;
+	size_t i, osize, size;
+
+	otab = set->tab;
+	osize = otab != NULL ? set->mask + 1 : 0;
+	size = osize ? osize * 2 : 256;
+	if ((set->tab = calloc(size, sizeof *set->tab)) == NULL)
+		err(1, "calloc()");
+	set->mask = size - 1;
+	/* a fresh table is all generation 0, so make sure we are not */
+	if (set->gen == 0)
+		set->gen = 1;
+	for (i = 0; i < osize; ++i) {
+		s = &otab[i];
+		if (s->gen != set->gen)
+			continue;
+		for (t = &set->tab[s->hash & set->mask]; t->gen == set->gen;
+		     t = &set->tab[(t - set->tab + 1) & set->mask])
+			/* nothing */;
+		*t = *s;
+	}
+	free(otab);
+}
+
+/*
+ * Empty the set.  Slots from earlier generations count as empty; on the
+ * rare occasion that the generation counter wraps, clear them for real.
+ */
+void
+dcnset_clear(struct dcnset *set)
+{
+
+	set->count = 0;
+	set->buflen = 0;
+	if (++set->gen == 0) {
+		if (set->tab != NULL)
+			memset(set->tab, 0, (set->mask + 1) * sizeof *set->tab);
+		set->gen = 1;
+	}
+}
+
+/*
+ * Return the tag of the given name, or 0 if it is not in the set.
+ */
+int
+dcnset_find(const struct dcnset *set, const char *str, size_t len)
+{
+	const struct dcnslot *s;
+
+	if (set->tab == NULL)
+		return (0);
+	s = dcnset_slot(set, fnv(str, len), str, len);
+	return (s->gen == set->gen ? s->tag : 0);
+}
+
+/*
+ * Add a name with the given tag.  If it is already there, return its
+ * previous tag and replace it; otherwise, return 0.
+ */
+int
+dcnset_add(struct dcnset *set, const char *str, size_t len, int tag)
+{
+	struct dcnslot *s;
+	uint32_t h;
+	size_t size;
+	char *tmp;
+	int ret;
+
+	if (set->tab == NULL || (set->count + 1) * 2 > set->mask + 1)
+		dcnset_grow(set);
+	h = fnv(str, len);
+	s = dcnset_slot(set, h, str, len);
+	if (s->gen == set->gen) {
+		ret = s->tag;
+		s->tag = tag;
+		return (ret);
+	}
+	if (set->buflen + len > set->bufsize) {
+		for (size = set->bufsize ? set->bufsize : 4096;
+		     size < set->buflen + len; size *= 2)
+			/* nothing */;
+		if ((tmp = realloc(set->buf, size)) == NULL)
+			err(1, "realloc()");
+		set->buf = tmp;
+		set->bufsize = size;
+	}
+	memcpy(set->buf + set->buflen, str, len);
+	s->hash = h;
+	s->gen = set->gen;
+	s->off = set->buflen;
+	s->len = len;
+	s->tag = tag;
+	set->buflen += len;
+	set->count++;
+	return (0);
+}
+
+void
+dcnset_free(struct dcnset *set)
+{
+
+	free(set->tab);
+	free(set->buf);
+	memset(set, 0, sizeof *set);
+}
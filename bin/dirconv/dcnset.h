@@ -0,0 +1,64 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef DCNSET_H_INCLUDED
+#define DCNSET_H_INCLUDED
+
+/*
+ * Set of the names in a directory, used to resolve renames without
+ * asking the file system whether each new name is taken.  Each thread
+ * fills its own set while reading a directory, then claims the new name
+ * of every entry it intends to rename.  The set keeps its own copy of
+ * the names, and is emptied in constant time by moving on to the next
+ * generation, so it can be reused for every directory.
+ */
+#define DCN_EXISTS	1		/* name was found in the directory */
+#define DCN_CLAIMED	2		/* name is the target of a rename */
+
+struct dcnslot {
+	uint32_t hash;
+	uint32_t gen;			/* empty unless current */
+	size_t off, len;		/* name in buf */
+	int tag;			/* DCN_* */
+};
+
+struct dcnset {
+	struct dcnslot *tab;
+	size_t mask, count;
+	uint32_t gen;
+	char *buf;
+	size_t buflen, bufsize;
+};
+
+void dcnset_clear(struct dcnset *);
+int dcnset_find(const struct dcnset *, const char *, size_t);
+int dcnset_add(struct dcnset *, const char *, size_t, int);
+void dcnset_free(struct dcnset *);
+
+#endif
@@ -0,0 +1,518 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+
+#include <err.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#if defined(HAVE_LINUX_IO_URING_H) && defined(SYS_io_uring_setup) && \
+    defined(STATX_TYPE)
+#define DC_URING 1
+#include <sys/mman.h>
+#include <linux/io_uring.h>
+#ifndef RENAME_NOREPLACE
+/* older C libraries lack it, but the kernel knows it if it has io_uring */
+#define RENAME_NOREPLACE (1 << 0)
+#endif
+#endif
+
+#include "dcops.h"
+
+static enum { be_sync, be_uring, be_pool } backend;
+static unsigned int depth;
+
+struct dcops {
+#ifdef DC_URING
+	struct dcuring *ring;
+	struct statx *stx;	/* one per operation in the batch */
+	size_t nstx;
+#else
+	int unused;
+#endif
+};
+
+/*
+ * Rename without replacing an existing file.  Not every file system
+ * supports this, in which case we check first, which leaves a window
+ * during which the new name can appear.
+ */
+static int
+dcop_rename_excl_exec(const struct dcop *op)
+{
+	struct stat sb;
+
+#if defined(HAVE_RENAMEAT2) && defined(RENAME_NOREPLACE)
+	if (renameat2(op->dfd, op->name, op->dfd, op->newname,
+	    RENAME_NOREPLACE) == 0)
+		return (0);
+	if (errno != EINVAL && errno != ENOSYS)
+		return (errno);
+#endif
+	if (fstatat(op->dfd, op->newname, &sb, AT_SYMLINK_NOFOLLOW) == 0)
+		return (EEXIST);
+	if (errno != ENOENT)
+		return (errno);
+	return (renameat(op->dfd, op->name,
+	    op->dfd, op->newname) == 0 ? 0 : errno);
+}
+
+/*
+ * Perform a single operation synchronously.
+ */
+static void
+dcop_exec(struct dcop *op)
+{
+	struct stat sb;
+
+	switch (op->kind) {
+	case dcop_stat:
+		if (fstatat(op->dfd, op->name, &sb, AT_SYMLINK_NOFOLLOW) == 0) {
+			op->res = 0;
+			op->mode = sb.st_mode;
+		} else {
+			op->res = errno;
+		}
+		break;
+	case dcop_rename:
+		op->res = renameat(op->dfd, op->name,
+		    op->dfd, op->newname) == 0 ? 0 : errno;
+		break;
+	case dcop_rename_excl:
+		op->res = dcop_rename_excl_exec(op);
+		break;
+	}
+}
+
+#ifdef DC_URING
+/*
+ * Minimal io_uring support, using the system calls directly so as not to
+ * depend on liburing.  Each thread has its own ring.
+ */
+struct dcuring {
+	int fd;
+	unsigned int *sq_head, *sq_tail, *sq_array;
+	unsigned int sq_mask, sq_entries;
+	unsigned int *cq_head, *cq_tail;
+	unsigned int cq_mask;
+	struct io_uring_sqe *sqes;
+	struct io_uring_cqe *cqes;
+	void *sq_ring, *cq_ring;
+	size_t sq_ring_size, cq_ring_size, sqes_size;
+};
+
+static void
+dcuring_close(struct dcuring *r)
+{
+
+	if (r->sqes != NULL && r->sqes != MAP_FAILED)
+		munmap(r->sqes, r->sqes_size);
+	if (r->cq_ring != NULL && r->cq_ring != MAP_FAILED &&
+	    r->cq_ring != r->sq_ring)
+		munmap(r->cq_ring, r->cq_ring_size);
+	if (r->sq_ring != NULL && r->sq_ring != MAP_FAILED)
+		munmap(r->sq_ring, r->sq_ring_size);
+	if (r->fd >= 0)
+		close(r->fd);
+	free(r);
+}
+
+/*
+ * Check that the kernel supports the operations we need.
+ */
+static int
+dcuring_probe(int fd)
+{
+	struct io_uring_probe *probe;
+	size_t size;
+	int ret;
+
+	size = sizeof *probe + 256 * sizeof probe->ops[0];
+	if ((probe = calloc(1, size)) == NULL)
+		return (0);
+	ret = syscall(SYS_io_uring_register, fd, IORING_REGISTER_PROBE,
+	    probe, 256) == 0 &&
+	    probe->last_op >= IORING_OP_STATX &&
+	    probe->last_op >= IORING_OP_RENAMEAT &&
+	    (probe->ops[IORING_OP_STATX].flags & IO_URING_OP_SUPPORTED) &&
+	    (probe->ops[IORING_OP_RENAMEAT].flags & IO_URING_OP_SUPPORTED);
+	free(probe);
+	return (ret);
+}
+
+static struct dcuring *
+dcuring_open(unsigned int entries)
+{
+	struct io_uring_params p;
+	struct dcuring *r;
+	char *sq, *cq;
+
+	if ((r = calloc(1, sizeof *r)) == NULL)
+		return (NULL);
+	memset(&p, 0, sizeof p);
+	if ((r->fd = syscall(SYS_io_uring_setup, entries, &p)) < 0 ||
+	    !dcuring_probe(r->fd))
+		goto fail;
+	r->sq_ring_size = p.sq_off.array + p.sq_entries * sizeof(unsigned int);
+	r->cq_ring_size = p.cq_off.cqes +
+	    p.cq_entries * sizeof(struct io_uring_cqe);
+	if ((p.features & IORING_FEAT_SINGLE_MMAP) &&
+	    r->cq_ring_size > r->sq_ring_size)
+		r->sq_ring_size = r->cq_ring_size;
+	r->sq_ring = mmap(NULL, r->sq_ring_size, PROT_READ | PROT_WRITE,
+	    MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQ_RING);
+	if (r->sq_ring == MAP_FAILED)
+		goto fail;
+	if (p.features & IORING_FEAT_SINGLE_MMAP)
+		r->cq_ring = r->sq_ring;
+	else
+		r->cq_ring = mmap(NULL, r->cq_ring_size,
+		    PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+		    r->fd, IORING_OFF_CQ_RING);
+	if (r->cq_ring == MAP_FAILED)
+		goto fail;
+	r->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+	r->sqes = mmap(NULL, r->sqes_size, PROT_READ | PROT_WRITE,
+	    MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQES);
+	if (r->sqes == MAP_FAILED)
+		goto fail;
+	sq = r->sq_ring;
+	r->sq_head = (unsigned int *)(sq + p.sq_off.head);
+	r->sq_tail = (unsigned int *)(sq + p.sq_off.tail);
+	r->sq_array = (unsigned int *)(sq + p.sq_off.array);
+	r->sq_mask = *(unsigned int *)(sq + p.sq_off.ring_mask);
+	r->sq_entries = p.sq_entries;
+	cq = r->cq_ring;
+	r->cq_head = (unsigned int *)(cq + p.cq_off.head);
+	r->cq_tail = (unsigned int *)(cq + p.cq_off.tail);
+	r->cq_mask = *(unsigned int *)(cq + p.cq_off.ring_mask);
+	r->cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+	return (r);
+fail:
+	dcuring_close(r);
+	return (NULL);
+}
+
+/*
+ * Run a batch of operations, keeping as many in flight as the ring
+ * allows.  Since we are the only ones submitting, and the completion
+ * queue is twice the size of the submission queue, it can't overflow.
+ */
+static void
+dcuring_run(struct dcops *ops, struct dcop *op, size_t n)
+{
+	struct dcuring *r = ops->ring;
+	struct io_uring_sqe *sqe;
+	struct io_uring_cqe *cqe;
+	unsigned int head, tail, idx, inflight, tosubmit;
+	size_t next, done;
+	struct dcop *o;
+	int ret;
+
+	if (ops->nstx < n) {
+		free(ops->stx);
+		if ((ops->stx = malloc(n * sizeof *ops->stx)) == NULL)
+			err(1, "malloc()");
+		ops->nstx = n;
+	}
+	for (next = done = 0, inflight = 0; done < n; ) {
+		/* fill the submission queue */
+		tail = *r->sq_tail;
+		for (; next < n && inflight < r->sq_entries; ++next) {
+			o = &op[next];
+			idx = tail & r->sq_mask;
+			sqe = &r->sqes[idx];
+			memset(sqe, 0, sizeof *sqe);
+			sqe->fd = o->dfd;
+			sqe->addr = (uintptr_t)o->name;
+			switch (o->kind) {
+			case dcop_stat:
+				sqe->opcode = IORING_OP_STATX;
+				sqe->len = STATX_TYPE;
+				sqe->off = (uintptr_t)&ops->stx[next];
+				sqe->statx_flags = AT_SYMLINK_NOFOLLOW;
+				break;
+			case dcop_rename:
+				sqe->opcode = IORING_OP_RENAMEAT;
+				sqe->len = o->dfd;
+				sqe->addr2 = (uintptr_t)o->newname;
+				break;
+			case dcop_rename_excl:
+				sqe->opcode = IORING_OP_RENAMEAT;
+				sqe->len = o->dfd;
+				sqe->addr2 = (uintptr_t)o->newname;
+				sqe->rename_flags = RENAME_NOREPLACE;
+				break;
+			}
+			sqe->user_data = next;
+			r->sq_array[idx] = idx;
+			++tail;
+			++inflight;
+		}
+		__atomic_store_n(r->sq_tail, tail, __ATOMIC_RELEASE);
+
+		/* submit and wait for at least one completion */
+		tosubmit = tail - __atomic_load_n(r->sq_head, __ATOMIC_ACQUIRE);
+		ret = syscall(SYS_io_uring_enter, r->fd, tosubmit, 1,
+		    IORING_ENTER_GETEVENTS, NULL, 0);
+		if (ret < 0 && errno != EINTR && errno != EAGAIN &&
+		    errno != EBUSY)
+			err(1, "io_uring_enter()");
+
+		/* reap completions */
+		head = *r->cq_head;
+		tail = __atomic_load_n(r->cq_tail, __ATOMIC_ACQUIRE);
+		for (; head != tail; ++head) {
+			cqe = &r->cqes[head & r->cq_mask];
+			o = &op[cqe->user_data];
+			o->res = cqe->res < 0 ? -cqe->res : 0;
+			if (o->kind == dcop_stat)
+				o->mode = ops->stx[cqe->user_data].stx_mode;
+			/* file system can't do it; take the slow path */
+			if (o->kind == dcop_rename_excl && o->res == EINVAL)
+				o->res = dcop_rename_excl_exec(o);
+			--inflight;
+			++done;
+		}
+		__atomic_store_n(r->cq_head, head, __ATOMIC_RELEASE);
+	}
+}
+#endif
+
+/*
+ * Thread pool.  A batch is put on a shared list, from which helper
+ * threads pick operations one by one.  The submitting thread helps out
+ * with its own batch, then waits for the helpers to finish.
+ */
+struct dcbatch {
+	struct dcop *op;
+	size_t n, next, done;
+	pthread_cond_t cond;
+	struct dcbatch *link;
+};
+
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pool_cond = PTHREAD_COND_INITIALIZER;
+static struct dcbatch *pool_list;
+static pthread_t *pool_thr;
+static unsigned int pool_nthr;
+static int pool_exit;
+
+static void
+pool_unlink(struct dcbatch *b)
+{
+	struct dcbatch **bp;
+
+	for (bp = &pool_list; *bp != NULL; bp = &(*bp)->link)
+		if (*bp == b) {
+			*bp = b->link;
+			break;
+		}
+}
+
+static void *
+pool_helper(void *arg)
+{
+	struct dcbatch *b;
+	size_t i;
+
+	(void)arg;
+	pthread_mutex_lock(&pool_lock);
+	for (;;) {
+		while (!pool_exit && pool_list == NULL)
+			pthread_cond_wait(&pool_cond, &pool_lock);
+		if (pool_exit)
+			break;
+		b = pool_list;
+		if (b->next == b->n) {
+			pool_list = b->link;
+			continue;
+		}
+		i = b->next++;
+		pthread_mutex_unlock(&pool_lock);
+		dcop_exec(&b->op[i]);
+		pthread_mutex_lock(&pool_lock);
+		if (++b->done == b->n)
+			pthread_cond_signal(&b->cond);
+	}
+	pthread_mutex_unlock(&pool_lock);
+	return (NULL);
+}
+
+static void
+pool_run(struct dcop *op, size_t n)
+{
+	struct dcbatch b;
+	size_t i;
+
+	b.op = op;
+	b.n = n;
+	b.next = b.done = 0;
+	pthread_cond_init(&b.cond, NULL);
+	pthread_mutex_lock(&pool_lock);
+	b.link = pool_list;
+	pool_list = &b;
+	pthread_cond_broadcast(&pool_cond);
+	while (b.next < n) {
+		i = b.next++;
+		pthread_mutex_unlock(&pool_lock);
+		dcop_exec(&op[i]);
+		pthread_mutex_lock(&pool_lock);
+		++b.done;
+	}
+	pool_unlink(&b);
+	while (b.done < n)
+		pthread_cond_wait(&b.cond, &pool_lock);
+	pthread_mutex_unlock(&pool_lock);
+	pthread_cond_destroy(&b.cond);
+}
+
+/*
+ * Choose a backend for the given queue depth and number of threads and
+ * return its name.
+ */
+const char *
+dcops_init(unsigned int qd, unsigned int nthr)
+{
+#ifdef DC_URING
+	struct dcuring *r;
+#endif
+	unsigned int i;
+
+	depth = qd;
+	if (depth <= 1) {
+		backend = be_sync;
+		return ("sync");
+	}
+#ifdef DC_URING
+	if ((r = dcuring_open(depth)) != NULL) {
+		dcuring_close(r);
+		backend = be_uring;
+		return ("io_uring");
+	}
+#endif
+	backend = be_pool;
+	pool_nthr = (depth - 1) * nthr;
+	if (pool_nthr > 256)
+		pool_nthr = 256;
+	if ((pool_thr = calloc(pool_nthr, sizeof *pool_thr)) == NULL)
+		err(1, "calloc()");
+	for (i = 0; i < pool_nthr; ++i)
+		if ((errno = pthread_create(&pool_thr[i], NULL,
+		    pool_helper, NULL)) != 0)
+			err(1, "pthread_create()");
+	return ("threads");
+}
+
+void
+dcops_fini(void)
+{
+	unsigned int i;
+
+	if (backend != be_pool)
+		return;
+	pthread_mutex_lock(&pool_lock);
+	pool_exit = 1;
+	pthread_cond_broadcast(&pool_cond);
+	pthread_mutex_unlock(&pool_lock);
+	for (i = 0; i < pool_nthr; ++i)
+		pthread_join(pool_thr[i], NULL);
+	free(pool_thr);
+	pool_thr = NULL;
+	pool_nthr = 0;
+}
+
+/*
+ * Per-thread state.  If we fail to set up a ring for this thread, it
+ * falls back to synchronous operation.
+ */
+struct dcops *
+dcops_open(void)
+{
+	struct dcops *ops;
+
+	if ((ops = calloc(1, sizeof *ops)) == NULL)
+		err(1, "calloc()");
+#ifdef DC_URING
+	if (backend == be_uring)
+		ops->ring = dcuring_open(depth);
+#endif
+	return (ops);
+}
+
+void
+dcops_close(struct dcops *ops)
+{
+
+#ifdef DC_URING
+	if (ops->ring != NULL)
+		dcuring_close(ops->ring);
+	free(ops->stx);
+#endif
+	free(ops);
+}
+
+/*
+ * Carry out a batch of operations and wait for all of them to complete.
+ */
+void
+dcops_run(struct dcops *ops, struct dcop *op, size_t n)
+{
+	size_t i;
+
+	if (n == 0)
+		return;
+#ifdef DC_URING
+	if (ops->ring != NULL) {
+		dcuring_run(ops, op, n);
+		return;
+	}
+#else
+	(void)ops;
+#endif
+	if (backend == be_pool && n > 1) {
+		pool_run(op, n);
+		return;
+	}
+	for (i = 0; i < n; ++i)
+		dcop_exec(&op[i]);
+}
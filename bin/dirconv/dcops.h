@@ -0,0 +1,64 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef DCOPS_H_INCLUDED
+#define DCOPS_H_INCLUDED
+
+/*
+ * Batched metadata operations.  A batch of operations on the entries of
+ * a directory is handed over at once and may be carried out in any
+ * order, with up to a configurable number in flight: by io_uring where
+ * available, otherwise by a pool of helper threads, or one at a time if
+ * the queue depth is 1.
+ */
+enum dcop_kind {
+	dcop_stat,		/* lstat name, relative to dfd */
+	dcop_rename,		/* rename name to newname within dfd */
+	dcop_rename_excl,	/* same, but fail if newname exists */
+};
+
+struct dcop {
+	enum dcop_kind kind;
+	int dfd;
+	const char *name;
+	const char *newname;
+	size_t ent;		/* for the caller's use */
+	int res;		/* 0 or an errno value */
+	mode_t mode;		/* result of dcop_stat */
+};
+
+struct dcops;
+
+const char *dcops_init(unsigned int, unsigned int);
+void dcops_fini(void);
+struct dcops *dcops_open(void);
+void dcops_close(struct dcops *);
+void dcops_run(struct dcops *, struct dcop *, size_t);
+
+#endif
@@ -0,0 +1,646 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <sys/types.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <dirent.h>
+#include <err.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "dcops.h"
+#include "dcplan.h"
+
+/*
+ * The plan file consists of a header followed by one group per
+ * directory.  Each group consists of a group header, the path of the
+ * directory, and its entries.  Each entry consists of an entry header
+ * followed by the old and new names.  Paths and names are NUL-terminated
+ * and padded to a multiple of eight bytes.  Like the scan cache, the
+ * file is written in native byte order.
+ */
+#define DCP_MAGIC	"dirplan"
+#define DCP_VERSION	1
+#define DCP_PAD(n)	(((n) + 7) & ~(size_t)7)
+#define DCP_BATCH	1024
+
+struct dcphdr {
+	char magic[8];
+	uint32_t version;
+	uint32_t spare;
+	uint64_t ngroups;
+};
+
+struct dcpgrp {
+	uint64_t dev;
+	uint64_t ino;
+	uint32_t depth;		/* number of components in path */
+	uint32_t nents;
+	uint32_t pathlen;
+	uint32_t spare;
+};
+
+struct dcpent {
+	uint8_t done;		/* set once renamed */
+	uint8_t type;		/* DT_* */
+	uint16_t oldlen;
+	uint16_t newlen;
+	uint16_t spare;
+};
+
+#define DCPENT_OLD(e)	((char *)((e) + 1))
+#define DCPENT_NEW(e)	(DCPENT_OLD(e) + (e)->oldlen + 1)
+#define DCPENT_SIZE(e)	(sizeof *(e) + DCP_PAD((e)->oldlen + (e)->newlen + 2))
+
+/*
+ * Per-thread log of planned renames.  Since a thread finishes with one
+ * directory before moving on to the next, each group's path and entries
+ * are contiguous in the buffer.
+ */
+struct dcplgrp {
+	struct dcpgrp hdr;
+	size_t off;		/* offset of path and entries in buf */
+	size_t len;
+};
+
+struct dcplog {
+	struct dcplgrp *grps;
+	size_t ngrps, grpsize;
+	char *buf;
+	size_t buflen, bufsize;
+};
+
+struct dcplog *
+dcplog_new(void)
+{
+	struct dcplog *log;
+
+	if ((log = calloc(1, sizeof *log)) == NULL)
+		err(1, "calloc()");
+	return (log);
+}
+
+/*
+ * Reserve space for len more bytes at the end of the buffer, zeroed.
+ */
+static char *
+dcplog_grow(struct dcplog *log, size_t len)
+{
+	char *p;
+
+	if (log->buflen + len > log->bufsize) {
+		while (log->buflen + len > log->bufsize)
+			log->bufsize = log->bufsize ? log->bufsize * 2 : 65536;
+		if ((p = realloc(log->buf, log->bufsize)) == NULL)
+			err(1, "realloc()");
+		log->buf = p;
+	}
+	p = log->buf + log->buflen;
+	memset(p, 0, len);
+	log->buflen += len;
+	if (log->ngrps > 0)
+		log->grps[log->ngrps - 1].len += len;
+	return (p);
+}
+
+/*
+ * Start a new group for the given directory.
+ */
+void
+dcplog_dir(struct dcplog *log, const char *path, const struct stat *st)
+{
+	struct dcplgrp *g;
+	size_t len;
+	const char *p;
+
+	if (log->ngrps == log->grpsize) {
+		log->grpsize = log->grpsize ? log->grpsize * 2 : 256;
+		if ((g = realloc(log->grps, log->grpsize * sizeof *g)) == NULL)
+			err(1, "realloc()");
+		log->grps = g;
+	}
+	g = &log->grps[log->ngrps++];
+	memset(g, 0, sizeof *g);
+	g->hdr.dev = st->st_dev;
+	g->hdr.ino = st->st_ino;
+	for (p = path; *p != '\0'; ++p)
+		if (*p == '/' && p[1] != '/' && p[1] != '\0')
+			g->hdr.depth++;
+	len = p - path;
+	g->hdr.pathlen = len;
+	g->off = log->buflen;
+	memcpy(dcplog_grow(log, DCP_PAD(len + 1)), path, len);
+}
+
+/*
+ * Add an entry to the current group.
+ */
+void
+dcplog_add(struct dcplog *log, unsigned int type, const char *oldname,
+    size_t oldlen, const char *newname, size_t newlen)
+{
+	struct dcpent e;
+	char *p;
+
+	memset(&e, 0, sizeof e);
+	e.type = type;
+	e.oldlen = oldlen;
+	e.newlen = newlen;
+	p = dcplog_grow(log, DCPENT_SIZE(&e));
+	memcpy(p, &e, sizeof e);
+	memcpy(p + sizeof e, oldname, oldlen);
+	memcpy(p + sizeof e + oldlen + 1, newname, newlen);
+	log->grps[log->ngrps - 1].hdr.nents++;
+}
+
+void
+dcplog_free(struct dcplog *log)
+{
+
+	free(log->grps);
+	free(log->buf);
+	free(log);
+}
+
+/*
+ * Sort groups deepest first, then by path so the plan does not depend on
+ * the order in which the threads happened to visit the directories.
+ */
+struct dcplref {
+	const struct dcplgrp *grp;
+	const char *buf;
+};
+
+static int
+dcplref_cmp(const void *a, const void *b)
+{
+	const struct dcplref *x = a, *y = b;
+
+	if (x->grp->hdr.depth != y->grp->hdr.depth)
+		return (x->grp->hdr.depth > y->grp->hdr.depth ? -1 : 1);
+	return (strcmp(x->buf + x->grp->off, y->buf + y->grp->off));
+}
+
+/*
+ * Write the plan.
+ */
+int
+dcplan_save(const char *path, struct dcplog **logs, unsigned int nlogs)
+{
+	struct dcphdr hdr;
+	struct dcplref *all;
+	char *tmppath;
+	size_t i, j, n, len;
+	FILE *f;
+	int fd, ret;
+
+	for (i = n = 0; i < nlogs; ++i)
+		n += logs[i]->ngrps;
+	if ((all = calloc(n ? n : 1, sizeof *all)) == NULL)
+		err(1, "calloc()");
+	for (i = n = 0; i < nlogs; ++i) {
+		for (j = 0; j < logs[i]->ngrps; ++j, ++n) {
+			all[n].grp = &logs[i]->grps[j];
+			all[n].buf = logs[i]->buf;
+		}
+	}
+	qsort(all, n, sizeof *all, dcplref_cmp);
+
+	len = strlen(path) + sizeof ".XXXXXX";
+	if ((tmppath = malloc(len)) == NULL)
+		err(1, "malloc()");
+	snprintf(tmppath, len, "%s.XXXXXX", path);
+	if ((fd = mkstemp(tmppath)) < 0 || (f = fdopen(fd, "w")) == NULL) {
+		warn("%s", tmppath);
+		if (fd >= 0) {
+			close(fd);
+			unlink(tmppath);
+		}
+		free(tmppath);
+		free(all);
+		return (-1);
+	}
+	memset(&hdr, 0, sizeof hdr);
+	memcpy(hdr.magic, DCP_MAGIC, sizeof hdr.magic);
+	hdr.version = DCP_VERSION;
+	hdr.ngroups = n;
+	fwrite(&hdr, sizeof hdr, 1, f);
+	for (i = 0; i < n; ++i) {
+		fwrite(&all[i].grp->hdr, sizeof all[i].grp->hdr, 1, f);
+		fwrite(all[i].buf + all[i].grp->off, 1, all[i].grp->len, f);
+	}
+	free(all);
+	ret = ferror(f);
+	if (fclose(f) != 0 || ret != 0 || rename(tmppath, path) != 0) {
+		warn("%s", path);
+		unlink(tmppath);
+		free(tmppath);
+		return (-1);
+	}
+	free(tmppath);
+	return (0);
+}
+
+/*
+ * Shared state for applying a plan.  The groups are processed one level
+ * at a time; the threads take groups from the current level until there
+ * are none left, and the main thread waits for the level to finish
+ * before starting the next.
+ */
+struct dcpapply {
+	pthread_mutex_t lock;
+	pthread_cond_t work;	/* a new level has started */
+	pthread_cond_t idle;	/* the current level is done */
+	struct dcpgrp **grps;
+	size_t next, end;
+	unsigned int busy;
+	int quit;
+	int dryrun, force;
+	int errcnt;
+};
+
+/*
+ * Each thread collects the renames it reports for a directory in its
+ * own buffer, and writes them out in one piece once the directory is
+ * done, so that the output of different threads does not interleave.
+ */
+struct dcpout {
+	char *buf;
+	size_t len, size;
+};
+
+static pthread_mutex_t dcplan_outlock = PTHREAD_MUTEX_INITIALIZER;
+
+/*
+ * Append a rename to the output buffer.
+ */
+static void
+dcpout_add(struct dcpout *out, const struct dcpgrp *g, const char *path,
+    const struct dcpent *e)
+{
+	size_t len, size;
+	char *tmp;
+
+	len = 2 * g->pathlen + e->oldlen + e->newlen + sizeof "/ -> /\n";
+	if (out->len + len > out->size) {
+		for (size = out->size ? out->size : 4096;
+		    size < out->len + len; size *= 2)
+			/* nothing */ ;
+		if ((tmp = realloc(out->buf, size)) == NULL)
+			err(1, "realloc()");
+		out->buf = tmp;
+		out->size = size;
+	}
+	out->len += snprintf(out->buf + out->len, out->size - out->len,
+	    "%s/%s -> %s/%s\n", path, DCPENT_OLD(e), path, DCPENT_NEW(e));
+}
+
+/*
+ * Write out and empty the output buffer.
+ */
+static void
+dcpout_flush(struct dcpout *out)
+{
+
+	if (out->len == 0)
+		return;
+	pthread_mutex_lock(&dcplan_outlock);
+	if (fwrite(out->buf, 1, out->len, stdout) != out->len ||
+	    fflush(stdout) != 0)
+		err(1, "stdout");
+	pthread_mutex_unlock(&dcplan_outlock);
+	out->len = 0;
+}
+
+/*
+ * Apply the planned renames in a single directory.
+ */
+static int
+dcplan_dir(struct dcpapply *pa, struct dcops *ops, struct dcop *op,
+    struct dcpout *out, struct dcpgrp *g)
+{
+	struct dcpent *ents[DCP_BATCH], *e;
+	const char *path;
+	struct stat st;
+	char *p;
+	size_t i, k, m, n;
+	int dfd, errcnt;
+
+	path = (const char *)(g + 1);
+	p = (char *)(g + 1) + DCP_PAD(g->pathlen + 1);
+	if (pa->dryrun) {
+		for (k = 0; k < g->nents; ++k, p += DCPENT_SIZE(e)) {
+			e = (struct dcpent *)p;
+			if (!e->done)
+				printf("%s/%s -> %s/%s\n", path, DCPENT_OLD(e),
+				    path, DCPENT_NEW(e));
+		}
+		return (0);
+	}
+
+	/* skip directories which were completed by an earlier run */
+	for (k = 0; k < g->nents; ++k, p += DCPENT_SIZE(e)) {
+		e = (struct dcpent *)p;
+		if (!e->done)
+			break;
+	}
+	if (k == g->nents)
+		return (0);
+	if ((dfd = open(path, O_RDONLY | O_DIRECTORY)) < 0) {
+		warn("%s", path);
+		return (1);
+	}
+	if (fstat(dfd, &st) != 0 || (uint64_t)st.st_dev != g->dev ||
+	    (uint64_t)st.st_ino != g->ino) {
+		warnx("%s: not the directory that was scanned", path);
+		close(dfd);
+		return (1);
+	}
+	errcnt = 0;
+	while (k < g->nents) {
+		/* collect a batch of entries which are not yet done */
+		for (n = 0; k < g->nents && n < DCP_BATCH;
+		    ++k, p += DCPENT_SIZE(e)) {
+			e = (struct dcpent *)p;
+			if (!e->done)
+				ents[n++] = e;
+		}
+
+		/* look at both the old and the new names */
+		for (i = 0; i < n; ++i) {
+			op[2 * i].kind = op[2 * i + 1].kind = dcop_stat;
+			op[2 * i].dfd = op[2 * i + 1].dfd = dfd;
+			op[2 * i].name = DCPENT_OLD(ents[i]);
+			op[2 * i + 1].name = DCPENT_NEW(ents[i]);
+		}
+		dcops_run(ops, op, 2 * n);
+		for (i = 0; i < n; ++i) {
+			e = ents[i];
+			if (op[2 * i].res == ENOENT && op[2 * i + 1].res == 0) {
+				/* renamed by an earlier, interrupted run */
+				e->done = 1;
+				ents[i] = NULL;
+			} else if (op[2 * i].res != 0) {
+				errno = op[2 * i].res;
+				warn("lstat(%s/%s)", path, DCPENT_OLD(e));
+				++errcnt;
+				ents[i] = NULL;
+			} else if (op[2 * i + 1].res == 0 && !pa->force) {
+				errno = EEXIST;
+				warn("%s/%s", path, DCPENT_NEW(e));
+				++errcnt;
+				ents[i] = NULL;
+			}
+		}
+
+		/* rename */
+		for (i = m = 0; i < n; ++i) {
+			if ((e = ents[i]) == NULL)
+				continue;
+			dcpout_add(out, g, path, e);
+			op[m].kind = pa->force ? dcop_rename : dcop_rename_excl;
+			op[m].dfd = dfd;
+			op[m].name = DCPENT_OLD(e);
+			op[m].newname = DCPENT_NEW(e);
+			op[m++].ent = i;
+		}
+		dcops_run(ops, op, m);
+		for (i = 0; i < m; ++i) {
+			e = ents[op[i].ent];
+			if (op[i].res == EEXIST &&
+			    op[i].kind == dcop_rename_excl) {
+				/* created since we looked */
+				errno = EEXIST;
+				warn("%s/%s", path, DCPENT_NEW(e));
+				++errcnt;
+			} else if (op[i].res != 0) {
+				errno = op[i].res;
+				warn("rename(%s/%s, %s/%s)", path,
+				    DCPENT_OLD(e), path, DCPENT_NEW(e));
+				++errcnt;
+			} else {
+				e->done = 1;
+			}
+		}
+	}
+	close(dfd);
+	dcpout_flush(out);
+	return (errcnt);
+}
+
+static void *
+dcplan_worker(void *arg)
+{
+	struct dcpapply *pa = arg;
+	struct dcpout out = { NULL, 0, 0 };
+	struct dcops *ops;
+	struct dcop *op;
+	struct dcpgrp *g;
+	int errcnt;
+
+	ops = dcops_open();
+	if ((op = calloc(2 * DCP_BATCH, sizeof *op)) == NULL)
+		err(1, "calloc()");
+	pthread_mutex_lock(&pa->lock);
+	for (;;) {
+		if (pa->next < pa->end) {
+			g = pa->grps[pa->next++];
+			pa->busy++;
+			pthread_mutex_unlock(&pa->lock);
+			errcnt = dcplan_dir(pa, ops, op, &out, g);
+			pthread_mutex_lock(&pa->lock);
+			pa->errcnt += errcnt;
+			if (--pa->busy == 0 && pa->next == pa->end)
+				pthread_cond_signal(&pa->idle);
+		} else if (pa->quit) {
+			break;
+		} else {
+			pthread_cond_wait(&pa->work, &pa->lock);
+		}
+	}
+	pthread_mutex_unlock(&pa->lock);
+	free(out.buf);
+	free(op);
+	dcops_close(ops);
+	return (NULL);
+}
+
+/*
+ * Check that the plan is well-formed, and return a list of its groups.
+ */
+static struct dcpgrp **
+dcplan_load(char *map, size_t size, size_t *ngrps)
+{
+	const struct dcphdr *hdr;
+	struct dcpgrp **grps, *g;
+	struct dcpent *e;
+	size_t i, k, len;
+	char *p, *end;
+
+	hdr = (const struct dcphdr *)map;
+	if (size < sizeof *hdr ||
+	    memcmp(hdr->magic, DCP_MAGIC, sizeof hdr->magic) != 0 ||
+	    hdr->version != DCP_VERSION ||
+	    hdr->ngroups > size / sizeof *g)
+		return (NULL);
+	if ((grps = calloc(hdr->ngroups ? hdr->ngroups : 1,
+	    sizeof *grps)) == NULL)
+		err(1, "calloc()");
+	p = map + sizeof *hdr;
+	end = map + size;
+	for (i = 0; i < hdr->ngroups; ++i) {
+		g = (struct dcpgrp *)p;
+		if ((size_t)(end - p) < sizeof *g)
+			goto bad;
+		len = DCP_PAD(g->pathlen + 1);
+		p += sizeof *g;
+		if ((size_t)(end - p) < len || g->pathlen == 0 ||
+		    memchr(p, '\0', len) != p + g->pathlen ||
+		    (i > 0 && g->depth > grps[i - 1]->depth))
+			goto bad;
+		p += len;
+		for (k = 0; k < g->nents; ++k) {
+			e = (struct dcpent *)p;
+			if ((size_t)(end - p) < sizeof *e ||
+			    (size_t)(end - p) < DCPENT_SIZE(e) ||
+			    e->oldlen == 0 || e->newlen == 0 ||
+			    memchr(DCPENT_OLD(e), '\0', e->oldlen + 1) !=
+			    DCPENT_OLD(e) + e->oldlen ||
+			    memchr(DCPENT_NEW(e), '\0', e->newlen + 1) !=
+			    DCPENT_NEW(e) + e->newlen)
+				goto bad;
+			p += DCPENT_SIZE(e);
+		}
+		grps[i] = g;
+	}
+	if (p != end)
+		goto bad;
+	*ngrps = hdr->ngroups;
+	return (grps);
+bad:
+	free(grps);
+	return (NULL);
+}
+
+/*
+ * List or apply a plan.  Returns the number of errors.
+ */
+int
+dcplan_apply(const char *path, unsigned int nthr, int dryrun, int force)
+{
+	struct dcpapply pa;
+	struct dcpgrp **grps;
+	pthread_t *thr;
+	struct stat st;
+	size_t i, j, n;
+	char *map;
+	int fd;
+
+	if ((fd = open(path, dryrun ? O_RDONLY : O_RDWR)) < 0 ||
+	    fstat(fd, &st) != 0) {
+		warn("%s", path);
+		if (fd >= 0)
+			close(fd);
+		return (1);
+	}
+	if (st.st_size == 0 || (map = mmap(NULL, st.st_size,
+	    PROT_READ | (dryrun ? 0 : PROT_WRITE), MAP_SHARED,
+	    fd, 0)) == MAP_FAILED) {
+		warn("%s", path);
+		close(fd);
+		return (1);
+	}
+	close(fd);
+	if ((grps = dcplan_load(map, st.st_size, &n)) == NULL) {
+		warnx("%s: not a valid plan", path);
+		munmap(map, st.st_size);
+		return (1);
+	}
+	memset(&pa, 0, sizeof pa);
+	pa.grps = grps;
+	pa.dryrun = dryrun;
+	pa.force = force;
+	if (dryrun) {
+		for (i = 0; i < n; ++i)
+			dcplan_dir(&pa, NULL, NULL, NULL, grps[i]);
+		free(grps);
+		munmap(map, st.st_size);
+		return (0);
+	}
+
+	pthread_mutex_init(&pa.lock, NULL);
+	pthread_cond_init(&pa.work, NULL);
+	pthread_cond_init(&pa.idle, NULL);
+	if ((thr = calloc(nthr, sizeof *thr)) == NULL)
+		err(1, "calloc()");
+	for (i = 0; i < nthr; ++i)
+		if ((errno = pthread_create(&thr[i], NULL,
+		    dcplan_worker, &pa)) != 0)
+			err(1, "pthread_create()");
+	for (i = 0; i < n; i = j) {
+		for (j = i + 1; j < n && grps[j]->depth == grps[i]->depth; ++j)
+			/* nothing */ ;
+		pthread_mutex_lock(&pa.lock);
+		pa.next = i;
+		pa.end = j;
+		pthread_cond_broadcast(&pa.work);
+		while (pa.next < pa.end || pa.busy > 0)
+			pthread_cond_wait(&pa.idle, &pa.lock);
+		pthread_mutex_unlock(&pa.lock);
+
+		/* record our progress before moving up a level */
+		msync(map, st.st_size, MS_SYNC);
+	}
+	pthread_mutex_lock(&pa.lock);
+	pa.quit = 1;
+	pthread_cond_broadcast(&pa.work);
+	pthread_mutex_unlock(&pa.lock);
+	for (i = 0; i < nthr; ++i)
+		pthread_join(thr[i], NULL);
+	free(thr);
+	pthread_cond_destroy(&pa.idle);
+	pthread_cond_destroy(&pa.work);
+	pthread_mutex_destroy(&pa.lock);
+	free(grps);
+	munmap(map, st.st_size);
+	return (pa.errcnt);
+}
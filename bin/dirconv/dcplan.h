@@ -0,0 +1,58 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef DCPLAN_H_INCLUDED
+#define DCPLAN_H_INCLUDED
+
+/*
+ * Rename plans.  Instead of renaming entries as it finds them, the scan
+ * can record each rename in a per-thread log: the directory (by path,
+ * device and inode), the entry's type, and its old and new names.  At
+ * the end of the scan, the logs are written to a plan file, grouped by
+ * directory, deepest first.
+ *
+ * The plan can then be listed or applied without scanning the tree
+ * again.  Directories at the same depth are independent of each other
+ * and are processed in parallel; a directory is only renamed after
+ * everything below it is done, so the paths recorded in the plan stay
+ * valid.  Each entry is marked in the plan file once it has been
+ * renamed, so an interrupted run can be resumed.
+ */
+struct dcplog;
+
+struct dcplog *dcplog_new(void);
+void dcplog_dir(struct dcplog *, const char *, const struct stat *);
+void dcplog_add(struct dcplog *, unsigned int, const char *, size_t,
+    const char *, size_t);
+void dcplog_free(struct dcplog *);
+int dcplan_save(const char *, struct dcplog **, unsigned int);
+
+int dcplan_apply(const char *, unsigned int, int, int);
+
+#endif
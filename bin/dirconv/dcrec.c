@@ -0,0 +1,257 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <dirent.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "dcrec.h"
+
+static const char *dcrec_results[] = {
+	[dcrec_none] = "none",
+	[dcrec_dryrun] = "dry-run",
+	[dcrec_renamed] = "renamed",
+	[dcrec_planned] = "planned",
+	[dcrec_collision] = "collision",
+	[dcrec_failed] = "failed",
+};
+
+static const char *
+dcrec_class(cv_nameclass nc)
+{
+
+	switch (nc) {
+	case CV_NC_8BIT:
+		return ("8bit");
+	case CV_NC_ASCII:
+		return ("ascii");
+	case CV_NC_UTF8:
+		return ("utf8");
+	case CV_NC_WTF8:
+		return ("wtf8");
+	case CV_NC_NFD:
+		return ("nfd");
+	}
+	return ("unknown");
+}
+
+static const char *
+dcrec_type(unsigned int type)
+{
+
+	switch (type) {
+#ifdef DT_DIR
+	case DT_DIR:
+		return ("dir");
+	case DT_REG:
+		return ("file");
+	case DT_LNK:
+		return ("symlink");
+	case DT_FIFO:
+		return ("fifo");
+	case DT_SOCK:
+		return ("socket");
+	case DT_CHR:
+		return ("char");
+	case DT_BLK:
+		return ("block");
+#endif
+	}
+	return ("unknown");
+}
+
+/*
+ * Return the length of the valid UTF-8 sequence at the start of a
+ * string, or 0 if there is none.
+ */
+static size_t
+dcrec_utf8(const unsigned char *p, size_t len)
+{
+	uint32_t cp, min;
+	size_t i, n;
+
+	if (p[0] < 0xc2 || p[0] > 0xf4)
+		return (0);
+	if (p[0] < 0xe0) {
+		n = 2, min = 0x80, cp = p[0] & 0x1f;
+	} else if (p[0] < 0xf0) {
+		n = 3, min = 0x800, cp = p[0] & 0x0f;
+	} else {
+		n = 4, min = 0x10000, cp = p[0] & 0x07;
+	}
+	if (n > len)
+		return (0);
+	for (i = 1; i < n; ++i) {
+		if ((p[i] & 0xc0) != 0x80)
+			return (0);
+		cp = cp << 6 | (p[i] & 0x3f);
+	}
+	if (cp < min || cp > 0x10ffff || (cp >= 0xd800 && cp < 0xe000))
+		return (0);
+	return (n);
+}
+
+/*
+ * Append a string to a JSON string.  Bytes which are not part of a
+ * valid UTF-8 sequence are escaped as lone surrogates, U+DC80 through
+ * U+DCFF, so the original can be recovered; this is the same convention
+ * as Python's surrogateescape error handler.  At most six bytes are
+ * written per input byte.
+ */
+static char *
+dcrec_jstr(char *q, const char *str, size_t len)
+{
+	const unsigned char *p = (const unsigned char *)str;
+	size_t n;
+
+	while (len > 0) {
+		if (*p >= 0x80) {
+			if ((n = dcrec_utf8(p, len)) > 0) {
+				memcpy(q, p, n);
+				q += n, p += n, len -= n;
+			} else {
+				q += sprintf(q, "\\udc%02x", *p);
+				p++, len--;
+			}
+			continue;
+		}
+		if (*p == '"' || *p == '\\') {
+			*q++ = '\\';
+			*q++ = *p;
+		} else if (*p < 0x20) {
+			q += sprintf(q, "\\u%04x", *p);
+		} else {
+			*q++ = *p;
+		}
+		p++, len--;
+	}
+	return (q);
+}
+
+static char *
+dcrec_put32(char *q, uint32_t v)
+{
+
+	*q++ = v;
+	*q++ = v >> 8;
+	*q++ = v >> 16;
+	*q++ = v >> 24;
+	return (q);
+}
+
+static char *
+dcrec_put64(char *q, uint64_t v)
+{
+
+	q = dcrec_put32(q, v);
+	return (dcrec_put32(q, v >> 32));
+}
+
+/*
+ * Return an upper bound on the length of a record, in either JSON or
+ * binary form.
+ */
+size_t
+dcrec_max(const struct dcrec *rec, int binary)
+{
+	size_t len;
+
+	len = strlen(rec->dir) + 1;
+	len = 2 * len + rec->namelen + rec->newlen;
+	if (binary)
+		return (len + 32);
+	return (6 * len + 256);
+}
+
+/*
+ * Write out a record.  The buffer must have room for at least as many
+ * bytes as dcrec_max() returned.  Returns the actual length.
+ */
+size_t
+dcrec_put(char *buf, const struct dcrec *rec, int binary)
+{
+	size_t dirlen;
+	char *q;
+
+	dirlen = strlen(rec->dir);
+	q = buf;
+	if (binary) {
+		q += 4;
+		q = dcrec_put64(q, rec->ino);
+		*q++ = rec->type;
+		*q++ = rec->nc;
+		*q++ = rec->result;
+		*q++ = 0;
+		q = dcrec_put32(q, rec->err);
+		q = dcrec_put32(q, dirlen + 1 + rec->namelen);
+		memcpy(q, rec->dir, dirlen);
+		q += dirlen;
+		*q++ = '/';
+		memcpy(q, rec->name, rec->namelen);
+		q += rec->namelen;
+		if (rec->newname != NULL) {
+			q = dcrec_put32(q, dirlen + 1 + rec->newlen);
+			memcpy(q, rec->dir, dirlen);
+			q += dirlen;
+			*q++ = '/';
+			memcpy(q, rec->newname, rec->newlen);
+			q += rec->newlen;
+		} else {
+			q = dcrec_put32(q, 0);
+		}
+		dcrec_put32(buf, q - buf - 4);
+		return (q - buf);
+	}
+	q += sprintf(q, "{\"path\":\"");
+	q = dcrec_jstr(q, rec->dir, dirlen);
+	*q++ = '/';
+	q = dcrec_jstr(q, rec->name, rec->namelen);
+	q += sprintf(q, "\",\"class\":\"%s\",\"type\":\"%s\",\"ino\":%ju",
+	    dcrec_class(rec->nc), dcrec_type(rec->type),
+	    (uintmax_t)rec->ino);
+	if (rec->newname != NULL) {
+		q += sprintf(q, ",\"new\":\"");
+		q = dcrec_jstr(q, rec->dir, dirlen);
+		*q++ = '/';
+		q = dcrec_jstr(q, rec->newname, rec->newlen);
+		*q++ = '"';
+	}
+	q += sprintf(q, ",\"result\":\"%s\"", dcrec_results[rec->result]);
+	if (rec->err != 0)
+		q += sprintf(q, ",\"errno\":%d,\"error\":\"%s\"",
+		    rec->err, strerror(rec->err));
+	*q++ = '}';
+	*q++ = '\n';
+	return (q - buf);
+}
@@ -0,0 +1,65 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef DCREC_H_INCLUDED
+#define DCREC_H_INCLUDED
+
+#include "conv-tools.h"
+
+/*
+ * Structured output records, as JSON Lines or in a binary format with
+ * explicit lengths, for tools which can not safely parse the text
+ * output.  See dirconv(1) for both formats.
+ */
+enum dcrec_result {
+	dcrec_none,			/* no rename proposed */
+	dcrec_dryrun,			/* would have been renamed */
+	dcrec_renamed,			/* renamed */
+	dcrec_planned,			/* written to the plan */
+	dcrec_collision,		/* target exists */
+	dcrec_failed,			/* conversion or rename failed */
+};
+
+struct dcrec {
+	const char *dir;		/* directory */
+	const char *name;		/* name */
+	size_t namelen;
+	const char *newname;		/* converted name, or NULL */
+	size_t newlen;
+	uint64_t ino;			/* inode number */
+	unsigned int type;		/* DT_* */
+	cv_nameclass nc;		/* name class */
+	enum dcrec_result result;
+	int err;			/* errno value if failed */
+};
+
+size_t dcrec_max(const struct dcrec *, int);
+size_t dcrec_put(char *, const struct dcrec *, int);
+
+#endif
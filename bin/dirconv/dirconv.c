@@ -32,128 +32,1733 @@
 #endif
 
 #include <sys/param.h>
+#include <sys/resource.h>
 #include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
 
 #include <dirent.h>
 #include <err.h>
 #include <errno.h>
-#include <iconv.h>
-#include <regex.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <unistd.h>
 
 #include "conv-tools.h"
+#include "dccache.h"
+#include "dcexcl.h"
+#include "dcfs.h"
+#include "dcnset.h"
+#include "dcops.h"
+#include "dcplan.h"
+#include "dcrec.h"
+
+/*
+ * On Linux, read directories in large batches with getdents64(2), which
+ * glibc only recently started exposing.  Elsewhere, use readdir(3).
+ */
+#if defined(__linux__) && defined(SYS_getdents64)
+#define DC_GETDENTS 1
+#define DC_DBUFSIZE (256 * 1024)
+
+struct dc_dirent64 {
+	uint64_t d_ino;
+	int64_t d_off;
+	unsigned short d_reclen;
+	unsigned char d_type;
+	char d_name[];
+};
+#endif
 
-static iconv_t fwdconv, revconv;
 static int errcnt;
 
-static const char *enc8 =
-    "iso8859-1";		/* presumed 8-bit encoding */
+static const char *enc8 =
+    "iso8859-1";		/* presumed 8-bit encoding */
+
+static int opt_0;		/* use '\0' as separator */
+static int opt_7;		/* print 7-bit names */
+static int opt_8;		/* print 8-bit non-UTF names */
+static const char *opt_A;	/* apply plan */
+static const char *opt_C;	/* scan cache */
+static int opt_d;		/* debug */
+static int opt_F;		/* force rename */
+static int opt_J;		/* structured records, 2 = binary */
+static unsigned int opt_j = 1;	/* number of threads */
+static int opt_k;		/* add a suffix instead of colliding */
+static int opt_N;		/* print non-NFC names */
+static int opt_n;		/* dry run (with -r) */
+static const char *opt_P;	/* write plan */
+static int opt_p;		/* print names */
+static unsigned int opt_q = 1;	/* metadata queue depth */
+static int opt_r;		/* rename non-UTF files */
+static int opt_S;		/* sort output */
+static const char *opt_T;	/* file system types to descend into */
+static int opt_s;		/* print statistics */
+static int opt_t;		/* undocumented test mode */
+static int opt_u;		/* print UTF names */
+static int opt_w;		/* print WTF names */
+static int opt_X;		/* stay on one file system */
+static int opt_x;		/* exclusion patterns */
+
+#define debug(lvl, ...) \
+	do { if (opt_d >= lvl) fprintf(stderr, __VA_ARGS__); } while (0)
+
+static const char *
+ncname(cv_nameclass nc)
+{
+
+	switch (nc) {
+	case CV_NC_ASCII:
+		return ("ASCII");
+	case CV_NC_UTF8:
+		return ("UTF-8");
+	case CV_NC_WTF8:
+		return ("WTF-8");
+	case CV_NC_NFD:
+		return ("non-NFC UTF-8");
+	default:
+		return ("non-UTF 8-bit encoding");
+	}
+}
+
+/*
+ * Resize a buffer so it will fit at least len characters plus a
+ * terminating NUL, with a minimum allocation of 64 bytes.
+ */
+static char *
+growbuf(char **buf, size_t *size, int len)
+{
+	char *tmpbuf;
+	size_t tmpsize;
+
+	tmpbuf = *buf;
+	tmpsize = *size;
+	if (tmpsize < 64)
+		tmpsize = 64;
+	while ((size_t)(len + 1) >= tmpsize)
+		tmpsize *= 2;
+	if ((tmpbuf = realloc(tmpbuf, tmpsize)) == NULL)
+		return (NULL);
+	*buf = tmpbuf;
+	*size = tmpsize;
+	return (*buf);
+}
+
+/*
+ * Work queue.
+ *
+ * Each directory is a unit of work.  Every thread has its own
+ * double-ended queue of directories.  The owner pushes and pops at the
+ * tail, so it works its way depth-first through its part of the tree,
+ * while idle threads steal from the head, which tends to give them the
+ * larger subtrees.  The subdirectories of a directory are only queued
+ * once every entry in it has been processed, so renames are complete
+ * before anyone descends.
+ *
+ * Directories are opened relative to their parent's file descriptor,
+ * and all operations on their entries are relative to their own, so the
+ * kernel never has to look up a full path.  A directory's descriptor is
+ * kept open for the benefit of its subdirectories, for as long as any of
+ * them are alive, as long as the number of descriptors kept open stays
+ * within a budget.  Beyond that, directories are closed once they have
+ * been processed, and their subdirectories are opened relative to the
+ * nearest ancestor which is still open.
+ */
+struct dcnode {
+	struct dcnode *parent;		/* parent directory */
+	int fd;				/* kept open for subdirectories */
+	unsigned int refs;		/* self plus live subdirectories */
+	dev_t dev;			/* device, once opened */
+	size_t namelen;			/* length of name */
+	char name[];			/* name, or full path for a root */
+};
+
+/*
+ * Directory nodes are carved out of per-thread slabs, with a free list
+ * for each size class, so that once the traversal has reached its
+ * steady state, it no longer calls malloc(3) for every subdirectory.  A
+ * node is put on the free list of whichever thread releases it, not
+ * necessarily the one which allocated it; the slabs themselves are only
+ * released at the end of the run.  Nodes too large for any size class,
+ * which in practice means roots, are allocated individually.
+ */
+#define DCN_ALIGN	16
+#define DCN_NCLASS \
+	(roundup(sizeof(struct dcnode) + NAME_MAX + 1, DCN_ALIGN) / DCN_ALIGN)
+#define DCN_SLAB	(64 * 1024)
+
+struct dcdeque {
+	pthread_mutex_t lock;
+	struct dcnode **items;
+	size_t head, tail, size;
+};
+
+/*
+ * Directory entries are processed in batches, so that the metadata
+ * operations for a whole batch can be in flight at the same time.  When
+ * renaming, the whole directory is one batch, so that every new name
+ * can be checked against every name in the directory before any of them
+ * is renamed.
+ */
+#define DC_BATCH 1024
+
+struct dcent {
+	size_t name, namelen;		/* offset and length in names */
+	size_t utf, utflen;		/* offset and length in utfnames */
+	unsigned char type;		/* DT_* */
+	uint64_t ino;			/* inode number */
+	cv_nameclass nc;		/* classification */
+	int flags;
+	int err;			/* why the rename failed */
+	mode_t mode;			/* from lstat, if DCE_STAT */
+};
+
+#define DCE_SKIP	0x0001		/* could not be examined */
+#define DCE_STAT	0x0002		/* needs or has lstat */
+#define DCE_SELECTED	0x0004		/* selected for printing */
+#define DCE_RENAME	0x0008		/* to be renamed */
+#define DCE_RENAMED	0x0010		/* successfully renamed */
+#define DCE_PROPOSED	0x0020		/* rename proposed */
+#define DCE_COLLIDED	0x0040		/* rename target exists */
+#define DCE_PLANNED	0x0080		/* rename written to the plan */
+
+/*
+ * Per-thread statistics, summed at the end of the run.  The counters are
+ * always maintained, since that costs next to nothing; the clock is only
+ * read if statistics were requested.
+ */
+struct dcstats {
+	uintmax_t dirs;			/* directories visited */
+	uintmax_t cached;		/* of which skipped thanks to -C */
+	uintmax_t repeated;		/* directories already visited */
+	uintmax_t mounts;		/* mount points not descended into */
+	uintmax_t entries;		/* entries inspected */
+	uintmax_t nc[5];		/* by cv_nameclass, CV_NC_8BIT first */
+	uintmax_t renames;		/* renames attempted */
+	uintmax_t renfail;		/* renames which failed */
+	uintmax_t rencoll;		/* renames skipped due to collisions */
+	uintmax_t planned;		/* renames written to the plan */
+	uintmax_t det[CV_MAXCAND];	/* names detected per candidate */
+	uintmax_t detconf[CV_MAXCAND];	/* confidence summed per candidate */
+	cv_phase readdir, stat, classify, rename;
+};
+
+/*
+ * Per-thread state.  Output is accumulated per directory and written in
+ * one go; with -S, it is kept until the end and sorted.
+ */
+struct dcworker {
+	pthread_t thr;
+	unsigned int id;
+	cv_ctx *ctx;			/* conversion context */
+	struct dcdeque dq;		/* work queue */
+	struct dcnode **kids;		/* subdirectories to queue */
+	size_t nkids, kidsize;
+	struct dcnode *dnfree[DCN_NCLASS]; /* free nodes by size class */
+	char *slab;			/* current slab of nodes */
+	size_t slabpos;
+	const struct dcnode *pathdn;	/* directory in pathbuf */
+	char *pathbuf;			/* path to current directory */
+	size_t pathsize;
+	char *out;			/* output buffer */
+	size_t outlen, outsize;
+	size_t *recs;			/* start of each record (-S) */
+	size_t nrecs, recsize;
+#ifdef DC_GETDENTS
+	int dfd;			/* directory being read */
+	char *dbuf;			/* directory entry buffer */
+	size_t dpos, dlen;
+#else
+	DIR *dir;			/* directory being read */
+#endif
+	struct dcent *ents;		/* current batch of entries */
+	size_t nents, entsize;
+	char *names;			/* names of entries in the batch */
+	size_t nameslen, namessize;
+	char *utfnames;			/* converted names */
+	size_t utflen, utfsize;
+	struct dcop *op;		/* metadata operations */
+	struct dcops *ops;
+	struct dcnset nset;		/* names in the directory (-r) */
+	struct dclog *log;
+	int dirty;
+	struct dcplog *plan;
+	int planned;
+	struct dcxdir xdir;		/* for the exclusion filter */
+	struct dcstats stats;
+	cv_clock clk;
+	int errcnt;
+};
+
+static struct dcworker *workers;
+static unsigned int nworkers;
+
+static pthread_mutex_t wq_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t wq_cond = PTHREAD_COND_INITIALIZER;
+static size_t wq_pending;		/* queued or in progress */
+static unsigned long wq_gen;		/* incremented on every push */
+static unsigned int wq_idle;		/* threads waiting for work */
+
+static unsigned int fd_budget;		/* max directories kept open */
+static unsigned int fd_kept;		/* directories kept open */
+
+/*
+ * Each thread accumulates output in its own buffer, which is written out
+ * once it holds at least this much, or after every directory if the
+ * output is a terminal.
+ */
+#define DC_OUTFLUSH (256 * 1024)
+
+static pthread_mutex_t out_lock = PTHREAD_MUTEX_INITIALIZER;
+static size_t out_flush = DC_OUTFLUSH;
+
+static struct dcnode *
+dcnode_new(struct dcworker *w, struct dcnode *parent, const char *name,
+    size_t len)
+{
+	struct dcnode *dn;
+	char *slab;
+	size_t size, cls;
+
+	size = roundup(sizeof *dn + len + 1, DCN_ALIGN);
+	cls = size / DCN_ALIGN - 1;
+	if (cls >= DCN_NCLASS) {
+		if ((dn = malloc(size)) == NULL)
+			err(1, "malloc()");
+	} else if ((dn = w->dnfree[cls]) != NULL) {
+		w->dnfree[cls] = dn->parent;
+	} else {
+		/* the first few bytes of each slab link to the previous one */
+		if (w->slab == NULL || w->slabpos + size > DCN_SLAB) {
+			if ((slab = malloc(DCN_SLAB)) == NULL)
+				err(1, "malloc()");
+			*(char **)slab = w->slab;
+			w->slab = slab;
+			w->slabpos = DCN_ALIGN;
+		}
+		dn = (struct dcnode *)(w->slab + w->slabpos);
+		w->slabpos += size;
+	}
+	dn->parent = parent;
+	dn->fd = -1;
+	dn->refs = 1;
+	memcpy(dn->name, name, len);
+	dn->name[len] = '\0';
+	dn->namelen = len;
+	if (parent != NULL)
+		parent->refs++;
+	return (dn);
+}
+
+/*
+ * Push a batch of directories onto the tail of a queue, last one first,
+ * so that they are popped in the order in which they were found.
+ */
+static void
+dq_push(struct dcdeque *dq, struct dcnode **items, size_t n)
+{
+	struct dcnode **tmp;
+	size_t size;
+
+	pthread_mutex_lock(&dq->lock);
+	if (dq->tail + n > dq->size && dq->head > 0) {
+		memmove(dq->items, dq->items + dq->head,
+		    (dq->tail - dq->head) * sizeof *dq->items);
+		dq->tail -= dq->head;
+		dq->head = 0;
+	}
+	if (dq->tail + n > dq->size) {
+		for (size = dq->size ? dq->size : 64; dq->tail + n > size; )
+			size *= 2;
+		if ((tmp = realloc(dq->items, size * sizeof *tmp)) == NULL)
+			err(1, "realloc()");
+		dq->items = tmp;
+		dq->size = size;
+	}
+	while (n > 0)
+		dq->items[dq->tail++] = items[--n];
+	pthread_mutex_unlock(&dq->lock);
+}
+
+static struct dcnode *
+dq_pop(struct dcdeque *dq)
+{
+	struct dcnode *dn;
+
+	pthread_mutex_lock(&dq->lock);
+	dn = dq->tail > dq->head ? dq->items[--dq->tail] : NULL;
+	if (dq->tail == dq->head)
+		dq->head = dq->tail = 0;
+	pthread_mutex_unlock(&dq->lock);
+	return (dn);
+}
+
+static struct dcnode *
+dq_steal(struct dcdeque *dq)
+{
+	struct dcnode *dn;
+
+	pthread_mutex_lock(&dq->lock);
+	dn = dq->tail > dq->head ? dq->items[dq->head++] : NULL;
+	if (dq->tail == dq->head)
+		dq->head = dq->tail = 0;
+	pthread_mutex_unlock(&dq->lock);
+	return (dn);
+}
+
+/*
+ * Queue the subdirectories found in the current directory and wake up
+ * any idle threads.
+ */
+static void
+wq_add(struct dcworker *w, struct dcnode **items, size_t n)
+{
+
+	if (n == 0)
+		return;
+	dq_push(&w->dq, items, n);
+	pthread_mutex_lock(&wq_lock);
+	wq_pending += n;
+	++wq_gen;
+	if (wq_idle > 0)
+		pthread_cond_broadcast(&wq_cond);
+	pthread_mutex_unlock(&wq_lock);
+}
+
+/*
+ * Mark a directory as done.  When the last one is done, wake up all
+ * idle threads so they can exit.
+ */
+static void
+wq_done(void)
+{
+
+	pthread_mutex_lock(&wq_lock);
+	if (--wq_pending == 0)
+		pthread_cond_broadcast(&wq_cond);
+	pthread_mutex_unlock(&wq_lock);
+}
+
+/*
+ * Get the next directory to process: from our own queue if possible,
+ * otherwise from someone else's.  If there is nothing to steal, wait
+ * until either something is pushed or everything is done.
+ */
+static struct dcnode *
+wq_get(struct dcworker *w)
+{
+	struct dcnode *dn;
+	unsigned long gen;
+	unsigned int i;
+
+	for (;;) {
+		if ((dn = dq_pop(&w->dq)) != NULL)
+			return (dn);
+		pthread_mutex_lock(&wq_lock);
+		gen = wq_gen;
+		pthread_mutex_unlock(&wq_lock);
+		for (i = 1; i < nworkers; ++i)
+			if ((dn = dq_steal(
+			    &workers[(w->id + i) % nworkers].dq)) != NULL)
+				return (dn);
+		pthread_mutex_lock(&wq_lock);
+		if (wq_pending == 0) {
+			pthread_mutex_unlock(&wq_lock);
+			return (NULL);
+		}
+		if (wq_gen == gen) {
+			++wq_idle;
+			pthread_cond_wait(&wq_cond, &wq_lock);
+			--wq_idle;
+		}
+		pthread_mutex_unlock(&wq_lock);
+	}
+}
+
+/*
+ * Write to standard output, bypassing stdio.
+ */
+static void
+dcwrite(const char *p, size_t len)
+{
+	ssize_t wlen;
+
+	while (len > 0) {
+		if ((wlen = write(STDOUT_FILENO, p, len)) < 0) {
+			if (errno == EINTR)
+				continue;
+			err(1, "stdout");
+		}
+		p += wlen;
+		len -= wlen;
+	}
+}
+
+/*
+ * Note the start of a record in the output buffer, if it is to be
+ * sorted.
+ */
+static void
+dcrecmark(struct dcworker *w)
+{
+	size_t *tmp;
+
+	if (w->nrecs == w->recsize) {
+		w->recsize = w->recsize ? w->recsize * 2 : 64;
+		if ((tmp = realloc(w->recs, w->recsize * sizeof *tmp)) == NULL)
+			err(1, "realloc()");
+		w->recs = tmp;
+	}
+	w->recs[w->nrecs++] = w->outlen;
+}
+
+/*
+ * Append a record to the output buffer.
+ */
+static void
+dcprintf(struct dcworker *w, const char *fmt, ...)
+{
+	va_list ap;
+	int len;
+
+	va_start(ap, fmt);
+	len = vsnprintf(w->out + w->outlen, w->outsize - w->outlen, fmt, ap);
+	va_end(ap);
+	if (len < 0)
+		err(1, "vsnprintf()");
+	if (w->outlen + len >= w->outsize) {
+		if (!growbuf(&w->out, &w->outsize, w->outlen + len))
+			err(1, "realloc()");
+		va_start(ap, fmt);
+		vsnprintf(w->out + w->outlen, w->outsize - w->outlen, fmt, ap);
+		va_end(ap);
+	}
+	if (opt_S)
+		dcrecmark(w);
+	w->outlen += len;
+}
+
+/*
+ * Append a structured record to the output buffer.
+ */
+static void
+dcrecord(struct dcworker *w, const struct dcrec *rec)
+{
+
+	if (!growbuf(&w->out, &w->outsize,
+	    w->outlen + dcrec_max(rec, opt_J > 1)))
+		err(1, "realloc()");
+	if (opt_S)
+		dcrecmark(w);
+	w->outlen += dcrec_put(w->out + w->outlen, rec, opt_J > 1);
+}
+
+/*
+ * Write out the output that has accumulated, unless it is to be sorted,
+ * once there is enough of it to be worth a system call, or if forced.
+ */
+static void
+dcflush(struct dcworker *w, int force)
+{
+
+	if (opt_S || w->outlen == 0 || (!force && w->outlen < out_flush))
+		return;
+	pthread_mutex_lock(&out_lock);
+	dcwrite(w->out, w->outlen);
+	pthread_mutex_unlock(&out_lock);
+	w->outlen = 0;
+}
+
+/*
+ * Drop a reference to a directory.  Once nothing refers to it any more,
+ * close it if it was kept open and drop its reference to its parent.
+ */
+static void
+dcnode_release(struct dcworker *w, struct dcnode *dn)
+{
+	struct dcnode *parent, *list;
+	size_t cls;
+
+	pthread_mutex_lock(&wq_lock);
+	for (list = NULL; dn != NULL && --dn->refs == 0; dn = parent) {
+		parent = dn->parent;
+		dn->parent = list;
+		list = dn;
+		if (dn->fd >= 0)
+			--fd_kept;
+	}
+	pthread_mutex_unlock(&wq_lock);
+	for (dn = list; dn != NULL; dn = list) {
+		list = dn->parent;
+		if (dn->fd >= 0)
+			close(dn->fd);
+		cls = roundup(sizeof *dn + dn->namelen + 1, DCN_ALIGN) /
+		    DCN_ALIGN - 1;
+		if (cls >= DCN_NCLASS) {
+			free(dn);
+		} else {
+			dn->parent = w->dnfree[cls];
+			w->dnfree[cls] = dn;
+		}
+	}
+}
+
+/*
+ * Decide whether to keep a directory open for its subdirectories.
+ */
+static int
+dcnode_keep(void)
+{
+	int keep;
+
+	pthread_mutex_lock(&wq_lock);
+	if ((keep = fd_kept < fd_budget))
+		++fd_kept;
+	pthread_mutex_unlock(&wq_lock);
+	return (keep);
+}
+
+/*
+ * Return the full path to a directory, for use in messages.  The path is
+ * built by walking up the tree, and cached until the next directory.
+ * Preserves errno, so it can be used in the arguments to warn().
+ */
+static const char *
+dcpath(struct dcworker *w, const struct dcnode *dn)
+{
+	const struct dcnode *p;
+	size_t len;
+	int serrno;
+
+	if (w->pathdn == dn)
+		return (w->pathbuf);
+	serrno = errno;
+	for (p = dn, len = dn->namelen; (p = p->parent) != NULL; )
+		len += p->namelen + 1;
+	if (!growbuf(&w->pathbuf, &w->pathsize, len))
+		err(1, "realloc()");
+	w->pathbuf[len] = '\0';
+	for (p = dn; ; w->pathbuf[--len] = '/') {
+		len -= p->namelen;
+		memcpy(w->pathbuf + len, p->name, p->namelen);
+		if ((p = p->parent) == NULL)
+			break;
+	}
+	w->pathdn = dn;
+	errno = serrno;
+	return (w->pathbuf);
+}
+
+/*
+ * Open a directory relative to the nearest ancestor which is still open,
+ * or by its full path if there is none.  The ancestors can't go away
+ * while we hold a reference to their descendant.
+ */
+static int
+dcopen(struct dcworker *w, const struct dcnode *dn)
+{
+	const struct dcnode *p;
+	size_t len;
+	int fd;
+
+	for (p = dn->parent, len = dn->namelen; p != NULL && p->fd < 0;
+	     p = p->parent)
+		len += p->namelen + 1;
+	if (p == NULL)
+		return (open(dcpath(w, dn), O_RDONLY | O_DIRECTORY));
+	if (p == dn->parent)
+		return (openat(p->fd, dn->name,
+		    O_RDONLY | O_DIRECTORY | O_NOFOLLOW));
+	/* the path in pathbuf ends with the part we need */
+	dcpath(w, dn);
+	fd = openat(p->fd, w->pathbuf + strlen(w->pathbuf) - len,
+	    O_RDONLY | O_DIRECTORY | O_NOFOLLOW);
+	return (fd);
+}
+
+/*
+ * Directory reader.  Returns 1 and fills in the name and type of the next
+ * entry, 0 at the end of the directory, or -1 on error.  The type is
+ * DT_UNKNOWN if the file system did not provide one.
+ */
+#ifndef DT_UNKNOWN
+#define DT_UNKNOWN 0
+#endif
+
+struct dcentry {
+	const char *name;
+	size_t namelen;
+	unsigned char type;
+	uint64_t ino;
+};
+
+#ifdef DC_GETDENTS
+static int
+dcread_open(struct dcworker *w, int fd)
+{
+
+	if (w->dbuf == NULL && (w->dbuf = malloc(DC_DBUFSIZE)) == NULL)
+		err(1, "malloc()");
+	w->dfd = fd;
+	w->dpos = w->dlen = 0;
+	return (0);
+}
+
+static int
+dcread(struct dcworker *w, struct dcentry *de)
+{
+	struct dc_dirent64 *d;
+	long len;
+
+	if (w->dpos >= w->dlen) {
+		if ((len = syscall(SYS_getdents64, w->dfd,
+		    w->dbuf, DC_DBUFSIZE)) <= 0)
+			return (len < 0 ? -1 : 0);
+		w->dpos = 0;
+		w->dlen = len;
+	}
+	d = (struct dc_dirent64 *)(w->dbuf + w->dpos);
+	w->dpos += d->d_reclen;
+	de->name = d->d_name;
+	de->namelen = strlen(d->d_name);
+	de->type = d->d_type;
+	de->ino = d->d_ino;
+	return (1);
+}
+
+static void
+dcread_close(struct dcworker *w)
+{
+
+	w->dfd = -1;
+}
+#else
+static int
+dcread_open(struct dcworker *w, int fd)
+{
+	int dupfd;
+
+	/* the descriptor may outlive the DIR, so give it a copy */
+	if ((dupfd = dup(fd)) < 0)
+		return (-1);
+	if ((w->dir = fdopendir(dupfd)) == NULL) {
+		close(dupfd);
+		return (-1);
+	}
+	return (0);
+}
+
+static int
+dcread(struct dcworker *w, struct dcentry *de)
+{
+	struct dirent *ent;
+
+	/*
+	 * Why I Hate Unix, #237846: the only way to tell whether
+	 * readdir(3) failed or just hit the end is to clear errno before
+	 * calling it and inspect it afterwards.
+	 */
+	errno = 0;
+	if ((ent = readdir(w->dir)) == NULL)
+		return (errno != 0 ? -1 : 0);
+	de->name = ent->d_name;
+	de->namelen = strlen(ent->d_name);
+#ifdef DT_DIR
+	de->type = ent->d_type;
+#else
+	de->type = DT_UNKNOWN;
+#endif
+	de->ino = ent->d_ino;
+	return (1);
+}
+
+static void
+dcread_close(struct dcworker *w)
+{
+
+	closedir(w->dir);
+	w->dir = NULL;
+}
+#endif
+
+/*
+ * Add a subdirectory to the list of those found in the current directory.
+ */
+static void
+dckid(struct dcworker *w, struct dcnode *dn, const char *name, size_t len)
+{
+	struct dcnode **tmp;
+
+	if (w->nkids == w->kidsize) {
+		w->kidsize = w->kidsize ? w->kidsize * 2 : 64;
+		if ((tmp = realloc(w->kids, w->kidsize * sizeof *tmp)) == NULL)
+			err(1, "realloc()");
+		w->kids = tmp;
+	}
+	w->kids[w->nkids++] = dcnode_new(w, dn, name, len);
+}
+
+/*
+ * Add an entry to the current batch.
+ */
+static void
+dcent_add(struct dcworker *w, const struct dcentry *de)
+{
+	struct dcent *e;
+	void *tmp;
+
+	if (w->nents == w->entsize) {
+		w->entsize = w->entsize ? w->entsize * 2 : DC_BATCH;
+		if ((tmp = realloc(w->ents,
+		    w->entsize * sizeof *w->ents)) == NULL)
+			err(1, "realloc()");
+		w->ents = tmp;
+		if ((tmp = realloc(w->op, w->entsize * sizeof *w->op)) == NULL)
+			err(1, "realloc()");
+		w->op = tmp;
+	}
+	if (!growbuf(&w->names, &w->namessize, w->nameslen + de->namelen))
+		err(1, "realloc()");
+	e = &w->ents[w->nents++];
+	w->stats.entries++;
+	e->name = w->nameslen;
+	e->namelen = de->namelen;
+	memcpy(w->names + w->nameslen, de->name, de->namelen + 1);
+	w->nameslen += de->namelen + 1;
+	e->type = de->type;
+	e->ino = de->ino;
+	e->flags = 0;
+	e->err = 0;
+}
+
+/*
+ * Return the type of an entry, as reported by readdir() or lstat().
+ */
+static unsigned int
+dctype(const struct dcent *e)
+{
+
+	if (!(e->flags & DCE_STAT))
+		return (e->type);
+	if (S_ISDIR(e->mode))
+		return (DT_DIR);
+	if (S_ISREG(e->mode))
+		return (DT_REG);
+	if (S_ISLNK(e->mode))
+		return (DT_LNK);
+	return (DT_UNKNOWN);
+}
+
+/*
+ * Sort rename candidates by their current names, so that it does not
+ * depend on the order in which the directory was read which of several
+ * entries that convert to the same name gets it.
+ */
+struct dctarget {
+	const char *name;
+	struct dcent *e;
+};
+
+static int
+targetcmp(const void *a, const void *b)
+{
+	const struct dctarget *x = a, *y = b;
+
+	return (strcmp(x->name, y->name));
+}
+
+/*
+ * Give an entry the first free name of the form "name~N.ext", where ext
+ * is whatever follows the last period, if any, other than a leading one.
+ */
+static int
+dcsuffix(struct dcworker *w, struct dcent *e)
+{
+	const char *dot;
+	char *name;
+	size_t base, len, max;
+	unsigned long n;
+
+	max = e->utflen + 24;
+	if (!growbuf(&w->utfnames, &w->utfsize, w->utflen + max))
+		err(1, "realloc()");
+	name = w->utfnames + e->utf;
+	dot = memrchr(name + 1, '.', e->utflen - 1);
+	base = dot != NULL ? (size_t)(dot - name) : e->utflen;
+	for (n = 1; n < 1000000; ++n) {
+		len = snprintf(w->utfnames + w->utflen, max, "%.*s~%lu%s",
+		    (int)base, name, n, name + base);
+		if (dcnset_add(&w->nset, w->utfnames + w->utflen, len,
+		    DCN_CLAIMED) == 0) {
+			debug(1, "suffix %s -> %s\n", name,
+			    w->utfnames + w->utflen);
+			e->utf = w->utflen;
+			e->utflen = len;
+			w->utflen += len + 1;
+			return (0);
+		}
+	}
+	return (-1);
+}
+
+/*
+ * Check the new names against the names in the directory and against
+ * each other.  Unless -F was specified, a name which is already taken
+ * causes the rename to be skipped, or with -k, to be given a suffix.
+ * With -F, existing names are overwritten, but several entries which
+ * convert to the same name are still treated as a collision, since the
+ * renames are not performed in any particular order.
+ */
+static void
+dcbatch_resolve(struct dcworker *w, const char *path)
+{
+	struct dctarget *t;
+	struct dcent *e;
+	size_t i, n;
+	int tag;
+
+	for (i = n = 0; i < w->nents; ++i)
+		n += (w->ents[i].flags & (DCE_RENAME | DCE_SKIP)) ==
+		    DCE_RENAME && w->ents[i].utflen != (size_t)-1;
+	if (n == 0)
+		return;
+	if ((t = calloc(n, sizeof *t)) == NULL)
+		err(1, "calloc()");
+	for (i = n = 0; i < w->nents; ++i) {
+		e = &w->ents[i];
+		if ((e->flags & (DCE_RENAME | DCE_SKIP)) == DCE_RENAME &&
+		    e->utflen != (size_t)-1) {
+			t[n].name = w->names + e->name;
+			t[n++].e = e;
+		}
+	}
+	qsort(t, n, sizeof *t, targetcmp);
+	for (i = 0; i < n; ++i) {
+		e = t[i].e;
+		tag = dcnset_add(&w->nset, w->utfnames + e->utf, e->utflen,
+		    DCN_CLAIMED);
+		if (tag == 0 || (tag == DCN_EXISTS && opt_F))
+			continue;
+		if (opt_k && dcsuffix(w, e) == 0)
+			continue;
+		e->flags &= ~DCE_RENAME;
+		e->flags |= DCE_COLLIDED;
+		errno = EEXIST;
+		warn("%s/%s", path, w->utfnames + e->utf);
+		++w->errcnt;
+		w->stats.rencoll++;
+	}
+	free(t);
+}
+
+/*
+ * Emit a structured record for each entry in the batch that would have
+ * been printed, with the outcome of the rename if one was proposed.
+ */
+static void
+dcbatch_records(struct dcworker *w, struct dcnode *dn)
+{
+	struct dcrec rec;
+	struct dcent *e;
+	size_t i;
+
+	rec.dir = dcpath(w, dn);
+	for (i = 0; i < w->nents; ++i) {
+		e = &w->ents[i];
+		if ((e->flags & DCE_SKIP) ||
+		    !((opt_p && (e->flags & DCE_SELECTED)) ||
+		    (e->flags & DCE_PROPOSED)))
+			continue;
+		rec.name = w->names + e->name;
+		rec.namelen = e->namelen;
+		rec.newname = NULL;
+		rec.newlen = 0;
+		rec.ino = e->ino;
+		rec.type = dctype(e);
+		rec.nc = e->nc;
+		rec.err = e->err;
+		if (!(e->flags & DCE_PROPOSED))
+			rec.result = dcrec_none;
+		else if (e->err != 0)
+			rec.result = dcrec_failed;
+		else if (e->flags & DCE_COLLIDED)
+			rec.result = dcrec_collision;
+		else if (opt_n)
+			rec.result = dcrec_dryrun;
+		else if (e->flags & DCE_RENAMED)
+			rec.result = dcrec_renamed;
+		else if (e->flags & DCE_PLANNED)
+			rec.result = dcrec_planned;
+		else
+			rec.result = dcrec_none;
+		if ((e->flags & DCE_PROPOSED) && e->err != EILSEQ) {
+			rec.newname = w->utfnames + e->utf;
+			rec.newlen = e->utflen;
+		}
+		dcrecord(w, &rec);
+	}
+}
+
+/*
+ * Process a batch of entries from a directory.
+ *
+ * First, lstat the entries whose type we don't know, and those which we
+ * are going to rename.  Next, check the converted names against the
+ * names in the directory, print them, and finally rename.  The
+ * operations in each of these stages are carried out concurrently.
+ */
+static void
+dcbatch(struct dcworker *w, struct dcnode *dn, int dfd,
+    const struct stat *dst)
+{
+	struct dcent *e;
+	struct dcop *op;
+	const char *name, *path;
+	unsigned int conf;
+	size_t i, n;
+	int det, renaming;
+
+	/* classify, select, and decide what needs to be looked at */
+	if (opt_s)
+		cv_clock_lap(&w->clk, &w->stats.readdir);
+	renaming = opt_r && !opt_n;
+	w->utflen = 0;
+	for (i = n = 0; i < w->nents; ++i) {
+		e = &w->ents[i];
+		name = w->names + e->name;
+		if (opt_r) {
+			/* classify and convert in one go */
+			if (!growbuf(&w->utfnames, &w->utfsize,
+			    w->utflen + 3 * e->namelen))
+				err(1, "realloc()");
+			e->nc = cv_fix(w->ctx, name, e->namelen,
+			    w->utfnames + w->utflen, &e->utflen);
+			e->utf = w->utflen;
+			if (e->utflen != 0 && e->utflen != (size_t)-1)
+				w->utflen += e->utflen + 1;
+			if ((det = cv_detected(w->ctx, &conf)) >= 0) {
+				w->stats.det[det]++;
+				w->stats.detconf[det] += conf;
+				debug(2, "detect %s: %s (%u%%)\n", name,
+				    cv_candidate(w->ctx, det), conf);
+			}
+		} else {
+			e->nc = cv_classify_wtf(w->ctx, name, e->namelen);
+		}
+		w->stats.nc[e->nc - CV_NC_8BIT]++;
+		debug(2, "classify %s: %s\n", name, ncname(e->nc));
+		if ((e->nc == CV_NC_ASCII && opt_7) ||
+		    (e->nc == CV_NC_8BIT && opt_8) ||
+		    (e->nc == CV_NC_UTF8 && opt_u) ||
+		    (e->nc == CV_NC_WTF8 && opt_w) ||
+		    (e->nc == CV_NC_NFD && opt_N)) {
+			e->flags |= DCE_SELECTED;
+			w->dirty = 1;
+		}
+		if (opt_r && (e->flags & DCE_SELECTED) &&
+		    (e->nc == CV_NC_8BIT || e->nc == CV_NC_WTF8 ||
+		    e->nc == CV_NC_NFD))
+			e->flags |= DCE_RENAME | DCE_PROPOSED;
+		/* d_type is not always available, so stat if unknown */
+		if (e->type == DT_UNKNOWN ||
+		    (renaming && (e->flags & DCE_RENAME))) {
+			e->flags |= DCE_STAT;
+			op = &w->op[n++];
+			op->kind = dcop_stat;
+			op->dfd = dfd;
+			op->name = name;
+			op->ent = i;
+		}
+	}
+	if (opt_s)
+		cv_clock_lap(&w->clk, &w->stats.classify);
+	dcops_run(w->ops, w->op, n);
+	for (i = 0; i < n; ++i) {
+		op = &w->op[i];
+		e = &w->ents[op->ent];
+		if (op->res != 0) {
+			errno = op->res;
+			warn("lstat(%s/%s)", dcpath(w, dn), op->name);
+			++w->errcnt;
+			e->flags |= DCE_SKIP;
+		} else {
+			e->mode = op->mode;
+		}
+	}
+
+	/* check whether the converted names are taken */
+	if (opt_s)
+		cv_clock_lap(&w->clk, &w->stats.stat);
+	if (opt_r)
+		dcbatch_resolve(w, dcpath(w, dn));
+
+	/* print */
+	for (i = 0; i < w->nents; ++i) {
+		e = &w->ents[i];
+		if (e->flags & DCE_SKIP)
+			continue;
+		name = w->names + e->name;
+		if (opt_p && !opt_J && (e->flags & DCE_SELECTED))
+			dcprintf(w, "%s/%s%c", dcpath(w, dn), name,
+			    opt_0 ? '\0' : '\n');
+		if (!(e->flags & DCE_RENAME))
+			continue;
+		if (e->utflen == (size_t)-1) {
+			errno = e->err = EILSEQ;
+			warn("iconv(%s) failed", name);
+			++w->errcnt;
+			e->flags &= ~DCE_RENAME;
+			continue;
+		}
+		path = dcpath(w, dn);
+		if (!opt_J)
+			dcprintf(w, "%s/%s -> %s/%s\n",
+			    path, name, path, w->utfnames + e->utf);
+		if (opt_n)
+			e->flags &= ~DCE_RENAME;
+	}
+	if (opt_s)
+		cv_clock_lap(&w->clk, &w->stats.classify);
+
+	/* record the renames in the plan */
+	if (renaming && opt_P != NULL) {
+		for (i = 0; i < w->nents; ++i) {
+			e = &w->ents[i];
+			if (!(e->flags & DCE_RENAME) || (e->flags & DCE_SKIP))
+				continue;
+			if (!w->planned) {
+				dcplog_dir(w->plan, dcpath(w, dn), dst);
+				w->planned = 1;
+			}
+			dcplog_add(w->plan, dctype(e), w->names + e->name,
+			    e->namelen, w->utfnames + e->utf, e->utflen);
+			e->flags |= DCE_PLANNED;
+			w->stats.planned++;
+		}
+	}
+
+	/* rename */
+	if (renaming && opt_P == NULL) {
+		for (i = n = 0; i < w->nents; ++i) {
+			e = &w->ents[i];
+			if (!(e->flags & DCE_RENAME) || (e->flags & DCE_SKIP))
+				continue;
+			op = &w->op[n++];
+			op->kind = opt_F ? dcop_rename : dcop_rename_excl;
+			op->dfd = dfd;
+			op->name = w->names + e->name;
+			op->newname = w->utfnames + e->utf;
+			op->ent = i;
+		}
+		dcops_run(w->ops, w->op, n);
+		w->stats.renames += n;
+		for (i = 0; i < n; ++i) {
+			op = &w->op[i];
+			if (op->res == EEXIST && op->kind == dcop_rename_excl) {
+				/* taken since we read the directory */
+				w->ents[op->ent].flags |= DCE_COLLIDED;
+				errno = EEXIST;
+				warn("%s/%s", dcpath(w, dn), op->newname);
+				++w->errcnt;
+				w->stats.rencoll++;
+			} else if (op->res != 0) {
+				path = dcpath(w, dn);
+				errno = op->res;
+				warn("rename(%s/%s, %s/%s)",
+				    path, op->name, path, op->newname);
+				++w->errcnt;
+				w->stats.renfail++;
+				w->ents[op->ent].err = op->res;
+			} else {
+				w->ents[op->ent].flags |= DCE_RENAMED;
+			}
+		}
+	}
+
+	/* structured records, now that we know the outcome */
+	if (opt_J)
+		dcbatch_records(w, dn);
+
+	/* queue subdirectories, under their new names if renamed */
+	if (opt_s)
+		cv_clock_lap(&w->clk, &w->stats.rename);
+	for (i = 0; i < w->nents; ++i) {
+		e = &w->ents[i];
+		if (e->flags & DCE_SKIP)
+			continue;
+		if ((e->flags & DCE_STAT) ? !S_ISDIR(e->mode) :
+		    e->type != DT_DIR)
+			continue;
+		if (e->flags & DCE_RENAMED)
+			dckid(w, dn, w->utfnames + e->utf, e->utflen);
+		else
+			dckid(w, dn, w->names + e->name, e->namelen);
+	}
+	w->nents = 0;
+	w->nameslen = 0;
+}
+
+/*
+ * Process a single directory.
+ */
+static void
+dirconv_dir(struct dcworker *w, struct dcnode *dn)
+{
+	const struct dcnode *root;
+	struct dcentry de;
+	struct stat st;
+	const char *kids, *path;
+	char fstype[32];
+	size_t i, len, kidslen;
+	int cached, dfd, errs, ret;
 
-static const char *excl;	/* exclude */
-static regex_t exclre;
+	w->pathdn = NULL;
+	debug(1, "entering %s\n", dcpath(w, dn));
+	if (opt_s)
+		cv_clock_start(&w->clk, 0);
+	if ((dfd = dcopen(w, dn)) < 0) {
+		warn("opendir(%s)", dcpath(w, dn));
+		++w->errcnt;
+		return;
+	}
+	if (fstat(dfd, &st) != 0) {
+		warn("fstat(%s)", dcpath(w, dn));
+		++w->errcnt;
+		close(dfd);
+		return;
+	}
+	dn->dev = st.st_dev;
 
-static int opt_0;		/* use '\0' as separator */
-static int opt_7;		/* print 7-bit names */
-static int opt_8;		/* print 8-bit non-UTF names */
-static int opt_d;		/* debug */
-static int opt_F;		/* force rename */
-static int opt_n;		/* dry run (with -r) */
-static int opt_p;		/* print names */
-static int opt_r;		/* rename non-UTF files */
-static int opt_t;		/* undocumented test mode */
-static int opt_u;		/* print UTF names */
-static int opt_w;		/* print WTF names */
+	/* stop at mount points if so instructed */
+	if (dn->parent != NULL && st.st_dev != dn->parent->dev &&
+	    (opt_X || (opt_T != NULL &&
+	    !dcfs_cross(dfd, fstype, sizeof fstype)))) {
+		debug(1, "not crossing into %s%s%s\n", dcpath(w, dn),
+		    opt_X ? "" : ": ", opt_X ? "" : fstype);
+		w->stats.mounts++;
+		close(dfd);
+		return;
+	}
 
-#define debug(lvl, ...) \
-	do { if (opt_d >= lvl) fprintf(stderr, __VA_ARGS__); } while (0)
+	/* bind mounts and overlapping arguments can lead us back here */
+	if (dcfs_visit(st.st_dev, st.st_ino)) {
+		debug(1, "already visited %s\n", dcpath(w, dn));
+		w->stats.repeated++;
+		close(dfd);
+		return;
+	}
+	w->stats.dirs++;
 
-typedef enum { nc_8bit = -1, nc_ascii = 0, nc_utf8 = 1, nc_wtf8 = 2 } nameclass;
+	/* if the cache says nothing has changed, go straight to the kids */
+	cached = opt_C != NULL;
+	if (cached && (kids = dccache_lookup(&st, &kidslen)) != NULL) {
+		debug(1, "unchanged %s\n", dcpath(w, dn));
+		w->stats.cached++;
+		ret = dclog_add(w->log, &st);
+		for (i = 0; i < kidslen; i += len + 1) {
+			len = strlen(kids + i);
+			dckid(w, dn, kids + i, len);
+			if (ret)
+				dclog_kid(w->log, kids + i, len);
+		}
+		goto done;
+	}
+
+	if (dcread_open(w, dfd) != 0) {
+		warn("opendir(%s)", dcpath(w, dn));
+		++w->errcnt;
+		close(dfd);
+		return;
+	}
+	w->dirty = 0;
+	w->planned = 0;
+	errs = w->errcnt;
+	if (opt_r)
+		dcnset_clear(&w->nset);
+	if (opt_x && dcexcl_paths()) {
+		/* path patterns are relative to the root */
+		for (root = dn; root->parent != NULL; root = root->parent)
+			/* nothing */;
+		if (root == dn) {
+			dcexcl_dir(&w->xdir, "", 0);
+		} else {
+			path = dcpath(w, dn) + root->namelen + 1;
+			dcexcl_dir(&w->xdir, path, strlen(path));
+		}
+	}
+	while ((ret = dcread(w, &de)) > 0) {
+		/* skip . and .. */
+		if (de.name[0] == '.' && (de.namelen == 1 ||
+		    (de.namelen == 2 && de.name[1] == '.')))
+			continue;
+
+		/* excluded or not, the name is taken */
+		if (opt_r)
+			dcnset_add(&w->nset, de.name, de.namelen, DCN_EXISTS);
+
+		/* apply exclusion filter */
+		if (opt_x && dcexcl_match(&w->xdir, de.name, de.namelen)) {
+			debug(1, "exclude %s\n", de.name);
+			continue;
+		}
+
+		dcent_add(w, &de);
+		if (w->nents == DC_BATCH && !opt_r)
+			dcbatch(w, dn, dfd, &st);
+	}
+	if (ret < 0) {
+		warn("readdir(%s)", dcpath(w, dn));
+		++w->errcnt;
+	}
+	if (w->nents > 0)
+		dcbatch(w, dn, dfd, &st);
+	dcread_close(w);
+
+	/* remember it for next time if there was nothing to report */
+	if (cached && !w->dirty && w->errcnt == errs &&
+	    dclog_add(w->log, &st))
+		for (i = 0; i < w->nkids; ++i)
+			dclog_kid(w->log, w->kids[i]->name,
+			    w->kids[i]->namelen);
+
+done:
+	/* keep open for the subdirectories, if we can afford it */
+	if (w->nkids > 0 && dcnode_keep())
+		dn->fd = dfd;
+	else
+		close(dfd);
+	if (opt_s)
+		cv_clock_lap(&w->clk, &w->stats.readdir);
+}
+
+static void *
+dcworker_run(void *arg)
+{
+	struct dcworker *w = arg;
+	struct dcnode *dn;
+
+	while ((dn = wq_get(w)) != NULL) {
+		w->nkids = 0;
+		dirconv_dir(w, dn);
+		dcflush(w, 0);
+		wq_add(w, w->kids, w->nkids);
+		dcnode_release(w, dn);
+		wq_done();
+	}
+	dcflush(w, 1);
+	return (NULL);
+}
 
 /*
- * Classify a string: returns
- *
- *  nc_utf8 if the string is valid UTF-8
- *  nc_ascii if the string contains no 8-bit characters
- *  nc_8bit if the string contains 8-bit characters but is not valid UTF-8
+ * Add up and print the statistics from all threads.
  */
-static nameclass
-classify(const unsigned char *str)
+#define DCSTATS_ADD(fld) \
+	do { sum.fld += w->stats.fld; } while (0)
+#define DCSTATS_ADDPH(ph) \
+	do { \
+		sum.ph.wall += w->stats.ph.wall; \
+		sum.ph.cpu += w->stats.ph.cpu; \
+	} while (0)
+
+static void
+dcstats(const cv_phase *total)
 {
-	unsigned char mask, pattern;
-	unsigned int codepoint;
-	int i, j, k, n8;
+	struct dcstats sum;
+	struct dcworker *w;
+	cv_report *r;
+	char key[80];
+	unsigned int i, j, ncand;
+
+	memset(&sum, 0, sizeof sum);
+	for (i = 0; i < nworkers; ++i) {
+		w = &workers[i];
+		DCSTATS_ADD(dirs);
+		DCSTATS_ADD(cached);
+		DCSTATS_ADD(repeated);
+		DCSTATS_ADD(mounts);
+		DCSTATS_ADD(entries);
+		DCSTATS_ADD(nc[0]);
+		DCSTATS_ADD(nc[1]);
+		DCSTATS_ADD(nc[2]);
+		DCSTATS_ADD(nc[3]);
+		DCSTATS_ADD(nc[4]);
+		DCSTATS_ADD(renames);
+		DCSTATS_ADD(renfail);
+		DCSTATS_ADD(rencoll);
+		DCSTATS_ADD(planned);
+		for (j = 0; j < CV_MAXCAND; ++j) {
+			DCSTATS_ADD(det[j]);
+			DCSTATS_ADD(detconf[j]);
+		}
+		DCSTATS_ADDPH(readdir);
+		DCSTATS_ADDPH(stat);
+		DCSTATS_ADDPH(classify);
+		DCSTATS_ADDPH(rename);
+	}
+	if ((r = cv_report_open("dirconv", opt_s > 1)) == NULL)
+		err(1, "cv_report_open()");
+	cv_report_count(r, "threads", nworkers);
+	cv_report_count(r, "directories", sum.dirs);
+	cv_report_count(r, "directories_cached", sum.cached);
+	cv_report_count(r, "directories_repeated", sum.repeated);
+	cv_report_count(r, "mounts_skipped", sum.mounts);
+	cv_report_count(r, "entries", sum.entries);
+	cv_report_count(r, "ascii", sum.nc[CV_NC_ASCII - CV_NC_8BIT]);
+	cv_report_count(r, "8bit", sum.nc[CV_NC_8BIT - CV_NC_8BIT]);
+	cv_report_count(r, "utf8", sum.nc[CV_NC_UTF8 - CV_NC_8BIT]);
+	cv_report_count(r, "wtf8", sum.nc[CV_NC_WTF8 - CV_NC_8BIT]);
+	cv_report_count(r, "nfd", sum.nc[CV_NC_NFD - CV_NC_8BIT]);
+	cv_report_count(r, "renames", sum.renames);
+	cv_report_count(r, "renames_failed", sum.renfail);
+	cv_report_count(r, "renames_collided", sum.rencoll);
+	cv_report_count(r, "renames_planned", sum.planned);
+	ncand = cv_candidates(workers[0].ctx);
+	for (j = 0; ncand > 1 && j < ncand; ++j) {
+		snprintf(key, sizeof key, "detected_%s",
+		    cv_candidate(workers[0].ctx, j));
+		cv_report_count(r, key, sum.det[j]);
+		snprintf(key, sizeof key, "confidence_%s",
+		    cv_candidate(workers[0].ctx, j));
+		cv_report_count(r, key, sum.det[j] ?
+		    sum.detconf[j] / sum.det[j] : 0);
+	}
+	cv_report_phase(r, "readdir", &sum.readdir);
+	cv_report_phase(r, "stat", &sum.stat);
+	cv_report_phase(r, "classify", &sum.classify);
+	cv_report_phase(r, "rename", &sum.rename);
+	cv_report_phase(r, "total", total);
+	if (cv_report_close(r) != 0)
+		err(1, "cv_report_close()");
+}
+
+/*
+ * Compare two output records.  Each record starts with the path of the
+ * entry it describes, so this sorts by path.
+ */
+static int
+reccmp(const void *a, const void *b)
+{
+	const struct iovec *x = a, *y = b;
+	int ret;
+
+	ret = memcmp(x->iov_base, y->iov_base,
+	    x->iov_len < y->iov_len ? x->iov_len : y->iov_len);
+	if (ret == 0)
+		ret = (x->iov_len > y->iov_len) - (x->iov_len < y->iov_len);
+	return (ret);
+}
+
+static void
+dcsorted(void)
+{
+	struct dcworker *w;
+	struct iovec *recs;
+	char *buf;
+	size_t i, len, n;
+	unsigned int j;
+
+	for (j = 0, n = 0; j < nworkers; ++j)
+		n += workers[j].nrecs;
+	if (n == 0)
+		return;
+	if ((recs = calloc(n, sizeof *recs)) == NULL)
+		err(1, "calloc()");
+	for (j = 0, n = 0; j < nworkers; ++j) {
+		w = &workers[j];
+		for (i = 0; i < w->nrecs; ++i, ++n) {
+			recs[n].iov_base = w->out + w->recs[i];
+			recs[n].iov_len = (i + 1 < w->nrecs ?
+			    w->recs[i + 1] : w->outlen) - w->recs[i];
+		}
+	}
+	qsort(recs, n, sizeof *recs, reccmp);
+	if ((buf = malloc(DC_OUTFLUSH)) == NULL)
+		err(1, "malloc()");
+	for (i = 0, len = 0; i < n; ++i) {
+		if (len + recs[i].iov_len > DC_OUTFLUSH) {
+			dcwrite(buf, len);
+			len = 0;
+		}
+		if (recs[i].iov_len > DC_OUTFLUSH) {
+			dcwrite(recs[i].iov_base, recs[i].iov_len);
+		} else {
+			memcpy(buf + len, recs[i].iov_base, recs[i].iov_len);
+			len += recs[i].iov_len;
+		}
+	}
+	dcwrite(buf, len);
+	free(buf);
+	free(recs);
+}
+
+/*
+ * Process the specified paths using the specified number of threads.
+ * The main thread takes part in the work.
+ */
+static void
+dirconv(char **paths, int npaths, unsigned int nthr)
+{
+	struct dcworker *w;
+	struct dcnode **roots;
+	struct rlimit rl;
+	struct dclog **logs;
+	struct dcplog **plans;
+	const char *backend, *excl;
+	char *key, *path, *slab;
+	cv_clock clk;
+	cv_phase total;
+	size_t len;
+	unsigned int i;
+	int n, r;
+
+	cv_clock_start(&clk, 1);
+
+	/*
+	 * Allow directories to be kept open for their subdirectories
+	 * using up to half of our file descriptors.
+	 */
+	nworkers = nthr;
+	if (getrlimit(RLIMIT_NOFILE, &rl) != 0 ||
+	    rl.rlim_cur == RLIM_INFINITY || rl.rlim_cur > 65536)
+		rl.rlim_cur = 65536;
+	if (rl.rlim_cur / 2 > 2 * nworkers + 16)
+		fd_budget = rl.rlim_cur / 2 - 2 * nworkers - 16;
+	debug(1, "keeping up to %u directories open\n", fd_budget);
+	backend = dcops_init(opt_q, nworkers);
+	debug(1, "metadata operations: %s, queue depth %u\n", backend, opt_q);
+	dcfs_init();
+	if ((workers = calloc(nworkers, sizeof *workers)) == NULL)
+		err(1, "calloc()");
 
 	/*
-	 * A running count of 8-bit characters is kept in n8.
-	 *
-	 * Within a potential UTF-8 multi-byte sequence, k is the expected
-	 * length of the sequence minus the initial byte and j is the
-	 * number of bytes that remain.  Otherwise, j and k are both 0.
+	 * Whether a directory contains anything of interest depends on
+	 * what we are looking for, so a cache built with different
+	 * options is no use to us.
 	 */
-	debug(2, "classify %s\n", str);
-	for (i = j = k = n8 = 0; str[i] != '\0'; ++i) {
+	key = NULL;
+	if (opt_C != NULL) {
+		excl = dcexcl_key();
+		len = strlen(enc8) + (excl ? strlen(excl) : 0) + 16;
+		if ((key = malloc(len)) == NULL)
+			err(1, "malloc()");
+		snprintf(key, len, "%s%s%s%s%s\n%s\n%s",
+		    opt_7 ? "7" : "", opt_8 ? "8" : "",
+		    opt_u ? "u" : "", opt_w ? "w" : "", opt_N ? "N" : "",
+		    enc8, excl ? excl : "");
+		len = dccache_open(opt_C, key);
+		debug(1, "%zu directories in cache\n", len);
+	}
+	for (i = 0; i < nworkers; ++i) {
+		w = &workers[i];
+		w->id = i;
+		if ((w->ctx = cv_open(enc8, opt_N ? CV_NFC : 0)) == NULL)
+			err(1, "iconv initialization failed");
+		w->ops = dcops_open();
+		if (opt_C != NULL)
+			w->log = dclog_new();
+		if (opt_P != NULL)
+			w->plan = dcplog_new();
+		pthread_mutex_init(&w->dq.lock, NULL);
+	}
+	if ((roots = calloc(npaths, sizeof *roots)) == NULL)
+		err(1, "calloc()");
+	for (n = r = 0; n < npaths; ++n) {
+		if ((path = realpath(paths[n], NULL)) == NULL) {
+			warn("realpath(%s)", paths[n]);
+			++errcnt;
+			continue;
+		}
+		roots[r++] = dcnode_new(&workers[0], NULL, path,
+		    strlen(path));
+		free(path);
+	}
+	wq_add(&workers[0], roots, r);
+	free(roots);
+	for (i = 1; i < nworkers; ++i)
+		if ((errno = pthread_create(&workers[i].thr, NULL,
+		    dcworker_run, &workers[i])) != 0)
+			err(1, "pthread_create()");
+	dcworker_run(&workers[0]);
+	for (i = 1; i < nworkers; ++i)
+		pthread_join(workers[i].thr, NULL);
+	if (opt_S)
+		dcsorted();
+	if (opt_P != NULL) {
+		if ((plans = calloc(nworkers, sizeof *plans)) == NULL)
+			err(1, "calloc()");
+		for (i = 0; i < nworkers; ++i)
+			plans[i] = workers[i].plan;
+		if (dcplan_save(opt_P, plans, nworkers) != 0)
+			++errcnt;
+		for (i = 0; i < nworkers; ++i)
+			dcplog_free(plans[i]);
+		free(plans);
+	}
+	if (opt_C != NULL) {
+		if ((logs = calloc(nworkers, sizeof *logs)) == NULL)
+			err(1, "calloc()");
+		for (i = 0; i < nworkers; ++i)
+			logs[i] = workers[i].log;
+		if (dccache_save(opt_C, logs, nworkers) != 0)
+			++errcnt;
+		dccache_close();
+		for (i = 0; i < nworkers; ++i)
+			dclog_free(logs[i]);
+		free(logs);
+		free(key);
+	}
+	if (opt_s) {
+		memset(&total, 0, sizeof total);
+		cv_clock_lap(&clk, &total);
+		dcstats(&total);
+	}
+	for (i = 0; i < nworkers; ++i) {
+		w = &workers[i];
+		errcnt += w->errcnt;
+		cv_close(w->ctx);
+		pthread_mutex_destroy(&w->dq.lock);
+		free(w->dq.items);
+		free(w->kids);
+		free(w->pathbuf);
+		free(w->out);
+		free(w->recs);
+#ifdef DC_GETDENTS
+		free(w->dbuf);
+#endif
+		free(w->ents);
+		free(w->names);
+		free(w->utfnames);
+		free(w->op);
+		dcnset_free(&w->nset);
+		free(w->xdir.buf);
+		while ((slab = w->slab) != NULL) {
+			w->slab = *(char **)slab;
+			free(slab);
+		}
+		dcops_close(w->ops);
+	}
+	free(workers);
+	dcops_fini();
+	dcfs_fini();
+}
+
+/*
+ * UTF-8 unit tests.  Each of these is checked on its own and embedded at
+ * every offset in a longer ASCII string, so that the interesting bytes
+ * fall on and around the block boundaries of the SIMD implementations.
+ */
+static const struct { const char *str; cv_nameclass nc; } tests[] = {
+	/* lowest allowed codepoint for each length */
+	/* first is ASCII, last two are out of range */
+	{ "\x01", CV_NC_ASCII },
+	{ "\xc2\x80", CV_NC_UTF8 },
+	{ "\xe0\xa0\x80", CV_NC_UTF8 },
+	{ "\xf0\x90\x80\x80", CV_NC_UTF8 },
+	{ "\xf8\x8f\x80\x80\x80", CV_NC_8BIT },
+	{ "\xfc\x84\x80\x80\x80\x80", CV_NC_8BIT },
+
+	/* highest allowed codepoint for each length */
+	/* first is ASCII, last three are out of range */
+	{ "\x7f", CV_NC_ASCII },
+	{ "\xdf\xbf", CV_NC_UTF8 },
+	{ "\xef\xbf\xbf", CV_NC_UTF8 },
+	{ "\xf7\xbf\xbf\xbf", CV_NC_8BIT },
+	{ "\xfb\xbf\xbf\xbf\xbf", CV_NC_8BIT },
+	{ "\xfd\xbf\xbf\xbf\xbf\xbf", CV_NC_8BIT },
+
+	/* overlong encodings for U+0 */
+	{ "\xc0\x80", CV_NC_8BIT },
+	{ "\xe0\x80\x80", CV_NC_8BIT },
+	{ "\xf0\x80\x80\x80", CV_NC_8BIT },
+	{ "\xf8\x80\x80\x80\x80", CV_NC_8BIT },
+	{ "\xfc\x80\x80\x80\x80\x80", CV_NC_8BIT },
+
+	/* highest overlong encoding for each length */
+	{ "\xc1\xbf", CV_NC_8BIT },
+	{ "\xe0\x9f\xbf", CV_NC_8BIT },
+	{ "\xf0\x8f\xbf\xbf", CV_NC_8BIT },
+
+	/* highest in-range codepoint, lowest out-of-range codepoint */
+	{ "\xf4\x8f\xbf\xbf", CV_NC_UTF8 },
+	{ "\xf4\x90\x80\x80", CV_NC_8BIT },
+	{ "\xf5\x80\x80\x80", CV_NC_8BIT },
+
+	/* surrogates are accepted */
+	{ "\xed\x9f\xbf", CV_NC_UTF8 },
+	{ "\xed\xa0\x80", CV_NC_UTF8 },
+	{ "\xed\xbf\xbf", CV_NC_UTF8 },
+	{ "\xee\x80\x80", CV_NC_UTF8 },
+
+	/* bytes which never occur in UTF-8 */
+	{ "\xfe", CV_NC_8BIT },
+	{ "\xff", CV_NC_8BIT },
+
+	/* truncated sequences */
+	{ "\xc3", CV_NC_8BIT },
+	{ "\xe2\x82", CV_NC_8BIT },
+	{ "\xf0\x9f\x98", CV_NC_8BIT },
+	{ "\xc3" "a", CV_NC_8BIT },
+	{ "\xe2\x82" "a", CV_NC_8BIT },
+	{ "\xf0\x9f\x98" "a", CV_NC_8BIT },
+	{ "\xc3\xc3\xa9", CV_NC_8BIT },
+
+	/* stray continuation bytes */
+	{ "\x80", CV_NC_8BIT },
+	{ "a\xbf" "b", CV_NC_8BIT },
+	{ "\xc3\xa9\xa9", CV_NC_8BIT },
+	{ "\xe2\x82\xac\x80", CV_NC_8BIT },
+	{ "\xf0\x9f\x98\x80\x80", CV_NC_8BIT },
+
+	/* the usual suspects */
+	{ "", CV_NC_ASCII },
+	{ "caf\xe9", CV_NC_8BIT },
+	{ "caf\xc3\xa9", CV_NC_UTF8 },
+	{ "\xe2\x82\xac\xf0\x9f\x98\x80\xc3\xa6\xc3\xb8\xc3\xa5", CV_NC_UTF8 },
+	{ "\xc3\x83\xc2\xa9", CV_NC_UTF8 },
+};
+
+/*
+ * The original bit-at-a-time UTF-8 classifier, used as a reference for
+ * the randomized tests.
+ */
+static cv_nameclass
+classify_ref(const unsigned char *str, size_t len)
+{
+	unsigned char mask, pattern;
+	unsigned int codepoint;
+	int j, k, n8;
+	size_t i;
+
+	for (i = 0, codepoint = 0, j = k = n8 = 0; i < len; ++i) {
 		if ((str[i] & 0x80) == 0) {
-			/* 7-bit character */
 			if (k > 0)
-				goto non_utf8;
+				return (CV_NC_8BIT);
 			continue;
 		}
-		/* 8-bit character */
 		++n8;
-		debug(3, "%02x %02x j = %d k = %d\n",
-		    str[i], str[i] & 0xc0, j, k);
 		if ((str[i] & 0xc0) == 0x80) {
-			/*
-			 * 10xxxxxx: either non-UTF encoding or subsequent
-			 * byte of UTF-8 sequence.
-			 */
 			if (k == 0)
-				goto non_utf8;
+				return (CV_NC_8BIT);
 			codepoint = (codepoint << 6) | (str[i] & 0x3f);
-			--j;
-			if (j == 0) {
-				/* this was the last byte of the sequence */
-				debug(3, "codepoint: U+%06x\n", codepoint);
-				/*
-				 * Ugly check for overlong encoding.
-				 *
-				 * First, compute the minimum codepoint
-				 * bit length for the given UTF-8 sequence
-				 * length.  This is basically one more
-				 * than the maximum codepoint bit length
-				 * for a sequence one byte shorter.
-				 *
-				 * Next, compare this to the actual bit
-				 * length of the decoded codepoint.
-				 */
+			if (--j == 0) {
+				/* overlong or out of range */
 				j = (k > 1 ? k * 5 + 1 : 7) + 1;
-				debug(3, "minimum bit length: %d\n", j);
 				for (k = 0; codepoint >= 1U << k; ++k)
 					/* nothing */;
-				debug(3, "codepoint bit length: %d\n", k);
-				if (j > k) {
-					debug(3, "overlong encoding\n");
-					goto non_utf8;
-				}
-				/* check range */
-				if (codepoint > 0x10ffff) {
-					debug(3, "out-of-range codepoint\n");
-					goto non_utf8;
-				}
+				if (j > k || codepoint > 0x10ffff)
+					return (CV_NC_8BIT);
 				j = k = 0;
 			}
 			continue;
 		}
-		/*
-		 * All remaining possibilities are either non-UTF
-		 * encodings or the first byte in a multibyte UTF-8
-		 * sequence.
-		 */
 		if (k > 0)
-			goto non_utf8;
+			return (CV_NC_8BIT);
 		for (mask = 0xe0, pattern = 0xc0; ++k < 7;
 		     mask = mask >> 1 | 0x80, pattern = pattern >> 1 | 0x80) {
 			if ((str[i] & mask) == pattern) {
@@ -162,293 +1767,350 @@ classify(const unsigned char *str)
 			}
 		}
 		if (k == 7)
-			goto non_utf8;
+			return (CV_NC_8BIT);
 		j = k;
-		debug(3, "entering %d-byte sequence\n", k + 1);
 	}
-	/* incomplete multibyte sequence */
 	if (j != 0)
-		goto non_utf8;
-	/*
-	 * We reached the end with no errors; this was either valid UTF-8
-	 * or pure 7-bit ASCII.
-	 */
-	if (n8 > 0) {
-		debug(2, "UTF-8\n");
-		return (nc_utf8);
-	} else {
-		debug(2, "ASCII\n");
-		return (nc_ascii);
-	}
-non_utf8:
-	debug(2, "non-UTF 8-bit encoding\n");
-	return (nc_8bit);
+		return (CV_NC_8BIT);
+	return (n8 > 0 ? CV_NC_UTF8 : CV_NC_ASCII);
 }
 
-static char *
-convertstr(iconv_t conv, char *str)
+/*
+ * Check a test vector on its own and embedded at every offset in a
+ * string of ASCII characters.
+ */
+static int
+diagnostic_vector(const char *str, cv_nameclass nc)
 {
-	char *cip, *cop;	/* conversion in / out buffer pointers */
-	size_t cilen, colen;	/* conversion in / out buffer lengths */
-	size_t convlen;		/* conversion length */
-	char *utfstr;
-	int serrno;
-
-	/* prepare input / output */
-	cip = str;
-	cilen = strlen(cip);
-	colen = 2 * cilen;
-	if ((utfstr = malloc(colen + 1)) == NULL)
-		err(1, "malloc()");
-	cop = utfstr;
-
-	/* reset conversion state */
-	iconv(conv, NULL, NULL, NULL, NULL);
+	char buf[160];
+	size_t len, pre;
 
-	/* convert */
-	convlen = iconv(conv, &cip, &cilen, &cop, &colen);
-	if (convlen == (size_t)-1) {
-		serrno = errno;
-		free(utfstr);
-		errno = serrno;
-		return (NULL);
+	len = strlen(str);
+	if (cv_classify(str, len) != nc)
+		return (0);
+	for (pre = 0; pre + len + 8 <= sizeof buf; ++pre) {
+		memset(buf, 'x', sizeof buf);
+		memcpy(buf + pre, str, len);
+		if (cv_classify(buf, pre + len) != nc ||
+		    cv_classify(buf, sizeof buf) != nc)
+			return (0);
 	}
-	*cop = '\0';
-	return (utfstr);
+	return (1);
 }
 
 /*
- * Resize a buffer so it will fit at least len characters plus a
- * terminating NUL, with a minimum allocation of 64 bytes.
+ * Compare the current cv_classify() implementation to the reference
+ * implementation, using strings of every length up to a few blocks made
+ * up of random codepoints of every length, with an increasing rate of
+ * random corruption.
  */
-static char *
-growbuf(char **buf, size_t *size, int len)
+static int
+diagnostic_random(void)
 {
-	char *tmpbuf;
-	size_t tmpsize;
+	unsigned char buf[256];
+	unsigned int seed, cp, n;
+	size_t len, i;
+	int run;
 
-	tmpbuf = *buf;
-	tmpsize = *size;
-	if (tmpsize < 64)
-		tmpsize = 64;
-	while ((size_t)(len + 1) >= tmpsize)
-		tmpsize *= 2;
-	if ((tmpbuf = realloc(tmpbuf, tmpsize)) == NULL)
-		return (NULL);
-	*buf = tmpbuf;
-	*size = tmpsize;
-	return (*buf);
+	for (seed = 1, run = 0; run < 64; ++run) {
+		for (len = 0; len <= sizeof buf; ++len) {
+			for (i = 0; i < len; ) {
+				seed = seed * 1103515245 + 12345;
+				cp = seed >> 8;
+				if (cp % 512 < (unsigned int)run) {
+					buf[i++] = cp >> 9;
+					continue;
+				}
+				switch (cp % 4) {
+				case 0:
+					buf[i++] = 0x20 | (cp >> 2 & 0x3f);
+					continue;
+				case 1:
+					cp = 0x80 + (cp >> 2) % 0x780;
+					buf[i++] = 0xc0 | cp >> 6;
+					n = 1;
+					break;
+				case 2:
+					cp = 0x800 + (cp >> 2) % 0xf800;
+					buf[i++] = 0xe0 | cp >> 12;
+					n = 2;
+					break;
+				case 3:
+					cp = 0x10000 + (cp >> 2) % 0x100000;
+					buf[i++] = 0xf0 | cp >> 18;
+					n = 3;
+					break;
+				}
+				while (n-- > 0 && i < len)
+					buf[i++] = 0x80 | (cp >> 6 * n & 0x3f);
+			}
+			if (cv_classify((char *)buf, len) !=
+			    classify_ref(buf, len))
+				return (0);
+		}
+	}
+	return (1);
 }
 
-static void
-dirconv_r(char **pathbuf, size_t *pathsize, int pathlen)
+/*
+ * Check that a structured record comes out as documented in both forms.
+ */
+static int
+diagnostic_record(void)
 {
-	DIR *dir;
-	struct dirent *ent;
-	struct stat sb, utfsb;
-	int entlen, utflen, serrno;
-	char *name, *path, *utfname, *utfpath;
-	size_t utfsize;
-	nameclass nc;
-	int selected;
-
-	path = *pathbuf;
-	debug(1, "entering %s\n", path);
-	if ((dir = opendir(path)) == NULL) {
-		warn("opendir(%s)", path);
-		++errcnt;
-		return;
-	}
-	/*
-	 * Why I Hate Unix, #237846: the only way to tell whether
-	 * readdir(3) failed or just hit the end is to clear errno before
-	 * calling it and inspect it afterwards.
-	 */
-	while ((errno = 0, utfname = NULL, ent = readdir(dir)) != NULL) {
-		name = ent->d_name;
-
-		/* skip . and .. */
-		if (strcmp(name, ".") == 0 ||
-		    strcmp(name, "..") == 0)
-			continue;
-
-		/* apply exclusion filter */
-		if (excl != NULL &&
-		    regexec(&exclre, name, 0, NULL, 0) == 0) {
-			debug(1, "exclude %s\n", name);
-			continue;
-		}
+	static const char json[] = "{\"path\":\"a\\\"\\u000a/bl\\udce5\","
+	    "\"class\":\"8bit\",\"type\":\"file\",\"ino\":4294967298,"
+	    "\"new\":\"a\\\"\\u000a/blå\",\"result\":\"dry-run\"}\n";
+	static const char bin[] = "\x27\0\0\0" "\x02\0\0\0\x01\0\0\0"
+	    "\x08\xff\x01\0" "\0\0\0\0" "\x07\0\0\0" "a\"\n/bl\xe5"
+	    "\x08\0\0\0" "a\"\n/bl\xc3\xa5";
+	struct dcrec rec;
+	char buf[512];
+	size_t len;
 
-		/* check path buffer size and expand if necessary */
-		entlen = strlen(name);
-		if (!growbuf(pathbuf, pathsize, pathlen + 1 + entlen))
-			err(1, "realloc()");
+	rec.dir = "a\"\n";
+	rec.name = "bl\xe5";
+	rec.namelen = 3;
+	rec.newname = "bl\xc3\xa5";
+	rec.newlen = 4;
+	rec.ino = 0x100000002ULL;
+	rec.type = DT_REG;
+	rec.nc = CV_NC_8BIT;
+	rec.result = dcrec_dryrun;
+	rec.err = 0;
+	if (dcrec_max(&rec, 0) > sizeof buf ||
+	    (len = dcrec_put(buf, &rec, 0)) != sizeof json - 1 ||
+	    memcmp(buf, json, len) != 0)
+		return (0);
+	if (dcrec_max(&rec, 1) > sizeof buf ||
+	    (len = dcrec_put(buf, &rec, 1)) != sizeof bin - 1 ||
+	    memcmp(buf, bin, len) != 0)
+		return (0);
+	return (1);
+}
 
-		/* append entry name */
-		path[pathlen] = '/';
-		strcpy(path + pathlen + 1, name);
+/*
+ * Fill the name set past a few resizes, check that it holds what was
+ * put in it and nothing else, and that clearing it empties it.
+ */
+static int
+diagnostic_nset(void)
+{
+	struct dcnset set;
+	char name[32];
+	int gen, i, len, ok;
 
-		/* ent->d_type is not reliable on older kernels */
-		if (lstat(path, &sb) != 0) {
-			warn("lstat(%s)", path);
-			++errcnt;
-			continue;
+	memset(&set, 0, sizeof set);
+	ok = 1;
+	for (gen = 0; gen < 2 && ok; ++gen) {
+		dcnset_clear(&set);
+		for (i = 0; i < 2000; ++i) {
+			len = snprintf(name, sizeof name, "n%d.%d", i, gen);
+			if (dcnset_add(&set, name, len, DCN_EXISTS) != 0)
+				ok = 0;
 		}
-
-		/* classify */
-		nc = classify((unsigned char *)name);
-
-		/* additional step: if UTF, check for WTF */
-		if (nc == nc_utf8 &&
-		    (utfname = convertstr(revconv, name)) != NULL &&
-		    classify((unsigned char *)utfname) == nc_utf8)
-			nc = nc_wtf8;
-
-		/* select */
-		selected = ((nc == nc_ascii && opt_7) ||
-		    (nc == nc_8bit && opt_8) ||
-		    (nc == nc_utf8 && opt_u) ||
-		    (nc == nc_wtf8 && opt_w));
-
-		/* print */
-		if (opt_p && selected)
-			printf("%s%c", path, opt_0 ? '\0' : '\n');
-
-		/* rename if requested */
-		if (opt_r && selected && (nc == nc_8bit || nc == nc_wtf8)) {
-			if (utfname == NULL &&
-			    (utfname = convertstr(fwdconv, name)) == NULL) {
-				warn("iconv(%s) failed", name);
-				++errcnt;
-			} else {
-				utflen = pathlen + 1 + strlen(utfname);
-				utfsize = utflen + 1;
-				if ((utfpath = malloc(utfsize)) == NULL)
-					err(1, "malloc()");
-				snprintf(utfpath, utfsize, "%.*s/%s",
-				    pathlen, path, utfname);
-				printf("%s -> %s\n", path, utfpath);
-				if (opt_n) {
-					/* dry-run */
-				} else if (!opt_F && lstat(utfpath, &utfsb) == 0) {
-					/* converted name already exists */
-					errno = EEXIST;
-					warn("%s", utfpath);
-					++errcnt;
-				} else if (rename(path, utfpath) != 0) {
-					/* rename failed */
-					warn("rename(%s, %s)", path, utfpath);
-					++errcnt;
-				} else if (S_ISDIR(sb.st_mode)) {
-					/* update pathbuf before descending */
-					if (!growbuf(pathbuf, pathsize, utfsize))
-						err(1, "realloc()");
-					path = *pathbuf;
-					strcpy(path, utfpath);
-					entlen = utflen - 1 - pathlen;
-				}
-				free(utfpath);
-			}
+		for (i = 0; i < 2000; ++i) {
+			len = snprintf(name, sizeof name, "n%d.%d", i, gen);
+			if (dcnset_find(&set, name, len) != DCN_EXISTS ||
+			    dcnset_find(&set, name, len - 1) != 0)
+				ok = 0;
+			len = snprintf(name, sizeof name, "n%d.%d", i, !gen);
+			if (dcnset_find(&set, name, len) != 0)
+				ok = 0;
 		}
-
-		/* if a directory, descend */
-		if (S_ISDIR(sb.st_mode))
-			dirconv_r(pathbuf, pathsize, pathlen + 1 + entlen);
-
-		/* done */
-		free(utfname);
-	}
-	/* cut back to original length */
-	path[pathlen] = '\0';
-
-	/* close and inspect errno */
-	serrno = errno;
-	closedir(dir);
-	errno = serrno;
-	if (errno != 0) {
-		++errcnt;
-		warn("readdir(%s)", path);
+		if (dcnset_add(&set, "n0.0", 4, DCN_CLAIMED) !=
+		    (gen == 0 ? DCN_EXISTS : 0) ||
+		    dcnset_find(&set, "n0.0", 4) != DCN_CLAIMED)
+			ok = 0;
 	}
+	dcnset_free(&set);
+	return (ok);
 }
 
-static void
-dirconv(const char *path)
+/*
+ * Check the classification and conversion of names which are not NFC:
+ * decomposed, with marks out of order, or with a character which never
+ * occurs in NFC, next to some which are, or which only look like they
+ * might not be.
+ */
+static const struct { const char *str, *nfc; } nfc_tests[] = {
+	{ "caf\xc3\xa9", NULL },
+	{ "cafe\xcc\x81", "caf\xc3\xa9" },
+	{ "\xcc\x81" "e", NULL },
+	{ "a\xcc\xa3\xcc\x87", "\xe1\xba\xa1\xcc\x87" },
+	{ "a\xcc\x87\xcc\xa3", "\xe1\xba\xa1\xcc\x87" },
+	{ "\xe2\x84\xab", "\xc3\x85" },
+	{ "\xe1\x84\x80\xe1\x85\xa1\xe1\x86\xa8", "\xea\xb0\x81" },
+	{ "\xea\xb0\x81", NULL },
+	{ "\xe0\xa4\x95\xe0\xa4\xbc", NULL },
+};
+
+static int
+diagnostic_nfc(void)
 {
-	char *pathbuf;
-	size_t pathsize;
-	int pathlen;
+	cv_ctx *ctx;
+	char out[64];
+	size_t i, len, olen;
+	cv_nameclass nc;
+	int ok;
 
-	pathsize = pathconf(path, _PC_PATH_MAX);
-	if ((pathbuf = malloc(pathsize)) == NULL)
-		err(1, "malloc()");
-	if ((realpath(path, pathbuf)) == NULL) {
-		warn("realpath(%s)", path);
-		++errcnt;
-		return;
+	if ((ctx = cv_open("iso8859-1", CV_NFC)) == NULL)
+		return (0);
+	ok = 1;
+	for (i = 0; i < sizeof nfc_tests / sizeof nfc_tests[0]; ++i) {
+		len = strlen(nfc_tests[i].str);
+		nc = cv_fix(ctx, nfc_tests[i].str, len, out, &olen);
+		if (nfc_tests[i].nfc == NULL) {
+			if (nc != CV_NC_UTF8 || olen != 0 ||
+			    cv_classify_wtf(ctx, nfc_tests[i].str, len) !=
+			    CV_NC_UTF8)
+				ok = 0;
+		} else {
+			if (nc != CV_NC_NFD ||
+			    olen != strlen(nfc_tests[i].nfc) ||
+			    memcmp(out, nfc_tests[i].nfc, olen) != 0 ||
+			    cv_classify_wtf(ctx, nfc_tests[i].str, len) !=
+			    CV_NC_NFD)
+				ok = 0;
+		}
 	}
-	pathlen = strlen(pathbuf);
-	dirconv_r(&pathbuf, &pathsize, pathlen);
-	free(pathbuf);
+	/* repaired names are normalized too */
+	nc = cv_fix(ctx, "e\xc3\x8c\xc2\x81", 5, out, &olen);
+	if (nc != CV_NC_WTF8 || olen != 2 || memcmp(out, "\xc3\xa9", 2) != 0)
+		ok = 0;
+	cv_close(ctx);
+	return (ok);
 }
 
 /*
- * A handful of UTF-8 unit tests.  All of these are properly encoded
- * UTF-8, but some are either overlong or out of range or both.  Since
- * classify() doesn't tell us anything more than "not valid UTF-8", these
- * tests aren't currently very useful.
+ * Check the exclusion filter: literal names and paths, with and without
+ * surplus slashes, a glob without any special characters, which is
+ * treated as a literal, real globs, and several regular expressions,
+ * which are combined into one.
  */
-static const struct { const char *str; nameclass nc; } tests[] = {
-	/* lowest allowed codepoint for each length */
-	/* first is ASCII, last two are out of range */
-	{ "\x01", nc_ascii },
-	{ "\xc2\x80", nc_utf8 },
-	{ "\xe0\xa0\x80", nc_utf8 },
-	{ "\xf0\x90\x80\x80", nc_utf8 },
-	{ "\xf8\x8f\x80\x80\x80", nc_8bit },
-	{ "\xfc\x84\x80\x80\x80\x80", nc_8bit },
+static const char *excl_patterns[] = {
+	"path:core",
+	"path:/a/b/",
+	"glob:plain",
+	"glob:*.o",
+	"glob:src/*.tmp",
+	"re:~$",
+	"re:^#",
+	"^\\.nfs",
+	"re:^build/.*\\.log$",
+};
 
-	/* highest allowed codepoint for each length */
-	/* first is ASCII, last three are out of range */
-	{ "\x7f", nc_ascii },
-	{ "\xdf\xbf", nc_utf8 },
-	{ "\xef\xbf\xbf", nc_utf8 },
-	{ "\xf7\xbf\xbf\xbf", nc_8bit },
-	{ "\xfb\xbf\xbf\xbf\xbf", nc_8bit },
-	{ "\xfd\xbf\xbf\xbf\xbf\xbf", nc_8bit },
+static const struct { const char *dir, *name; int excl; } excl_tests[] = {
+	{ "", "core", 1 },
+	{ "x/y", "core", 1 },
+	{ "", "cores", 0 },
+	{ "a", "b", 1 },
+	{ "c", "b", 0 },
+	{ "", "a", 0 },
+	{ "x/a", "b", 0 },
+	{ "", "plain", 1 },
+	{ "", "plainer", 0 },
+	{ "x", "foo.o", 1 },
+	{ "", "foo.oo", 0 },
+	{ "src", "x.tmp", 1 },
+	{ "src/sub", "x.tmp", 0 },
+	{ "", "x.tmp", 0 },
+	{ "x", "notes~", 1 },
+	{ "", "#notes#", 1 },
+	{ "", "a#b", 0 },
+	{ "x", ".nfs0001", 1 },
+	{ "", "a.nfs", 0 },
+	{ "build", "x.log", 1 },
+	{ "build/sub", "x.log", 1 },
+	{ "src", "x.log", 0 },
+};
 
-	/* overlong encodings for U+0 */
-	{ "\xc0\x80", nc_8bit },
-	{ "\xe0\x80\x80", nc_8bit },
-	{ "\xf0\x80\x80\x80", nc_8bit },
-	{ "\xf8\x80\x80\x80\x80", nc_8bit },
-	{ "\xfc\x80\x80\x80\x80\x80", nc_8bit },
+static int
+diagnostic_excl(void)
+{
+	struct dcxdir xd;
+	char name[32];
+	size_t i;
+	int ok;
 
-	/* highest in-range codepoint, lowest out-of-range codepoint */
-	{ "\xf4\x8f\xbf\xbf", nc_utf8 },
-	{ "\xf4\x90\x80\x80", nc_8bit },
-};
+	for (i = 0; i < sizeof excl_patterns / sizeof excl_patterns[0]; ++i)
+		dcexcl_add(excl_patterns[i]);
+	dcexcl_init();
+	memset(&xd, 0, sizeof xd);
+	ok = dcexcl_paths();
+	for (i = 0; i < sizeof excl_tests / sizeof excl_tests[0]; ++i) {
+		dcexcl_dir(&xd, excl_tests[i].dir, strlen(excl_tests[i].dir));
+		strcpy(name, excl_tests[i].name);
+		if (dcexcl_match(&xd, name, strlen(name)) !=
+		    excl_tests[i].excl)
+			ok = 0;
+	}
+	free(xd.buf);
+	dcexcl_fini();
+	return (ok);
+}
 
-static void
+/*
+ * Run the unit tests and the randomized test against every supported
+ * implementation, then the record, name set, normalization and exclusion
+ * filter tests.
+ * Returns the number of failed tests.
+ */
+static int
 diagnostic(void)
 {
-	int i, n;
+	const char *const *impls;
+	unsigned int i, j, n, nt, t;
+	int fail, ok;
 
-	n = sizeof tests / sizeof tests[0];
-	printf("1..%d\n", n);
-	for (i = 0; i < n; ++i) {
-		if (classify((unsigned char *)tests[i].str) == tests[i].nc)
-			printf("ok %d\n", i + 1);
-		else
-			printf("not ok %d\n", i + 1);
+	impls = cv_impl_list();
+	for (n = 0; impls[n] != NULL; ++n)
+		/* nothing */;
+	nt = sizeof tests / sizeof tests[0];
+	printf("1..%u\n", n * (nt + 1) + 4);
+	for (i = 0, t = 0, fail = 0; i < n; ++i) {
+		if (cv_impl_select(impls[i]) != 0) {
+			for (j = 0; j <= nt; ++j)
+				printf("ok %u # skip %s\n",
+				    ++t, impls[i]);
+			continue;
+		}
+		for (j = 0; j < nt; ++j) {
+			ok = diagnostic_vector(tests[j].str, tests[j].nc);
+			printf("%sok %u - %s vector %u\n", ok ? "" : "not ",
+			    ++t, impls[i], j + 1);
+			fail += !ok;
+		}
+		ok = diagnostic_random();
+		printf("%sok %u - %s random\n", ok ? "" : "not ",
+		    ++t, impls[i]);
+		fail += !ok;
 	}
+	cv_impl_select(NULL);
+	ok = diagnostic_record();
+	printf("%sok %u - records\n", ok ? "" : "not ", ++t);
+	fail += !ok;
+	ok = diagnostic_nset();
+	printf("%sok %u - name set\n", ok ? "" : "not ", ++t);
+	fail += !ok;
+	ok = diagnostic_nfc();
+	printf("%sok %u - normalization\n", ok ? "" : "not ", ++t);
+	fail += !ok;
+	ok = diagnostic_excl();
+	printf("%sok %u - exclusion filter\n", ok ? "" : "not ", ++t);
+	fail += !ok;
+	return (fail);
 }
 
 static void
 usage(void)
 {
 
-	fprintf(stderr, "usage: dirconv [-078dFhnpruw] [-f charset] "
-	    "-x regex path ...\n");
+	fprintf(stderr, "usage: dirconv [-078dFhJkNnprSsuwX] [-C cachefile] "
+	    "[-f charset] [-j threads]\n"
+	    "               [-P plan] [-q depth] [-T types] [-x pattern] "
+	    "path ...\n"
+	    "       dirconv [-dFn] [-j threads] [-q depth] -A plan\n");
 	exit(1);
 }
 
@@ -465,9 +2127,12 @@ version(void)
 int
 main(int argc, char *argv[])
 {
+	unsigned long ul;
+	char *end;
 	int opt;
 
-	while ((opt = getopt(argc, argv, "078dFf:hnprtuvwx:")) != -1)
+	while ((opt = getopt(argc, argv,
+	    "078A:C:dFf:hJj:kNnP:pq:rST:stuvwXx:")) != -1)
 		switch (opt) {
 		case '0':
 			++opt_0;
@@ -478,6 +2143,12 @@ main(int argc, char *argv[])
 		case '8':
 			++opt_8;
 			break;
+		case 'A':
+			opt_A = optarg;
+			break;
+		case 'C':
+			opt_C = optarg;
+			break;
 		case 'd':
 			++opt_d;
 			break;
@@ -490,15 +2161,52 @@ main(int argc, char *argv[])
 		case 'h':
 			usage();
 			break;
+		case 'J':
+			++opt_J;
+			break;
+		case 'j':
+			ul = strtoul(optarg, &end, 10);
+			if (end == optarg || *end != '\0' ||
+			    ul < 1 || ul > 1024)
+				errx(1, "invalid number of threads: %s",
+				    optarg);
+			opt_j = ul;
+			break;
+		case 'k':
+			++opt_k;
+			break;
+		case 'N':
+			++opt_N;
+			break;
 		case 'n':
 			++opt_n;
 			break;
+		case 'P':
+			opt_P = optarg;
+			break;
 		case 'p':
 			++opt_p;
 			break;
+		case 'q':
+			ul = strtoul(optarg, &end, 10);
+			if (end == optarg || *end != '\0' ||
+			    ul < 1 || ul > 4096)
+				errx(1, "invalid queue depth: %s", optarg);
+			opt_q = ul;
+			break;
 		case 'r':
 			++opt_r;
 			break;
+		case 'S':
+			++opt_S;
+			break;
+		case 'T':
+			dcfs_types(optarg);
+			opt_T = optarg;
+			break;
+		case 's':
+			++opt_s;
+			break;
 		case 't':
 			++opt_t;
 			break;
@@ -511,9 +2219,12 @@ main(int argc, char *argv[])
 		case 'w':
 			++opt_w;
 			break;
+		case 'X':
+			++opt_X;
+			break;
 		case 'x':
-			excl = optarg;
-			/* todo: concatenate multiple regexes */
+			dcexcl_add(optarg);
+			++opt_x;
 			break;
 		default:
 			usage();
@@ -524,8 +2235,18 @@ main(int argc, char *argv[])
 
 	/* undocumented test mode, all other options except -d are ignored */
 	if (opt_t) {
-		diagnostic();
-		exit(0);
+		exit(diagnostic() ? 1 : 0);
+	}
+
+	/* apply a plan instead of scanning */
+	if (opt_A != NULL) {
+		if (argc > 0 || opt_P != NULL || opt_r || opt_J || opt_k ||
+		    opt_T != NULL || opt_X)
+			usage();
+		dcops_init(opt_q, opt_j);
+		errcnt = dcplan_apply(opt_A, opt_j, opt_n, opt_F);
+		dcops_fini();
+		exit(errcnt > 0);
 	}
 
 	/* -n is intended for human consumption */
@@ -533,35 +2254,37 @@ main(int argc, char *argv[])
 		opt_0 = 0;
 
 	/* default is -8p */
-	if (!(opt_7 || opt_8 || opt_u || opt_w))
+	if (!(opt_7 || opt_8 || opt_u || opt_w || opt_N))
 		opt_8 = 1;
 	if (!(opt_r || opt_p))
 		opt_p = 1;
 
-	/* -F and -n only make sense with -r */
+	/* -F, -k and -n only make sense with -r */
 	if (opt_F && !opt_r)
 		warnx("-F is meaningless without -r");
+	if (opt_k && !opt_r)
+		warnx("-k is meaningless without -r");
 	if (opt_n && !opt_r)
 		warnx("-n is meaningless without -r");
+	if (opt_P != NULL && (!opt_r || opt_n))
+		errx(1, "-P requires -r and cannot be combined with -n");
+	if (opt_X && opt_T != NULL)
+		warnx("-T is meaningless with -X");
+	if (opt_J > 1 && opt_S)
+		errx(1, "-S cannot be combined with binary records");
 
-	/* initialize exclusion filter */
-	if (excl != NULL)
-		if (regcomp(&exclre, excl, REG_EXTENDED|REG_NOSUB) != 0)
-			/* todo: print error message from regerror() */
-			errx(1, "invalid exclusion filter regex");
+	/* don't hold back output meant for human eyes */
+	if (isatty(STDOUT_FILENO))
+		out_flush = 0;
 
-	/* initialize iconv */
-	if ((fwdconv = iconv_open("utf8", enc8)) == (iconv_t)-1 ||
-	    (revconv = iconv_open(enc8, "utf8")) == (iconv_t)-1)
-		err(1, "iconv initialization failed");
+	/* initialize exclusion filter */
+	if (opt_x)
+		dcexcl_init();
 
 	/* process paths */
-	while (argc--)
-		dirconv(*argv++);
+	dirconv(argv, argc, opt_j);
 
-	iconv_close(fwdconv);
-	iconv_close(revconv);
-	if (excl != NULL)
-		regfree(&exclre);
+	if (opt_x)
+		dcexcl_fini();
 	exit(errcnt > 0);
 }
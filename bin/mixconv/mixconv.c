@@ -31,11 +31,16 @@
 #include "config.h"
 #endif
 
+#include <sys/mman.h>
+#include <sys/stat.h>
+
 #include <err.h>
 #include <errno.h>
 #include <fcntl.h>
-#include <iconv.h>
+#include <limits.h>
 #include <locale.h>
+#include <pthread.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -48,96 +53,1081 @@ static const char *enc8 =
 
 static const char *outname;
 static int opt_d;		/* debug */
+static unsigned int opt_j = 1;	/* number of worker threads */
+static const char *opt_O;	/* output directory */
+static int opt_s;		/* print statistics */
 static int opt_t;		/* undocumented test mode */
 
 /*
- * Convert a file that contains a mix of ISO8859-1 and UTF-8 to clean
- * UTF-8, assuming that a) each line uses one encoding or the other and b)
- * there are no instances of multiple consecutive non-ASCII characters.
+ * Output buffer.  Output is accumulated in a large buffer and written
+ * out with write(2) when it fills up or is explicitly flushed.  If the
+ * file descriptor is -1, the buffer is grown instead, and the caller is
+ * responsible for retrieving the contents.
  *
- * Both encodings have 7-bit ASCII as a common subset.  ISO8859-1 has 96
- * additional characters, all of which have bit 7 set; UTF-8, on the other
- * hand, encodes non-ASCII characters as sequences of two to six bytes,
- * each of which has bit 7 set.
+ * If the input is a mapped file, long spans of it which need no
+ * conversion are copied straight from the input file descriptor to the
+ * output file descriptor within the kernel instead.
+ */
+struct outbuf {
+	int fd;			/* output file descriptor or -1 */
+	const char *name;	/* output file name */
+	char *buf;		/* buffer */
+	size_t len;		/* amount of data in buffer */
+	size_t size;		/* size of buffer */
+	uintmax_t nwritten;	/* bytes written so far */
+	int srcfd;		/* mapped input file descriptor or -1 */
+	const char *srcbase;	/* mapped input */
+	size_t srcsize;		/* size of mapped input */
+	int srcpipe;		/* output is a pipe, use splice(2) */
+};
+
+/* default and maximum input block and output buffer size */
+#define MIXCONV_BLKSIZE		(1024 * 1024)
+#define MIXCONV_BLKMAX		(1024 * 1024 * 1024)
+
+/* chunk size in multi-threaded mode, in blocks */
+#define MIXCONV_CHUNKBLKS	4
+#define MIXCONV_CHUNKSIZE	(MIXCONV_CHUNKBLKS * MIXCONV_BLKSIZE)
+
+/* minimum length of a clean span to copy within the kernel */
+#define MIXCONV_COPYMIN		(64 * 1024)
+
+static size_t blksize = MIXCONV_BLKSIZE;
+static size_t chunksize = MIXCONV_CHUNKSIZE;
+static size_t copymin = MIXCONV_COPYMIN;
+
+/*
+ * Statistics.  Worker threads count in their own copy and add it to the
+ * global one when they are done.  Output buffers count the bytes written
+ * through them.
+ */
+struct mcstats {
+	uintmax_t nread;	/* bytes read */
+	uintmax_t nwritten;	/* bytes written */
+	uintmax_t lines;	/* lines processed */
+	uintmax_t convlines;	/* lines converted */
+	uintmax_t detected[CV_MAXCAND]; /* lines detected per candidate */
+	uintmax_t detconf[CV_MAXCAND]; /* sum of confidence per candidate */
+};
+
+static struct mcstats stats;
+
+static void
+mcstats_add(struct mcstats *sum, const struct mcstats *ms)
+{
+	unsigned int i;
+
+	sum->nread += ms->nread;
+	sum->nwritten += ms->nwritten;
+	sum->lines += ms->lines;
+	sum->convlines += ms->convlines;
+	for (i = 0; i < CV_MAXCAND; ++i) {
+		sum->detected[i] += ms->detected[i];
+		sum->detconf[i] += ms->detconf[i];
+	}
+}
+
+static void
+writeall(int fd, const char *name, const char *p, size_t len)
+{
+	ssize_t wlen;
+
+	while (len > 0) {
+		if ((wlen = write(fd, p, len)) < 0) {
+			if (errno == EINTR)
+				continue;
+			err(1, "%s", name);
+		}
+		p += wlen;
+		len -= wlen;
+	}
+}
+
+static void
+outbuf_init(struct outbuf *ob, int fd, const char *name, size_t size)
+{
+
+	if ((ob->buf = malloc(size)) == NULL)
+		err(1, "malloc()");
+	ob->fd = fd;
+	ob->name = name;
+	ob->len = 0;
+	ob->size = size;
+	ob->nwritten = 0;
+	ob->srcfd = -1;
+}
+
+static void
+outbuf_flush(struct outbuf *ob)
+{
+
+	if (ob->fd < 0)
+		return;
+	writeall(ob->fd, ob->name, ob->buf, ob->len);
+	ob->nwritten += ob->len;
+	ob->len = 0;
+}
+
+/*
+ * Make room for at least len more bytes in the output buffer, either by
+ * flushing it or, if there is no file descriptor, by growing it.
+ */
+static void
+outbuf_room(struct outbuf *ob, size_t len)
+{
+	char *tmpbuf;
+	size_t tmpsize;
+
+	if (len <= ob->size - ob->len)
+		return;
+	if (ob->fd >= 0) {
+		outbuf_flush(ob);
+		return;
+	}
+	for (tmpsize = ob->size; len > tmpsize - ob->len; tmpsize *= 2)
+		/* nothing */ ;
+	if ((tmpbuf = realloc(ob->buf, tmpsize)) == NULL)
+		err(1, "realloc()");
+	ob->buf = tmpbuf;
+	ob->size = tmpsize;
+}
+
+static void
+outbuf_fini(struct outbuf *ob)
+{
+
+	outbuf_flush(ob);
+	free(ob->buf);
+	ob->buf = NULL;
+}
+
+/*
+ * Append data to the output buffer.  If the data won't fit, flush the
+ * buffer first, and if it won't fit in an empty buffer either, write it
+ * directly.
+ */
+static void
+outbuf_write(struct outbuf *ob, const char *p, size_t len)
+{
+
+	if (len > ob->size - ob->len) {
+		outbuf_room(ob, len);
+		if (len > ob->size - ob->len) {
+			writeall(ob->fd, ob->name, p, len);
+			ob->nwritten += len;
+			return;
+		}
+	}
+	memcpy(ob->buf + ob->len, p, len);
+	ob->len += len;
+}
+
+/*
+ * Append a span of unconverted input to the output buffer.  If it is
+ * long enough and comes from a mapped file, flush the buffer and copy
+ * the span from the input file to the output within the kernel.  If the
+ * kernel can not do that for this pair of files, give up on it and
+ * write the rest from the mapping.
+ */
+static void
+outbuf_span(struct outbuf *ob, const char *p, size_t len)
+{
+	ssize_t wlen;
+	off_t off;
+
+	if (ob->srcfd < 0 || len < copymin || p < ob->srcbase ||
+	    p >= ob->srcbase + ob->srcsize) {
+		outbuf_write(ob, p, len);
+		return;
+	}
+	outbuf_flush(ob);
+	off = p - ob->srcbase;
+	while (len > 0) {
+		errno = ENOSYS;
+		wlen = -1;
+#ifdef HAVE_SPLICE
+		if (ob->srcpipe)
+			wlen = splice(ob->srcfd, &off, ob->fd, NULL, len,
+			    SPLICE_F_MORE);
+#endif
+#ifdef HAVE_COPY_FILE_RANGE
+		if (!ob->srcpipe)
+			wlen = copy_file_range(ob->srcfd, &off, ob->fd, NULL,
+			    len, 0);
+#endif
+		if (wlen < 0 && errno == EINTR)
+			continue;
+		if (wlen <= 0) {
+			/* not supported, or the file shrank */
+			ob->srcfd = -1;
+			outbuf_write(ob, ob->srcbase + off, len);
+			return;
+		}
+		ob->nwritten += wlen;
+		len -= wlen;
+	}
+}
+
+/*
+ * Classify a single line and convert it into the scratch buffer if it is
+ * 8-bit or WTF-8.  Returns non-zero if it was converted.
+ */
+static int
+mixconv_line(cv_ctx *ctx, const char *line, size_t linelen,
+    const char *inname, struct outbuf *tmp, struct mcstats *ms)
+{
+	unsigned int conf;
+	size_t convlen;
+	int det;
+
+	tmp->len = 0;
+	outbuf_room(tmp, 3 * linelen + 1);
+	cv_fix(ctx, line, linelen, tmp->buf, &convlen);
+	if (convlen == (size_t)-1)
+		errx(1, "%s", inname);
+	if (convlen == 0)
+		return (0);
+	tmp->len = convlen;
+	if ((det = cv_detected(ctx, &conf)) >= 0) {
+		ms->detected[det]++;
+		ms->detconf[det] += conf;
+	}
+	if (opt_d) {
+		if (det >= 0)
+			fprintf(stderr, "%s (%u%%)\n",
+			    cv_candidate(ctx, det), conf);
+		fprintf(stderr, "<< ");
+		fwrite(line, 1, linelen, stderr);
+		if (line[linelen - 1] != '\n')
+			fprintf(stderr, "\n");
+		fprintf(stderr, ">> ");
+		fwrite(tmp->buf, 1, tmp->len, stderr);
+		if (tmp->buf[tmp->len - 1] != '\n')
+			fprintf(stderr, "\n");
+	}
+	return (1);
+}
+
+/*
+ * A line which is too long to fit in the input buffer is classified and
+ * converted piece by piece.  ASCII is the same in every encoding, so we
+ * write out pieces as they come while the line is pure ASCII, and as
+ * soon as we find that it is 8-bit, we can convert the rest as we go.
+ * Until then, whatever may have to be converted as WTF-8 or left alone
+ * is held back, in memory up to the size of the input buffer and in a
+ * temporary file beyond that, so memory use is bounded regardless of
+ * the length of the line.
+ */
+struct longline {
+	cv_nameclass nc;		/* class of the line so far */
+	uintmax_t len;			/* length of the line so far */
+	struct outbuf held;		/* held back; fd is the spill file */
+	FILE *spill;			/* spill file */
+	size_t max;			/* maximum amount held in memory */
+};
+
+static void
+longline_init(struct longline *ll)
+{
+
+	ll->nc = CV_NC_ASCII;
+	ll->len = 0;
+	outbuf_init(&ll->held, -1, "temporary file", 4096);
+	ll->spill = NULL;
+	ll->max = blksize;
+}
+
+static void
+longline_fini(struct longline *ll)
+{
+
+	ll->held.fd = -1;
+	outbuf_fini(&ll->held);
+	if (ll->spill != NULL)
+		fclose(ll->spill);
+}
+
+/*
+ * Return the length of the longest prefix of a piece of a long line
+ * that can be classified and converted by itself.  That is normally up
+ * to and including the last ASCII character, since that is a character
+ * boundary both in UTF-8 and in whatever WTF-8 decodes to.  Failing
+ * that, cut before the last UTF-8 lead byte, or not at all.
+ */
+static size_t
+longline_cut(const char *p, size_t len)
+{
+	const unsigned char *q = (const unsigned char *)p;
+	size_t i;
+
+	for (i = len; i > 0; --i)
+		if (q[i - 1] < 0x80)
+			return (i);
+	for (i = len; i > 1 && len - i < 4; --i)
+		if ((q[i - 1] & 0xc0) != 0x80)
+			return (i - 1);
+	return (len);
+}
+
+/*
+ * Convert a piece of a long line and write out the result.
+ */
+static void
+longline_conv(cv_ctx *ctx, cv_dir dir, const char *p, size_t len,
+    const char *inname, struct outbuf *ob, struct outbuf *tmp)
+{
+	size_t convlen;
+
+	outbuf_room(tmp, 3 * len + 1);
+	convlen = cv_convstr(ctx, dir, p, len, tmp->buf, tmp->size);
+	if (convlen == (size_t)-1)
+		errx(1, "%s", inname);
+	outbuf_write(ob, tmp->buf, convlen);
+}
+
+/*
+ * Write out what was held back, converting it unless the line turned
+ * out to be plain UTF-8.
+ */
+static void
+longline_release(cv_ctx *ctx, struct longline *ll, const char *inname,
+    struct outbuf *ob, struct outbuf *tmp)
+{
+	struct outbuf *held = &ll->held;
+	size_t len, used;
+	ssize_t rlen;
+	int eof;
+
+	if (ll->spill != NULL) {
+		/* read the spill file back in pieces */
+		outbuf_flush(held);
+		if (lseek(held->fd, 0, SEEK_SET) != 0)
+			err(1, "%s", held->name);
+		for (len = 0, eof = 0; !eof; len -= used) {
+			if ((rlen = read(held->fd, held->buf + len,
+			    held->size - len)) < 0)
+				err(1, "%s", held->name);
+			eof = (rlen == 0);
+			len += rlen;
+			used = eof ? len : longline_cut(held->buf, len);
+			if (ll->nc == CV_NC_UTF8)
+				outbuf_write(ob, held->buf, used);
+			else
+				longline_conv(ctx,
+				    ll->nc == CV_NC_WTF8 ? CV_REV : CV_FWD,
+				    held->buf, used, inname, ob, tmp);
+			memmove(held->buf, held->buf + used, len - used);
+		}
+		fclose(ll->spill);
+		ll->spill = NULL;
+		held->fd = -1;
+	} else if (ll->nc == CV_NC_UTF8) {
+		outbuf_write(ob, held->buf, held->len);
+	} else {
+		longline_conv(ctx, ll->nc == CV_NC_WTF8 ? CV_REV : CV_FWD,
+		    held->buf, held->len, inname, ob, tmp);
+	}
+	held->len = 0;
+}
+
+/*
+ * Process the next piece of a long line, which must have been cut by
+ * longline_cut() unless it is the last.
+ */
+static void
+longline_feed(cv_ctx *ctx, struct longline *ll, const char *p,
+    size_t len, const char *inname, struct outbuf *ob, struct outbuf *tmp)
+{
+	struct outbuf *held = &ll->held;
+	cv_nameclass nc;
+
+	ll->len += len;
+	if (ll->nc != CV_NC_8BIT) {
+		nc = cv_classify_wtf(ctx, p, len);
+		if (nc == CV_NC_ASCII && ll->nc == CV_NC_ASCII) {
+			outbuf_span(ob, p, len);
+			return;
+		}
+		if (nc != CV_NC_8BIT) {
+			if (nc == CV_NC_UTF8 || ll->nc == CV_NC_ASCII)
+				ll->nc = nc;
+			if (ll->spill == NULL && held->len + len > ll->max) {
+				if ((ll->spill = tmpfile()) == NULL)
+					err(1, "tmpfile()");
+				held->fd = fileno(ll->spill);
+			}
+			outbuf_write(held, p, len);
+			return;
+		}
+		/* everything held back so far is 8-bit too */
+		ll->nc = CV_NC_8BIT;
+		longline_release(ctx, ll, inname, ob, tmp);
+	}
+	longline_conv(ctx, CV_FWD, p, len, inname, ob, tmp);
+}
+
+/*
+ * Finish a long line.
+ */
+static void
+longline_end(cv_ctx *ctx, struct longline *ll, const char *inname,
+    struct outbuf *ob, struct outbuf *tmp, struct mcstats *ms)
+{
+
+	if (ll->nc == CV_NC_UTF8 || ll->nc == CV_NC_WTF8)
+		longline_release(ctx, ll, inname, ob, tmp);
+	ms->lines++;
+	if (ll->nc == CV_NC_8BIT || ll->nc == CV_NC_WTF8)
+		ms->convlines++;
+	if (opt_d)
+		fprintf(stderr, "long line, %ju bytes, %s\n", ll->len,
+		    ll->nc == CV_NC_8BIT ? "8-bit" : ll->nc == CV_NC_WTF8 ?
+		    "WTF-8" : "not converted");
+	ll->nc = CV_NC_ASCII;
+	ll->len = 0;
+}
+
+/*
+ * Process all complete lines in a block of input, and the final
+ * incomplete line as well if we have reached the end of the input.
+ * Consecutive lines that do not require conversion are copied to the
+ * output buffer in a single operation.  Returns the number of bytes
+ * consumed.
+ */
+static size_t
+mixconv_block(cv_ctx *ctx, const char *buf, size_t len, int eof,
+    const char *inname, struct outbuf *ob, struct outbuf *tmp,
+    struct mcstats *ms)
+{
+	struct longline ll;
+	const char *end, *eol, *p, *q, *span;
+	size_t n;
+
+	end = buf + len;
+	for (span = p = buf; p < end; p = eol) {
+		if ((eol = memchr(p, '\n', end - p)) != NULL)
+			eol++;
+		else if (eof)
+			eol = end;
+		else
+			break;
+		if ((size_t)(eol - p) > blksize) {
+			/* too long to convert in one go */
+			outbuf_span(ob, span, p - span);
+			longline_init(&ll);
+			for (q = p; q < eol; q += n) {
+				n = eol - q;
+				if (n > blksize)
+					n = longline_cut(q, blksize);
+				longline_feed(ctx, &ll, q, n, inname, ob, tmp);
+			}
+			longline_end(ctx, &ll, inname, ob, tmp, ms);
+			longline_fini(&ll);
+			span = eol;
+			continue;
+		}
+		ms->lines++;
+		if (mixconv_line(ctx, p, eol - p, inname, tmp, ms)) {
+			/* conversion required */
+			ms->convlines++;
+			outbuf_span(ob, span, p - span);
+			outbuf_write(ob, tmp->buf, tmp->len);
+			span = eol;
+		}
+	}
+	/* no conversion necessary */
+	outbuf_span(ob, span, p - span);
+	return (p - buf);
+}
+
+/*
+ * Convert a regular file by mapping it into memory, so that clean spans
+ * can be passed through by outbuf_span() without ever being copied to
+ * user space.  Returns 0 if the input can not be mapped or the output
+ * is neither a regular file nor a pipe.
+ */
+static int
+mixconv_mapped(cv_ctx *ctx, int infd, const char *inname,
+    struct outbuf *ob, struct mcstats *ms)
+{
+	struct outbuf tmp;
+	struct stat st;
+	void *base;
+
+	if (ob->fd < 0 || fstat(ob->fd, &st) != 0 ||
+	    (!S_ISREG(st.st_mode) && !S_ISFIFO(st.st_mode)))
+		return (0);
+	ob->srcpipe = S_ISFIFO(st.st_mode);
+	if (fstat(infd, &st) != 0 || !S_ISREG(st.st_mode) ||
+	    st.st_size == 0 || (uintmax_t)st.st_size > SIZE_MAX)
+		return (0);
+	base = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, infd, 0);
+	if (base == MAP_FAILED)
+		return (0);
+	(void)madvise(base, st.st_size, MADV_SEQUENTIAL);
+	ob->srcfd = infd;
+	ob->srcbase = base;
+	ob->srcsize = st.st_size;
+	outbuf_init(&tmp, -1, NULL, 4096);
+	ms->nread += st.st_size;
+	mixconv_block(ctx, base, st.st_size, 1, inname, ob, &tmp, ms);
+	outbuf_fini(&tmp);
+	ob->srcfd = -1;
+	munmap(base, st.st_size);
+	return (1);
+}
+
+/*
+ * Convert a file that contains a mix of ISO8859-1, UTF-8 and WTF-8
+ * (UTF-8 which was mistaken for ISO8859-1 and encoded again) to clean
+ * UTF-8, assuming that each line uses one encoding or another.
  *
- * We read the input one line at a time and inspect each line byte by
- * byte.  If a byte has bit 7 set and neither of its neighbors do, we
- * assume that the line is encoded in ISO8859-1, and recode it.
- * Otherwise, we assume that the line is either plain ASCII or UTF-8 and
- * output it as-is.
+ * All three encodings have 7-bit ASCII as a common subset.  ISO8859-1
+ * has 96 additional characters, all of which have bit 7 set; UTF-8, on
+ * the other hand, encodes non-ASCII characters as sequences of two to
+ * four bytes, each of which has bit 7 set, following strict rules which
+ * random ISO8859-1 text is very unlikely to obey.
  *
- * Caveat: an ISO8859-1-encoded line that contains multiple consecutive
- * non-ASCII characters but no isolated non-ASCII characters will be
- * incorrectly classified as UTF-8.
+ * We read the input in large blocks and inspect it one line at a time.
+ * If a line is not valid UTF-8, we assume that it is encoded in
+ * ISO8859-1, and recode it.  If it is valid UTF-8, and converting it to
+ * ISO8859-1 yields valid UTF-8, we assume that it is WTF-8, and output
+ * the result of that conversion.  Otherwise, we assume that the line is
+ * either plain ASCII or UTF-8 and output it as-is.  cv_fix() does all of
+ * this in a single pass over the line.  An incomplete line at the end
+ * of a block is moved to the front of the buffer and completed by the
+ * next read; if a single line does not fit in the buffer, it is
+ * processed piece by piece instead (see struct longline).
+ *
+ * If the input is a regular file and the output is a regular file or a
+ * pipe, we map the input instead and let the kernel copy the spans that
+ * need no conversion; see mixconv_mapped().
  */
 static void
-mixconv(iconv_t conv,
-    FILE *infile, const char *inname, FILE *outfile, const char *outname)
-{
-	char *linebuf;		/* line buffer */
-	size_t linesize;	/* size of line buffer */
-	ssize_t linelen;	/* length of current line */
-	unsigned int prev3;	/* bitmap of previous 3 bytes */
-	char convbuf[80];	/* conversion output buffer */
-	char *cip, *cop;	/* conversion in / out buffer pointers */
-	size_t cilen, colen;	/* conversion in / out buffer lengths */
-	size_t convlen;		/* conversion length */
-	int i;
-
-	linebuf = NULL;
-	linesize = 0;
-	while ((linelen = getline(&linebuf, &linesize, infile)) > 0) {
+mixconv(cv_ctx *ctx, int infd, const char *inname, struct outbuf *ob,
+    struct mcstats *ms)
+{
+	char *buf;		/* input buffer */
+	const char *eol;	/* end of long line */
+	size_t size;		/* size of input buffer */
+	size_t len;		/* amount of data in input buffer */
+	size_t used;		/* amount of data processed */
+	size_t want;		/* amount of data requested */
+	ssize_t rlen;		/* length of last read */
+	struct outbuf tmp;	/* converted line */
+	struct longline ll;	/* line that does not fit */
+	int eof, inlong;
+
+	if (mixconv_mapped(ctx, infd, inname, ob, ms))
+		return;
+	outbuf_init(&tmp, -1, NULL, 4096);
+	longline_init(&ll);
+	size = blksize;
+	if ((errno = posix_memalign((void **)&buf, 4096, size)) != 0)
+		err(1, "posix_memalign()");
+	for (len = 0, eof = 0, inlong = 0; !eof; ) {
+		if (len == size) {
+			/* the current line does not fit, stream it */
+			used = longline_cut(buf, len);
+			longline_feed(ctx, &ll, buf, used, inname, ob, &tmp);
+			memmove(buf, buf + used, len - used);
+			len -= used;
+			inlong = 1;
+		}
+		want = size - len;
+		if ((rlen = read(infd, buf + len, want)) < 0) {
+			if (errno == EINTR)
+				continue;
+			err(1, "%s", inname);
+		}
+		eof = (rlen == 0);
+		ms->nread += rlen;
 		/*
-		 * The lower three bits of prev3 are copies of bit 7 of
-		 * the current and previous two characters.  If at any
-		 * time the value of these bits is 010, we have found an
-		 * isolated non-ASCII character, which can only occur in a
-		 * single-byte 8-bit encoding such as ISO8859-1.
-		 *
-		 * We include the terminating null character in order to
-		 * properly detect a non-ASCII character at the end of a
-		 * file that lacks a final newline character.
+		 * Don't bother looking for complete lines unless we just
+		 * read one.
 		 */
-		for (i = 0, prev3 = 0; i <= linelen && prev3 != 0x02; ++i)
-			prev3 = (prev3 << 1 & 0x07) |
-			    (unsigned char)linebuf[i] >> 7;
-		if (prev3 != 0x2) {
-			/* no conversion necessary */
-			if (fprintf(outfile, "%s", linebuf) < 0)
-				err(1, "%s", outname);
+		if (!eof && (size_t)rlen < want &&
+		    memchr(buf + len, '\n', rlen) == NULL) {
+			len += rlen;
 			continue;
 		}
-		/* conversion required */
-		if (opt_d) {
-			fprintf(stderr, "<< %s", linebuf);
-			if (linelen == 0 || linebuf[linelen - 1] != '\n')
-				fprintf(stderr, "\n");
-			fprintf(stderr, ">> ");
+		len += rlen;
+		if (inlong) {
+			/* finish the long line if we have the end of it */
+			if ((eol = memchr(buf, '\n', len)) == NULL && !eof)
+				continue;
+			used = eol != NULL ? (size_t)(eol + 1 - buf) : len;
+			longline_feed(ctx, &ll, buf, used, inname, ob, &tmp);
+			longline_end(ctx, &ll, inname, ob, &tmp, ms);
+			memmove(buf, buf + used, len - used);
+			len -= used;
+			inlong = 0;
 		}
-		/* reset conversion state */
-		iconv(conv, NULL, NULL, NULL, NULL);
-		cip = linebuf;
-		cilen = linelen;
-		do {
-			/* repeatedly convert as much as we have room for */
-			cop = convbuf;
-			colen = sizeof(convbuf) - 1;
-			convlen = iconv(conv, &cip, &cilen, &cop, &colen);
-			if (convlen == (size_t)-1 && errno != E2BIG)
-				errx(1, "%s", inname);
-			*cop = '\0';
-			if (fprintf(outfile, "%s", convbuf) < 0)
-				err(1, "%s", outname);
-			if (opt_d)
-				fprintf(stderr, "%s", convbuf);
-		} while (convlen == (size_t)-1);
-		if (opt_d)
-			if (linelen == 0 || linebuf[linelen - 1] != '\n')
-				fprintf(stderr, "\n");
+		used = mixconv_block(ctx, buf, len, eof, inname, ob, &tmp,
+		    ms);
+		memmove(buf, buf + used, len - used);
+		len -= used;
+		/*
+		 * A short read means that the input is trickling in from
+		 * a pipe or terminal; pass the output along right away.
+		 */
+		if (!eof && (size_t)rlen < want)
+			outbuf_flush(ob);
 	}
-	free(linebuf);
-	if (linelen < 0 && ferror(infile))
+	longline_fini(&ll);
+	outbuf_fini(&tmp);
+	free(buf);
+}
+
+/*
+ * Multi-threaded conversion of one or more files.
+ *
+ * Regular files are mapped into memory and split into chunks of at most
+ * the chunk size, each of which ends at a line boundary; a chunk never
+ * spans two files, so a file smaller than the chunk size is a single
+ * chunk.  A line which is longer than that is a chunk of its own, which
+ * the main thread converts piece by piece straight to the output when
+ * its turn comes, like a pipe (see below), so that no worker ever has
+ * to hold it, or its conversion, in memory.
+ * The worker threads take turns grabbing the next chunk and converting
+ * it into a private output buffer using a private conversion context,
+ * since conversion contexts can not be shared.  The main thread writes
+ * out the converted chunks in order as they become available, so the
+ * output is the same as if the files had been converted one after the
+ * other.
+ *
+ * Completed chunks are kept in a reorder buffer with room for twice as
+ * many chunks as there are threads.  A worker will not start a new chunk
+ * until there is room for it, which bounds the amount of memory used.
+ * Files are only opened once the workers get to them, and unmapped once
+ * their last chunk has been written, so the number of files open at any
+ * one time is bounded as well.  Chunks are carved out by one worker at a
+ * time, but without holding the lock, so that opening a file does not
+ * hold up the other workers or the main thread.
+ *
+ * Input which can not be mapped, such as a pipe, is represented by a
+ * single empty chunk, and converted by the main thread when its turn
+ * comes, while the workers carry on with the files that follow it.  A
+ * file which could not be opened is dealt with the same way, so that
+ * the error is reported after the output for the files that precede it.
+ */
+struct mtfile {
+	const char *name;	/* input file name */
+	int fd;			/* input file descriptor, or -1 */
+	int err;		/* errno from open(2), if it failed */
+	const char *base;	/* mapped input, or NULL */
+	size_t size;		/* size of mapped input */
+};
+
+struct mtchunk {
+	struct mtfile *file;	/* file it belongs to */
+	const char *buf;	/* start of chunk, or NULL if not mapped */
+	size_t len;		/* length of chunk */
+	int stream;		/* a single overlong line */
+	int last;		/* last chunk of its file */
+	struct outbuf ob;	/* converted output */
+	int done;		/* conversion complete */
+};
+
+struct mtstate {
+	pthread_mutex_t mtx;
+	pthread_cond_t cond;
+	struct mtfile *files;	/* input files */
+	unsigned int nfiles;	/* number of input files */
+	unsigned int cur;	/* file currently being split */
+	size_t next;		/* offset of next chunk in that file */
+	int carving;		/* a worker is carving out a chunk */
+	unsigned long nchunks;	/* number of chunks handed out */
+	unsigned long nwritten;	/* number of chunks written */
+	struct mtchunk *slots;	/* reorder buffer */
+	unsigned int nslots;	/* size of reorder buffer */
+};
+
+/*
+ * Open an input file and map it into memory if possible.
+ */
+static void
+mixconv_mt_open(struct mtfile *f)
+{
+	struct stat st;
+	void *base;
+
+	if ((f->fd = open(f->name, O_RDONLY)) < 0) {
+		f->err = errno;
+		return;
+	}
+	if (fstat(f->fd, &st) != 0 || !S_ISREG(st.st_mode) ||
+	    st.st_size == 0 || (uintmax_t)st.st_size > SIZE_MAX)
+		return;
+	base = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, f->fd, 0);
+	if (base == MAP_FAILED)
+		return;
+	(void)madvise(base, st.st_size, MADV_SEQUENTIAL);
+	close(f->fd);
+	f->fd = -1;
+	f->base = base;
+	f->size = st.st_size;
+}
+
+/*
+ * Carve out the next chunk, opening the next file if necessary, and
+ * return the position of the chunk after it in *cur and *next.  Called
+ * without the lock, which can be held up by opening the file and looking
+ * for the end of the chunk, but by only one worker at a time; see
+ * mixconv_mt_worker().
+ */
+static void
+mixconv_mt_carve(struct mtstate *mt, struct mtchunk *chunk,
+    unsigned int *cur, size_t *next)
+{
+	struct mtfile *f;
+	const char *nl;
+	size_t end;
+
+	f = &mt->files[mt->cur];
+	if (mt->next == 0)
+		mixconv_mt_open(f);
+	chunk->file = f;
+	if (f->base == NULL) {
+		/* left to the main thread */
+		chunk->buf = NULL;
+		chunk->len = 0;
+		end = f->size;
+	} else {
+		chunk->stream = 0;
+		end = mt->next + chunksize;
+		if (end >= f->size) {
+			end = f->size;
+		} else {
+			/* end the chunk after the last complete line */
+			for (nl = f->base + end; nl > f->base + mt->next &&
+			    nl[-1] != '\n'; --nl)
+				/* nothing */;
+			if (nl > f->base + mt->next) {
+				end = nl - f->base;
+			} else {
+				/* a line longer than a chunk */
+				chunk->stream = 1;
+				nl = memchr(f->base + end, '\n', f->size - end);
+				end = nl != NULL ?
+				    (size_t)(nl - f->base) + 1 : f->size;
+			}
+		}
+		chunk->buf = f->base + mt->next;
+		chunk->len = end - mt->next;
+	}
+	if ((chunk->last = (end == f->size))) {
+		*cur = mt->cur + 1;
+		*next = 0;
+	} else {
+		*cur = mt->cur;
+		*next = end;
+	}
+}
+
+static void *
+mixconv_mt_worker(void *arg)
+{
+	struct mtstate *mt = arg;
+	struct mtchunk *chunk;
+	struct mcstats ms;
+	struct outbuf tmp;
+	unsigned int cur;
+	size_t next;
+	cv_ctx *ctx;
+
+	if ((ctx = cv_open(enc8, 0)) == NULL)
+		err(1, "could not initialize conversion");
+	memset(&ms, 0, sizeof ms);
+	outbuf_init(&tmp, -1, NULL, 4096);
+	pthread_mutex_lock(&mt->mtx);
+	for (;;) {
+		/* wait for our turn and for room in the reorder buffer */
+		while (mt->carving || (mt->cur < mt->nfiles &&
+		    mt->nchunks >= mt->nwritten + mt->nslots))
+			pthread_cond_wait(&mt->cond, &mt->mtx);
+		if (mt->cur == mt->nfiles)
+			break;
+		chunk = &mt->slots[mt->nchunks % mt->nslots];
+		mt->carving = 1;
+		pthread_mutex_unlock(&mt->mtx);
+		mixconv_mt_carve(mt, chunk, &cur, &next);
+		pthread_mutex_lock(&mt->mtx);
+		mt->cur = cur;
+		mt->next = next;
+		mt->nchunks++;
+		mt->carving = 0;
+		pthread_cond_broadcast(&mt->cond);
+		if (chunk->buf != NULL && !chunk->stream) {
+			/* convert it */
+			pthread_mutex_unlock(&mt->mtx);
+			chunk->ob.len = 0;
+			mixconv_block(ctx, chunk->buf, chunk->len, 1,
+			    chunk->file->name, &chunk->ob, &tmp, &ms);
+			pthread_mutex_lock(&mt->mtx);
+		}
+		chunk->done = 1;
+		pthread_cond_broadcast(&mt->cond);
+	}
+	mcstats_add(&stats, &ms);
+	pthread_mutex_unlock(&mt->mtx);
+	outbuf_fini(&tmp);
+	cv_close(ctx);
+	return (NULL);
+}
+
+/*
+ * Convert a list of files using multiple threads, and write the result
+ * to the output buffer in order.
+ */
+static void
+mixconv_mt(cv_ctx *ctx, char **names, unsigned int nfiles,
+    struct outbuf *ob)
+{
+	struct mtstate mt;
+	struct mtchunk *chunk;
+	struct mtfile *f;
+	struct mcstats ms;
+	struct outbuf tmp;
+	pthread_t *thr;
+	unsigned int i;
+
+	memset(&ms, 0, sizeof ms);
+	memset(&mt, 0, sizeof mt);
+	outbuf_init(&tmp, -1, NULL, 4096);
+	pthread_mutex_init(&mt.mtx, NULL);
+	pthread_cond_init(&mt.cond, NULL);
+	if ((mt.files = calloc(nfiles, sizeof *mt.files)) == NULL)
+		err(1, "calloc()");
+	for (i = 0; i < nfiles; ++i) {
+		mt.files[i].name = names[i];
+		mt.files[i].fd = -1;
+	}
+	mt.nfiles = nfiles;
+	mt.nslots = 2 * opt_j;
+	if ((mt.slots = calloc(mt.nslots, sizeof *mt.slots)) == NULL ||
+	    (thr = calloc(opt_j, sizeof *thr)) == NULL)
+		err(1, "calloc()");
+	for (i = 0; i < mt.nslots; ++i)
+		outbuf_init(&mt.slots[i].ob, -1, NULL,
+		    chunksize + chunksize / 4);
+	for (i = 0; i < opt_j; ++i)
+		if ((errno = pthread_create(&thr[i], NULL,
+		    mixconv_mt_worker, &mt)) != 0)
+			err(1, "pthread_create()");
+
+	/* write out chunks in order */
+	outbuf_flush(ob);
+	pthread_mutex_lock(&mt.mtx);
+	for (;;) {
+		chunk = &mt.slots[mt.nwritten % mt.nslots];
+		while (!chunk->done &&
+		    !(mt.nwritten == mt.nchunks && mt.cur == mt.nfiles))
+			pthread_cond_wait(&mt.cond, &mt.mtx);
+		if (!chunk->done)
+			break;
+		pthread_mutex_unlock(&mt.mtx);
+		f = chunk->file;
+		if (f->err != 0) {
+			errno = f->err;
+			err(1, "%s", f->name);
+		} else if (chunk->buf == NULL) {
+			mixconv(ctx, f->fd, f->name, ob, &ms);
+			outbuf_flush(ob);
+		} else if (chunk->stream) {
+			mixconv_block(ctx, chunk->buf, chunk->len, 1,
+			    f->name, ob, &tmp, &ms);
+			outbuf_flush(ob);
+		} else {
+			writeall(ob->fd, ob->name, chunk->ob.buf,
+			    chunk->ob.len);
+			ob->nwritten += chunk->ob.len;
+		}
+		if (chunk->last) {
+			if (f->base != NULL) {
+				munmap((void *)(uintptr_t)f->base, f->size);
+				ms.nread += f->size;
+			}
+			if (f->fd >= 0)
+				close(f->fd);
+		}
+		pthread_mutex_lock(&mt.mtx);
+		chunk->done = 0;
+		mt.nwritten++;
+		pthread_cond_broadcast(&mt.cond);
+	}
+	pthread_mutex_unlock(&mt.mtx);
+
+	for (i = 0; i < opt_j; ++i)
+		pthread_join(thr[i], NULL);
+	mcstats_add(&stats, &ms);
+	outbuf_fini(&tmp);
+	for (i = 0; i < mt.nslots; ++i)
+		free(mt.slots[i].ob.buf);
+	free(mt.slots);
+	free(mt.files);
+	free(thr);
+	pthread_cond_destroy(&mt.cond);
+	pthread_mutex_destroy(&mt.mtx);
+}
+
+/*
+ * Convert a list of files into separate output files in a directory,
+ * each named after the last component of its input file's name.  Each
+ * thread takes one file at a time and converts it as a stream, so there
+ * is nothing to buffer and nothing to wait for.
+ */
+struct odstate {
+	pthread_mutex_t mtx;
+	char **names;		/* input files */
+	unsigned int nfiles;	/* number of input files */
+	unsigned int next;	/* next file to convert */
+	int dirfd;		/* output directory */
+};
+
+static const char *
+outdir_name(const char *inname)
+{
+	const char *p;
+
+	if ((p = strrchr(inname, '/')) != NULL)
+		p++;
+	else
+		p = inname;
+	return (p);
+}
+
+/*
+ * Open an output file without truncating it, so that we can first make
+ * sure it is not one of the input files, which the caller must already
+ * have opened or looked at.
+ */
+static int
+outfile_open(int dirfd, const char *name, const char *display,
+    struct stat *st)
+{
+	int fd;
+
+	if ((fd = openat(dirfd, name, O_WRONLY | O_CREAT, 0666)) < 0 ||
+	    fstat(fd, st) != 0)
+		err(1, "%s", display);
+	return (fd);
+}
+
+static void
+outfile_truncate(int fd, const struct stat *st, const char *display)
+{
+
+	if (S_ISREG(st->st_mode) && ftruncate(fd, 0) != 0)
+		err(1, "%s", display);
+}
+
+#define SAME_FILE(a, b) \
+	((a)->st_dev == (b)->st_dev && (a)->st_ino == (b)->st_ino)
+
+static void
+mixconv_outdir_file(cv_ctx *ctx, struct odstate *od, const char *inname,
+    struct mcstats *ms)
+{
+	struct stat ist, ost;
+	struct outbuf ob;
+	const char *name;
+	char display[PATH_MAX];
+	int infd, outfd;
+
+	name = outdir_name(inname);
+	snprintf(display, sizeof display, "%s/%s", opt_O, name);
+	if ((infd = open(inname, O_RDONLY)) < 0 || fstat(infd, &ist) != 0)
 		err(1, "%s", inname);
+	outfd = outfile_open(od->dirfd, name, display, &ost);
+	if (SAME_FILE(&ist, &ost))
+		errx(1, "%s: would overwrite its own input", inname);
+	outfile_truncate(outfd, &ost, display);
+	outbuf_init(&ob, outfd, name, blksize);
+	mixconv(ctx, infd, inname, &ob, ms);
+	outbuf_fini(&ob);
+	ms->nwritten += ob.nwritten;
+	if (close(outfd) != 0)
+		err(1, "%s", display);
+	close(infd);
+}
+
+static void *
+mixconv_outdir_worker(void *arg)
+{
+	struct odstate *od = arg;
+	struct mcstats ms;
+	unsigned int i;
+	cv_ctx *ctx;
+
+	if ((ctx = cv_open(enc8, 0)) == NULL)
+		err(1, "could not initialize conversion");
+	memset(&ms, 0, sizeof ms);
+	for (;;) {
+		pthread_mutex_lock(&od->mtx);
+		i = od->next < od->nfiles ? od->next++ : od->nfiles;
+		pthread_mutex_unlock(&od->mtx);
+		if (i == od->nfiles)
+			break;
+		mixconv_outdir_file(ctx, od, od->names[i], &ms);
+	}
+	pthread_mutex_lock(&od->mtx);
+	mcstats_add(&stats, &ms);
+	pthread_mutex_unlock(&od->mtx);
+	cv_close(ctx);
+	return (NULL);
+}
+
+static int
+outdir_cmp(const void *a, const void *b)
+{
+
+	return (strcmp(outdir_name(*(char *const *)a),
+	    outdir_name(*(char *const *)b)));
+}
+
+static void
+mixconv_outdir(char **names, unsigned int nfiles)
+{
+	struct odstate od;
+	pthread_t *thr;
+	char **sorted;
+	unsigned int i, nthr;
+
+	/* refuse to write two files to the same output */
+	if ((sorted = calloc(nfiles, sizeof *sorted)) == NULL)
+		err(1, "calloc()");
+	memcpy(sorted, names, nfiles * sizeof *sorted);
+	qsort(sorted, nfiles, sizeof *sorted, outdir_cmp);
+	for (i = 0; i < nfiles; ++i) {
+		if (*outdir_name(sorted[i]) == '\0')
+			errx(1, "%s: not a file name", sorted[i]);
+		if (i > 0 && outdir_cmp(&sorted[i - 1], &sorted[i]) == 0)
+			errx(1, "%s and %s would both be written to %s/%s",
+			    sorted[i - 1], sorted[i], opt_O,
+			    outdir_name(sorted[i]));
+	}
+	free(sorted);
+
+	memset(&od, 0, sizeof od);
+	pthread_mutex_init(&od.mtx, NULL);
+	od.names = names;
+	od.nfiles = nfiles;
+	if ((od.dirfd = open(opt_O, O_RDONLY | O_DIRECTORY)) < 0)
+		err(1, "%s", opt_O);
+	nthr = opt_j < nfiles ? opt_j : nfiles;
+	if ((thr = calloc(nthr, sizeof *thr)) == NULL)
+		err(1, "calloc()");
+	for (i = 1; i < nthr; ++i)
+		if ((errno = pthread_create(&thr[i], NULL,
+		    mixconv_outdir_worker, &od)) != 0)
+			err(1, "pthread_create()");
+	mixconv_outdir_worker(&od);
+	for (i = 1; i < nthr; ++i)
+		pthread_join(thr[i], NULL);
+	free(thr);
+	close(od.dirfd);
+	pthread_mutex_destroy(&od.mtx);
 }
 
 static char test_input[] = {
@@ -155,6 +1145,11 @@ static char test_input[] = {
 	0x0a,
 	0x73, 0xe5,
 	0x0a,
+	0x62, 0x6c, 0xe5, 0xe6, 0xf8, 0x72, 0x6b,
+	0x0a,
+	0x62, 0x6c, 0xc3, 0x83, 0xc2, 0xa5, 0x62, 0xc3, 0x83, 0xc2, 0xa6,
+	0x72,
+	0x0a,
 	0xf8,
 	0x0a,
 	0xe5,
@@ -169,35 +1164,249 @@ static char test_output[] =
     "stø\n"
     "ås\n"
     "så\n"
+    "blåæørk\n"
+    "blåbær\n"
     "ø\n"
     "å";
 
-static void
-self_test(iconv_t conv)
-{
-	FILE *infile, *outfile;
-	char outbuf[1024];
-
-	printf("1..%d\n", 1);
-	if ((infile = fmemopen(test_input, sizeof test_input, "r")) == NULL)
-		err(1, "fmemopen()");
-	if ((outfile = fmemopen(outbuf, sizeof outbuf, "w")) == NULL)
-		err(1, "fmemopen()");
-	setbuf(outfile, NULL);
-	mixconv(conv, infile, "test input", outfile, "test output");
-	fclose(infile);
-	fclose(outfile);
-	if (memcmp(outbuf, test_output, sizeof test_output) != 0)
-		printf("not ok %d\n", 1);
-	else
-		printf("ok %d\n", 1);
+/*
+ * Lines in four different 8-bit encodings, the index of the encoding in
+ * the candidate list that should be detected for each, and the expected
+ * result of converting them.
+ */
+static const char *test_detect_list =
+    "iso8859-1,cp1252,iso8859-15,koi8-r";
+
+static const struct {
+	const char *in;
+	int cand;
+	const char *out;
+} test_detect[] = {
+	{ "Bl\xe5" "b\xe6r og r\xf8" "dgr\xf8" "d gr\xf8t med fl\xf8te", 0,
+	  "Blåbær og rødgrød grøt med fløte" },
+	{ "\x93Quoted\x94 text \x96 with dashes", 1,
+	  "“Quoted” text – with dashes" },
+	{ "Price 10\xa4 only", 2,
+	  "Price 10€ only" },
+	{ "\xf0\xd2\xc9\xd7\xc5\xd4, \xcb\xc1\xcb \xc4\xc5\xcc\xc1?", 3,
+	  "Привет, как дела?" },
+	{ "Stra\xdf" "e f\xfcr M\xfcller", 0,
+	  "Straße für Müller" },
+};
+
+/*
+ * Run the conversion test, feeding the test input through a pipe in
+ * blocks of the specified size, or, in multi-threaded mode, from the
+ * specified number of copies of a temporary file in chunks of the
+ * specified size.  With more than one copy, an empty input which can
+ * not be mapped is slipped in after the first.  With no threads at all,
+ * the input is read from a temporary file, and clean spans of at least
+ * the specified size are copied within the kernel.
+ */
+static int
+self_test_mixconv(cv_ctx *ctx, size_t bs, unsigned int nthr,
+    unsigned int ncopies)
+{
+	struct outbuf ob;
+	char outbuf[1024], path[] = "/tmp/mixconv.XXXXXX";
+	char *names[8];
+	int infd[2], outfd[2], fd;
+	unsigned int i, n;
+	ssize_t rlen;
+
+	if (pipe(outfd) != 0)
+		err(1, "pipe()");
+	outbuf_init(&ob, outfd[1], "test output", MIXCONV_BLKSIZE);
+	if (nthr != 1) {
+		if ((fd = mkstemp(path)) < 0)
+			err(1, "mkstemp()");
+		writeall(fd, "test input", test_input, sizeof test_input);
+		close(fd);
+	}
+	if (nthr == 0) {
+		if ((fd = open(path, O_RDONLY)) < 0)
+			err(1, "%s", path);
+		copymin = bs;
+		mixconv(ctx, fd, "test input", &ob, &stats);
+		copymin = MIXCONV_COPYMIN;
+		close(fd);
+		unlink(path);
+	} else if (nthr > 1) {
+		for (i = n = 0; i < ncopies; ++i) {
+			names[n++] = path;
+			if (i == 0 && ncopies > 1)
+				names[n++] = (char *)(uintptr_t)"/dev/null";
+		}
+		opt_j = nthr;
+		chunksize = bs;
+		mixconv_mt(ctx, names, n, &ob);
+		chunksize = MIXCONV_CHUNKSIZE;
+		opt_j = 1;
+		unlink(path);
+	} else {
+		if (pipe(infd) != 0)
+			err(1, "pipe()");
+		writeall(infd[1], "test input",
+		    test_input, sizeof test_input);
+		close(infd[1]);
+		blksize = bs;
+		mixconv(ctx, infd[0], "test input", &ob, &stats);
+		blksize = MIXCONV_BLKSIZE;
+		close(infd[0]);
+	}
+	outbuf_fini(&ob);
+	close(outfd[1]);
+	rlen = read(outfd[0], outbuf, sizeof outbuf);
+	close(outfd[0]);
+	if (rlen != (ssize_t)(ncopies * sizeof test_output))
+		return (0);
+	for (i = 0; i < ncopies; ++i)
+		if (memcmp(outbuf + i * sizeof test_output, test_output,
+		    sizeof test_output) != 0)
+			return (0);
+	return (1);
+}
+
+/*
+ * Check that each of the detection test lines is attributed to the
+ * right candidate and converted accordingly.
+ */
+static int
+self_test_detect(void)
+{
+	char out[256];
+	size_t i, len, outlen;
+	cv_ctx *ctx;
+	int ok;
+
+	if ((ctx = cv_open(test_detect_list, 0)) == NULL)
+		return (0);
+	for (i = 0, ok = 1; ok && i < sizeof test_detect / sizeof *test_detect;
+	    ++i) {
+		len = strlen(test_detect[i].in);
+		ok = cv_fix(ctx, test_detect[i].in, len, out, &outlen) ==
+		    CV_NC_8BIT &&
+		    cv_detected(ctx, NULL) == test_detect[i].cand &&
+		    outlen == strlen(test_detect[i].out) &&
+		    memcmp(out, test_detect[i].out, outlen) == 0;
+	}
+	cv_close(ctx);
+	return (ok);
+}
+
+/*
+ * Compare the built-in transcoding tables to iconv, and check that each
+ * character survives a round trip.
+ */
+static int
+self_test_cstab(void)
+{
+	const char *const *charsets;
+	char in[2], tabout[8], icout[8], back[8];
+	size_t tablen, iclen;
+	cv_ctx *tab, *ic;
+	unsigned int b;
+	int ok;
+
+	for (charsets = cv_charsets(), ok = 1; ok && *charsets; ++charsets) {
+		if ((tab = cv_open(*charsets, 0)) == NULL)
+			return (0);
+		if ((ic = cv_open(*charsets, CV_ICONV)) == NULL) {
+			cv_close(tab);
+			continue;
+		}
+		ok = cv_tabled(tab);
+		for (b = 0; ok && b < 256; ++b) {
+			in[0] = b;
+			tablen = cv_convstr(tab, CV_FWD, in, 1,
+			    tabout, sizeof tabout);
+			iclen = cv_convstr(ic, CV_FWD, in, 1,
+			    icout, sizeof icout);
+			if (tablen != iclen ||
+			    (tablen != (size_t)-1 &&
+			    memcmp(tabout, icout, tablen) != 0)) {
+				ok = 0;
+				break;
+			}
+			if (tablen != (size_t)-1)
+				ok = cv_convstr(tab, CV_REV, tabout, tablen,
+				    back, sizeof back) == 1 && back[0] == in[0];
+		}
+		cv_close(ic);
+		cv_close(tab);
+	}
+	return (ok);
+}
+
+static int
+self_test(cv_ctx *ctx)
+{
+	const char *const *impls;
+	unsigned int i, j, n;
+	cv_ctx *ic;
+	int fail, ok;
+
+	for (impls = cv_impl_list(), n = 0; impls[n] != NULL; ++n)
+		/* nothing */ ;
+	printf("1..%u\n", 5 * n + 3);
+	for (i = fail = 0; i < n; ++i) {
+		if (cv_impl_select(impls[i]) != 0) {
+			for (j = 1; j <= 5; ++j)
+				printf("ok %u # skip %s\n", 5 * i + j,
+				    impls[i]);
+			continue;
+		}
+		ok = self_test_mixconv(ctx, MIXCONV_BLKSIZE, 1, 1);
+		printf("%sok %u - %s mixconv\n", ok ? "" : "not ",
+		    5 * i + 1, impls[i]);
+		fail += !ok;
+		ok = self_test_mixconv(ctx, 5, 1, 1);
+		printf("%sok %u - %s mixconv, short blocks\n",
+		    ok ? "" : "not ", 5 * i + 2, impls[i]);
+		fail += !ok;
+		ok = self_test_mixconv(ctx, 5, 3, 1);
+		printf("%sok %u - %s mixconv, multi-threaded\n",
+		    ok ? "" : "not ", 5 * i + 3, impls[i]);
+		fail += !ok;
+		ok = self_test_mixconv(ctx, 16, 3, 3);
+		printf("%sok %u - %s mixconv, multiple files\n",
+		    ok ? "" : "not ", 5 * i + 4, impls[i]);
+		fail += !ok;
+		ok = self_test_detect();
+		printf("%sok %u - %s charset detection\n", ok ? "" : "not ",
+		    5 * i + 5, impls[i]);
+		fail += !ok;
+	}
+	cv_impl_select(NULL);
+
+	/* conversion using iconv instead of a table */
+	if ((ic = cv_open(cv_candidate(ctx, 0), CV_ICONV)) == NULL)
+		err(1, "could not initialize iconv");
+	ok = self_test_mixconv(ic, MIXCONV_BLKSIZE, 1, 1);
+	cv_close(ic);
+	printf("%sok %u - mixconv, iconv\n", ok ? "" : "not ", 5 * n + 1);
+	fail += !ok;
+
+	/* passing clean spans through within the kernel */
+	ok = self_test_mixconv(ctx, 1, 0, 1);
+	printf("%sok %u - mixconv, zero-copy\n", ok ? "" : "not ", 5 * n + 2);
+	fail += !ok;
+
+	/* the built-in tables must agree with iconv */
+	ok = self_test_cstab();
+	printf("%sok %u - cstab\n", ok ? "" : "not ", 5 * n + 3);
+	fail += !ok;
+	return (fail);
 }
 
 static void
 usage(void)
 {
 
-	fprintf(stderr, "usage: mixconv [-dv] [-f charset] [-o output] ...\n");
+	fprintf(stderr, "usage: mixconv [-dsv] [-b size] [-f charset] "
+	    "[-j threads] [-o output] ...\n");
+	fprintf(stderr, "       mixconv [-dsv] [-b size] [-f charset] "
+	    "[-j threads] -O outdir file ...\n");
 	fprintf(stderr, "       mixconv [-dv] -t\n");
 	exit(1);
 }
@@ -215,22 +1424,64 @@ version(void)
 int
 main(int argc, char *argv[])
 {
+	struct stat ist, ost;
+	struct outbuf ob;
 	const char *inname;
-	FILE *infile, *outfile;
-	iconv_t conv;
+	int infd, outfd;
+	cv_ctx *ctx;
+	cv_clock clk;
+	cv_phase total;
+	cv_report *r;
+	unsigned long ul;
+	unsigned int i;
+	char *end, *path, key[80];
+	size_t len;
 	int opt;
 
-	while ((opt = getopt(argc, argv, "df:o:tv")) != -1)
+	cv_clock_start(&clk, 1);
+	while ((opt = getopt(argc, argv, "b:df:j:O:o:stv")) != -1)
 		switch (opt) {
+		case 'b':
+			ul = strtoul(optarg, &end, 10);
+			if (end != optarg && (*end == 'k' || *end == 'K')) {
+				ul = ul <= ULONG_MAX / 1024 ? ul * 1024 : 0;
+				++end;
+			} else if (end != optarg &&
+			    (*end == 'm' || *end == 'M')) {
+				ul = ul <= ULONG_MAX / 1048576 ?
+				    ul * 1048576 : 0;
+				++end;
+			}
+			if (end == optarg || *end != '\0' ||
+			    ul < 4096 || ul > MIXCONV_BLKMAX)
+				errx(1, "invalid block size: %s", optarg);
+			blksize = ul;
+			chunksize = ul < SIZE_MAX / MIXCONV_CHUNKBLKS ?
+			    MIXCONV_CHUNKBLKS * ul : SIZE_MAX;
+			break;
 		case 'd':
 			++opt_d;
 			break;
 		case 'f':
 			enc8 = optarg;
 			break;
+		case 'j':
+			ul = strtoul(optarg, &end, 10);
+			if (end == optarg || *end != '\0' ||
+			    ul < 1 || ul > 1024)
+				errx(1, "invalid number of threads: %s",
+				    optarg);
+			opt_j = ul;
+			break;
+		case 'O':
+			opt_O = optarg;
+			break;
 		case 'o':
 			outname = optarg;
 			break;
+		case 's':
+			++opt_s;
+			break;
 		case 't':
 			++opt_t;
 			break;
@@ -244,45 +1495,100 @@ main(int argc, char *argv[])
 	argc -= optind;
 	argv += optind;
 
-	/* initialize iconv */
-	if ((conv = iconv_open("utf8", enc8)) == (iconv_t)-1)
-		err(1, "could not initialize iconv");
+	/* initialize conversion */
+	if ((ctx = cv_open(enc8, 0)) == NULL)
+		err(1, "could not initialize conversion");
 
 	/* run self-test */
 	if (opt_t) {
 		if (outname || argc > 0)
 			usage();
-		self_test(conv);
-		exit(0);
+		exit(self_test(ctx) > 0);
+	}
+
+	/* -O requires input files, and can not be combined with -o */
+	if (opt_O != NULL && (outname != NULL || argc == 0))
+		usage();
+
+	/* convert each file into its own output file */
+	if (opt_O != NULL && argc > 1) {
+		mixconv_outdir(argv, argc);
+		goto done;
 	}
 
 	/* open output file */
+	path = NULL;
+	if (opt_O != NULL) {
+		inname = outdir_name(argv[0]);
+		if (*inname == '\0')
+			errx(1, "%s: not a file name", argv[0]);
+		len = strlen(opt_O) + strlen(inname) + 2;
+		if ((path = malloc(len)) == NULL)
+			err(1, "malloc()");
+		snprintf(path, len, "%s/%s", opt_O, inname);
+		outname = path;
+	}
 	if (outname) {
-		if ((outfile = fopen(outname, "w")) == NULL)
-			err(1, "%s", outname);
+		outfd = outfile_open(AT_FDCWD, outname, outname, &ost);
+		for (i = 0; i < (unsigned int)argc; ++i)
+			if (stat(argv[i], &ist) == 0 && SAME_FILE(&ist, &ost))
+				errx(1, "%s: would overwrite its own input",
+				    argv[i]);
+		outfile_truncate(outfd, &ost, outname);
 	} else {
 		outname = "stdout";
-		outfile = stdout;
+		outfd = STDOUT_FILENO;
 	}
+	outbuf_init(&ob, outfd, outname, blksize);
 
 	/* process input */
-	if (argc > 0) {
+	if (argc > 0 && opt_j > 1) {
+		mixconv_mt(ctx, argv, argc, &ob);
+	} else if (argc > 0) {
 		while (argc--) {
 			inname = *argv++;
-			if ((infile = fopen(inname, "r")) == NULL)
+			if ((infd = open(inname, O_RDONLY)) < 0)
 				err(1, "%s", inname);
-			mixconv(conv, infile, inname, outfile, outname);
-			fclose(infile);
+			mixconv(ctx, infd, inname, &ob, &stats);
+			close(infd);
 		}
 	} else {
 		inname = "standard input";
-		infile = stdin;
-		mixconv(conv, infile, inname, outfile, outname);
+		infd = STDIN_FILENO;
+		mixconv(ctx, infd, inname, &ob, &stats);
 	}
 
 	/* done */
-	if (outname)
-		fclose(outfile);
-	iconv_close(conv);
+	outbuf_fini(&ob);
+	stats.nwritten += ob.nwritten;
+	if (close(outfd) != 0)
+		err(1, "%s", outname);
+	free(path);
+done:
+	if (opt_s) {
+		memset(&total, 0, sizeof total);
+		cv_clock_lap(&clk, &total);
+		if ((r = cv_report_open("mixconv", opt_s > 1)) == NULL)
+			err(1, "cv_report_open()");
+		cv_report_count(r, "threads", opt_j);
+		cv_report_count(r, "bytes_read", stats.nread);
+		cv_report_count(r, "bytes_written", stats.nwritten);
+		cv_report_count(r, "lines", stats.lines);
+		cv_report_count(r, "lines_converted", stats.convlines);
+		for (i = 0; cv_candidates(ctx) > 1 && i < cv_candidates(ctx);
+		    ++i) {
+			snprintf(key, sizeof key, "detected_%s",
+			    cv_candidate(ctx, i));
+			cv_report_count(r, key, stats.detected[i]);
+			snprintf(key, sizeof key, "confidence_%s",
+			    cv_candidate(ctx, i));
+			cv_report_count(r, key, stats.detected[i] ?
+			    stats.detconf[i] / stats.detected[i] : 0);
+		}
+		cv_report_phase(r, "total", &total);
+		if (cv_report_close(r) != 0)
+			err(1, "cv_report_close()");
+	}
+	cv_close(ctx);
 	exit(0);
 }
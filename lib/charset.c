@@ -0,0 +1,119 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <ctype.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cv-impl.h"
+
+/*
+ * Common aliases for the built-in character sets.
+ */
+static const struct { const char *alias, *name; } cstab_aliases[] = {
+	{ "latin1", "iso8859-1" },
+	{ "latin2", "iso8859-2" },
+	{ "latin3", "iso8859-3" },
+	{ "latin4", "iso8859-4" },
+	{ "cyrillic", "iso8859-5" },
+	{ "arabic", "iso8859-6" },
+	{ "greek", "iso8859-7" },
+	{ "hebrew", "iso8859-8" },
+	{ "latin5", "iso8859-9" },
+	{ "latin6", "iso8859-10" },
+	{ "latin7", "iso8859-13" },
+	{ "latin8", "iso8859-14" },
+	{ "latin9", "iso8859-15" },
+	{ "latin10", "iso8859-16" },
+	{ "windows1252", "cp1252" },
+};
+
+/*
+ * Reduce a character set name to lower-case letters and digits, so
+ * that e.g. "ISO-8859-1", "iso8859-1" and "iso_8859_1" compare equal.
+ */
+static void
+cstab_normalize(const char *name, char *buf, size_t size)
+{
+	size_t i;
+
+	for (i = 0; *name != '\0' && i < size - 1; ++name)
+		if (isalnum((unsigned char)*name))
+			buf[i++] = tolower((unsigned char)*name);
+	buf[i] = '\0';
+}
+
+/*
+ * Look up the transcoding table for a character set.  The built-in
+ * tables are tried first, then iconv is probed.  Returns NULL if the
+ * character set is not a single-byte character set, in which case the
+ * caller must fall back to iconv.
+ */
+const struct cstab *
+cstab_open(const char *charset)
+{
+	char name[64], builtin[64], alias[64];
+	unsigned int i;
+
+	cstab_normalize(charset, name, sizeof name);
+	for (i = 0; i < sizeof cstab_aliases / sizeof cstab_aliases[0]; ++i) {
+		cstab_normalize(cstab_aliases[i].alias, alias, sizeof alias);
+		if (strcmp(name, alias) == 0) {
+			cstab_normalize(cstab_aliases[i].name,
+			    name, sizeof name);
+			break;
+		}
+	}
+	for (i = 0; cstab_builtin[i] != NULL; ++i) {
+		cstab_normalize(cstab_builtin[i]->name,
+		    builtin, sizeof builtin);
+		if (strcmp(name, builtin) == 0)
+			return (cstab_builtin[i]);
+	}
+	return (cstab_probe(charset));
+}
+
+/*
+ * Release a table returned by cstab_open().
+ */
+void
+cstab_close(const struct cstab *tab)
+{
+
+	if (tab == NULL || !tab->dynamic)
+		return;
+	free((void *)(uintptr_t)tab->rev);
+	free((void *)(uintptr_t)tab->name);
+	free((void *)(uintptr_t)tab);
+}
@@ -0,0 +1,161 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+
+#include "cv-impl.h"
+
+/*
+ * Classify a string as ASCII, UTF-8 or 8-bit.
+ */
+cv_nameclass
+cv_classify(const char *str, size_t len)
+{
+
+	return (cv_impl_get()->classify((const unsigned char *)str, len));
+}
+
+/*
+ * If the context asks for it, tell UTF-8 which is not NFC apart.
+ */
+static inline cv_nameclass
+cv_classify_nfd(cv_ctx *ctx, cv_nameclass nc, const char *str, size_t len)
+{
+
+	if (nc == CV_NC_UTF8 && ctx->nfc && !nfc_test(ctx, str, len))
+		return (CV_NC_NFD);
+	return (nc);
+}
+
+/*
+ * Classify a string as ASCII, UTF-8, WTF-8 or 8-bit, and with CV_NFC,
+ * as not NFC.  A valid UTF-8 string is considered to be WTF-8 if
+ * converting it to the presumed 8-bit encoding succeeds and yields
+ * valid UTF-8.
+ */
+cv_nameclass
+cv_classify_wtf(cv_ctx *ctx, const char *str, size_t len)
+{
+	struct utf8_state st;
+	const char *ip;
+	cv_nameclass nc;
+	size_t ret, ilen, olen;
+	char *op;
+
+	if (ctx->fixtab != NULL)
+		return (cv_classify_nfd(ctx, utf8_fix(ctx->fixtab,
+		    (const unsigned char *)str, len, NULL, NULL), str, len));
+	if ((nc = cv_classify(str, len)) != CV_NC_UTF8)
+		return (nc);
+	utf8_init(&st);
+	cv_reset(ctx, CV_REV);
+	ip = str;
+	ilen = len;
+	do {
+		op = ctx->scratch;
+		olen = sizeof ctx->scratch;
+		ret = cv_convert(ctx, CV_REV, &ip, &ilen, &op, &olen);
+		if (ret == (size_t)-1 && errno != E2BIG)
+			return (cv_classify_nfd(ctx, CV_NC_UTF8, str, len));
+		utf8_feed(&st, (unsigned char *)ctx->scratch,
+		    op - ctx->scratch);
+	} while (ret == (size_t)-1);
+	if (utf8_result(&st) == CV_NC_UTF8)
+		return (CV_NC_WTF8);
+	return (cv_classify_nfd(ctx, CV_NC_UTF8, str, len));
+}
+
+/*
+ * Normalize the outcome of cv_fix(): either the original string, if it
+ * is UTF-8 but not NFC, or, in place, the result of converting it.
+ */
+static cv_nameclass
+cv_fix_nfc(cv_ctx *ctx, cv_nameclass nc, const char *str, size_t len,
+    char *out, size_t *outlen)
+{
+
+	nc = cv_classify_nfd(ctx, nc, str, len);
+	if (nc == CV_NC_NFD) {
+		*outlen = nfc_conv(ctx, str, len, out, 3 * len + 1);
+	} else if ((nc == CV_NC_8BIT || nc == CV_NC_WTF8) &&
+	    *outlen != 0 && *outlen != (size_t)-1 &&
+	    !nfc_test(ctx, out, *outlen)) {
+		*outlen = nfc_conv(ctx, out, *outlen, out, 3 * len + 1);
+	}
+	return (nc);
+}
+
+/*
+ * Classify a string as for cv_classify_wtf(), and if it is 8-bit or
+ * WTF-8, convert it to UTF-8.  With a transcoding table, this is done in
+ * a single pass; otherwise, we fall back to iconv.  If the context has
+ * several candidate encodings, an 8-bit string is converted again using
+ * whichever is most likely, if that is not the first.  With CV_NFC,
+ * UTF-8 which is not NFC is normalized, and so is the result of any
+ * other conversion.
+ *
+ * The output buffer must have room for three times the length of the
+ * input plus a terminating NUL.  On return, *outlen is the length of the
+ * converted string, 0 if no conversion was needed, or (size_t)-1 if the
+ * conversion failed, in which case errno is set.
+ */
+cv_nameclass
+cv_fix(cv_ctx *ctx, const char *str, size_t len, char *out, size_t *outlen)
+{
+	cv_nameclass nc;
+	int i;
+
+	if (ctx->cand != NULL)
+		ctx->cand->detected = -1;
+	if (ctx->fixtab != NULL) {
+		nc = utf8_fix(ctx->fixtab, (const unsigned char *)str, len,
+		    (unsigned char *)out, outlen);
+		if (*outlen == (size_t)-1)
+			errno = EILSEQ;
+	} else {
+		nc = cv_classify_wtf(ctx, str, len);
+		if (nc == CV_NC_8BIT || nc == CV_NC_WTF8)
+			*outlen = cv_convstr(ctx,
+			    nc == CV_NC_WTF8 ? CV_REV : CV_FWD,
+			    str, len, out, 3 * len + 1);
+		else
+			*outlen = 0;
+	}
+	if (nc == CV_NC_8BIT && ctx->cand != NULL &&
+	    (i = cv_detect(ctx, (const unsigned char *)str, len)) > 0)
+		*outlen = cv_convstr(ctx->cand->ctx[i], CV_FWD,
+		    str, len, out, 3 * len + 1);
+	if (ctx->nfc)
+		nc = cv_fix_nfc(ctx, nc, str, len, out, outlen);
+	return (nc);
+}
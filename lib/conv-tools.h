@@ -0,0 +1,132 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef CONV_TOOLS_H_INCLUDED
+#define CONV_TOOLS_H_INCLUDED
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Name / line classes.
+ */
+typedef enum {
+	CV_NC_8BIT = -1,	/* 8-bit, but not valid UTF-8 */
+	CV_NC_ASCII = 0,	/* pure 7-bit ASCII */
+	CV_NC_UTF8 = 1,		/* valid UTF-8 */
+	CV_NC_WTF8 = 2,		/* UTF-8 encoded twice */
+	CV_NC_NFD = 3		/* valid UTF-8, but not NFC (CV_NFC only) */
+} cv_nameclass;
+
+/*
+ * Conversion direction.
+ */
+typedef enum {
+	CV_FWD,			/* 8-bit to UTF-8 */
+	CV_REV			/* UTF-8 to 8-bit */
+} cv_dir;
+
+/*
+ * A conversion context holds everything needed to convert between a
+ * presumed 8-bit encoding and UTF-8.  Contexts are not thread-safe; each
+ * thread must use its own.
+ *
+ * The encoding can also be a comma-separated list of candidates, in
+ * which case cv_fix() chooses the most likely one for each 8-bit string
+ * it converts.  Everything else uses the first candidate.
+ */
+typedef struct cv_ctx cv_ctx;
+
+/*
+ * Statistics.  A clock measures wall-clock time and either thread or
+ * process CPU time, in nanoseconds, and charges it to phases as they
+ * are completed.  A report collects counters and phase timings and
+ * prints them to stderr, either as text or as JSON.
+ */
+typedef struct {
+	uint64_t wall;
+	uint64_t cpu;
+} cv_phase;
+
+typedef struct {
+	uint64_t wall;
+	uint64_t cpu;
+	int process;
+} cv_clock;
+
+typedef struct cv_report cv_report;
+
+/* cv_open() flags */
+#define CV_ICONV	0x0001	/* always use iconv, never a table */
+#define CV_NFC		0x0002	/* tell apart and fix UTF-8 that isn't NFC */
+
+/* maximum number of candidate encodings */
+#define CV_MAXCAND	16
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+cv_ctx *cv_open(const char *, int);
+void cv_close(cv_ctx *);
+const char *cv_charset(const cv_ctx *);
+unsigned int cv_candidates(const cv_ctx *);
+const char *cv_candidate(const cv_ctx *, unsigned int);
+int cv_detected(const cv_ctx *, unsigned int *);
+int cv_tabled(const cv_ctx *);
+const char *const *cv_charsets(void);
+
+void cv_reset(cv_ctx *, cv_dir);
+size_t cv_convert(cv_ctx *, cv_dir,
+    const char **, size_t *, char **, size_t *);
+size_t cv_convstr(cv_ctx *, cv_dir, const char *, size_t, char *, size_t);
+
+cv_nameclass cv_classify(const char *, size_t);
+cv_nameclass cv_classify_wtf(cv_ctx *, const char *, size_t);
+cv_nameclass cv_fix(cv_ctx *, const char *, size_t, char *, size_t *);
+int cv_isnfc(const char *, size_t);
+size_t cv_nfc(const char *, size_t, char *, size_t);
+
+const char *const *cv_impl_list(void);
+int cv_impl_supported(const char *);
+int cv_impl_select(const char *);
+const char *cv_impl_name(void);
+
+void cv_clock_start(cv_clock *, int);
+void cv_clock_lap(cv_clock *, cv_phase *);
+cv_report *cv_report_open(const char *, int);
+int cv_report_count(cv_report *, const char *, uintmax_t);
+int cv_report_phase(cv_report *, const char *, const cv_phase *);
+int cv_report_close(cv_report *);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,231 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <iconv.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cv-impl.h"
+
+/*
+ * Decode the UTF-8 sequence in a forward table entry.
+ */
+static unsigned int
+cstab_decode(const unsigned char *ent)
+{
+
+	switch (ent[3]) {
+	case 1:
+		return (ent[0]);
+	case 2:
+		return ((ent[0] & 0x1fU) << 6 | (ent[1] & 0x3fU));
+	default:
+		return ((ent[0] & 0x0fU) << 12 | (ent[1] & 0x3fU) << 6 |
+		    (ent[2] & 0x3fU));
+	}
+}
+
+/*
+ * Build a transcoding table for a character set by asking iconv to
+ * convert each of the 256 possible byte values to UTF-8 in turn.
+ * Returns NULL if the character set is unknown to iconv or is not a
+ * stateless single-byte encoding of characters in the BMP.
+ */
+struct cstab *
+cstab_probe(const char *charset)
+{
+	unsigned char all[256], allconv[256 * 4], obuf[8];
+	unsigned short (*rev)[256];
+	char *ip, *op;
+	size_t ilen, olen, n, nall, allconvlen;
+	unsigned int b, cp, npages;
+	struct cstab *tab;
+	iconv_t cd;
+	int serrno;
+
+	if ((cd = iconv_open("utf8", charset)) == (iconv_t)-1)
+		return (NULL);
+	if ((tab = calloc(1, sizeof *tab)) == NULL)
+		goto fail;
+	for (b = nall = allconvlen = 0; b < 256; ++b) {
+		/* reset conversion state */
+		iconv(cd, NULL, NULL, NULL, NULL);
+		all[nall] = b;
+		ip = (char *)&all[nall];
+		ilen = 1;
+		op = (char *)obuf;
+		olen = sizeof obuf;
+		if (iconv(cd, &ip, &ilen, &op, &olen) == (size_t)-1) {
+			if (errno == EILSEQ)
+				continue;
+			/* incomplete input: multibyte character set */
+			errno = EINVAL;
+			goto fail;
+		}
+		/* flush any pending output */
+		iconv(cd, NULL, NULL, &op, &olen);
+		/* must be exactly one BMP character */
+		n = op - (char *)obuf;
+		if (n < 1 || n > 3 ||
+		    n != (obuf[0] < 0x80 ? 1U : obuf[0] < 0xe0 ? 2U : 3U)) {
+			errno = EINVAL;
+			goto fail;
+		}
+		memcpy(tab->fwd[b], obuf, n);
+		tab->fwd[b][3] = n;
+		memcpy(allconv + allconvlen, obuf, n);
+		allconvlen += n;
+		nall++;
+	}
+
+	/* check that it's stateless by converting all bytes at once */
+	iconv(cd, NULL, NULL, NULL, NULL);
+	ip = (char *)all;
+	ilen = nall;
+	op = (char *)allconv + allconvlen;
+	olen = sizeof allconv - allconvlen;
+	if (iconv(cd, &ip, &ilen, &op, &olen) == (size_t)-1 ||
+	    (size_t)(op - (char *)allconv) != 2 * allconvlen ||
+	    memcmp(allconv, allconv + allconvlen, allconvlen) != 0) {
+		errno = EINVAL;
+		goto fail;
+	}
+	iconv_close(cd);
+	cd = (iconv_t)-1;
+
+	/* number the pages we need for the reverse table */
+	for (b = npages = 0; b < 256; ++b) {
+		if (tab->fwd[b][3] == 0)
+			continue;
+		cp = cstab_decode(tab->fwd[b]);
+		if (tab->revidx[cp >> 8] == 0)
+			tab->revidx[cp >> 8] = ++npages;
+	}
+	if ((rev = calloc(npages ? npages : 1, sizeof *rev)) == NULL)
+		goto fail;
+	for (b = 0; b < 256; ++b) {
+		if (tab->fwd[b][3] == 0)
+			continue;
+		cp = cstab_decode(tab->fwd[b]);
+		/* if several bytes map to the same codepoint, keep the first */
+		if (rev[tab->revidx[cp >> 8] - 1][cp & 0xff] == 0)
+			rev[tab->revidx[cp >> 8] - 1][cp & 0xff] = 0x100 | b;
+	}
+	tab->rev = (const unsigned short (*)[256])rev;
+	if ((tab->name = strdup(charset)) == NULL) {
+		free(rev);
+		goto fail;
+	}
+	tab->dynamic = 1;
+	return (tab);
+fail:
+	serrno = errno;
+	free(tab);
+	if (cd != (iconv_t)-1)
+		iconv_close(cd);
+	errno = serrno;
+	return (NULL);
+}
+
+/*
+ * Convert a string from a single-byte character set to UTF-8.  The
+ * output buffer must have room for three bytes per input byte plus one.
+ * Returns the length of the output, or (size_t)-1 if the input contains
+ * a byte which is not part of the character set.
+ */
+size_t
+cstab_fwd(const struct cstab *tab, const char *in, size_t inlen, char *out)
+{
+	const unsigned char *ent;
+	unsigned int bad;
+	char *op;
+	size_t i;
+
+	for (i = 0, op = out, bad = 0; i < inlen; ++i) {
+		ent = tab->fwd[(unsigned char)in[i]];
+		memcpy(op, ent, 4);
+		bad |= ent[3] == 0;
+		op += ent[3];
+	}
+	if (bad) {
+		errno = EILSEQ;
+		return ((size_t)-1);
+	}
+	return (op - out);
+}
+
+/*
+ * Convert a UTF-8 string to a single-byte character set.  The output
+ * buffer must have room for one byte per input byte.  Returns the length
+ * of the output, or (size_t)-1 if the input is not valid UTF-8 or
+ * contains a character which is not part of the character set.
+ */
+size_t
+cstab_rev(const struct cstab *tab, const char *in, size_t inlen, char *out)
+{
+	const unsigned char *p, *end;
+	unsigned int cp, page, ent;
+	char *op;
+
+	p = (const unsigned char *)in;
+	end = p + inlen;
+	for (op = out; p < end; ) {
+		cp = *p++;
+		if (cp < 0x80) {
+			/* ASCII */
+		} else if (cp >= 0xc2 && cp < 0xe0 &&
+		    end - p >= 1 && (p[0] & 0xc0) == 0x80) {
+			cp = (cp & 0x1f) << 6 | (p[0] & 0x3f);
+			p += 1;
+		} else if (cp >= 0xe0 && cp < 0xf0 &&
+		    end - p >= 2 && (p[0] & 0xc0) == 0x80 &&
+		    (p[1] & 0xc0) == 0x80) {
+			cp = (cp & 0x0f) << 12 | (p[0] & 0x3f) << 6 |
+			    (p[1] & 0x3f);
+			p += 2;
+			if (cp < 0x800)
+				goto fail;
+		} else {
+			goto fail;
+		}
+		if ((page = tab->revidx[cp >> 8]) == 0 ||
+		    (ent = tab->rev[page - 1][cp & 0xff]) == 0)
+			goto fail;
+		*op++ = ent & 0xff;
+	}
+	return (op - out);
+fail:
+	errno = EILSEQ;
+	return ((size_t)-1);
+}
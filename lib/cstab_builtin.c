@@ -0,0 +1,3362 @@
+/* This file was generated by mkcstab.  Do not edit. */
+
+#include <stddef.h>
+
+#include "cv-impl.h"
+
+static const unsigned short iso8859_1_rev[1][256] = {
+	{
+		0x100, 0x101, 0x102, 0x103, 0x104, 0x105, 0x106, 0x107,
+		0x108, 0x109, 0x10a, 0x10b, 0x10c, 0x10d, 0x10e, 0x10f,
+		0x110, 0x111, 0x112, 0x113, 0x114, 0x115, 0x116, 0x117,
+		0x118, 0x119, 0x11a, 0x11b, 0x11c, 0x11d, 0x11e, 0x11f,
+		0x120, 0x121, 0x122, 0x123, 0x124, 0x125, 0x126, 0x127,
+		0x128, 0x129, 0x12a, 0x12b, 0x12c, 0x12d, 0x12e, 0x12f,
+		0x130, 0x131, 0x132, 0x133, 0x134, 0x135, 0x136, 0x137,
+		0x138, 0x139, 0x13a, 0x13b, 0x13c, 0x13d, 0x13e, 0x13f,
+		0x140, 0x141, 0x142, 0x143, 0x144, 0x145, 0x146, 0x147,
+		0x148, 0x149, 0x14a, 0x14b, 0x14c, 0x14d, 0x14e, 0x14f,
+		0x150, 0x151, 0x152, 0x153, 0x154, 0x155, 0x156, 0x157,
+		0x158, 0x159, 0x15a, 0x15b, 0x15c, 0x15d, 0x15e, 0x15f,
+		0x160, 0x161, 0x162, 0x163, 0x164, 0x165, 0x166, 0x167,
+		0x168, 0x169, 0x16a, 0x16b, 0x16c, 0x16d, 0x16e, 0x16f,
+		0x170, 0x171, 0x172, 0x173, 0x174, 0x175, 0x176, 0x177,
+		0x178, 0x179, 0x17a, 0x17b, 0x17c, 0x17d, 0x17e, 0x17f,
+		0x180, 0x181, 0x182, 0x183, 0x184, 0x185, 0x186, 0x187,
+		0x188, 0x189, 0x18a, 0x18b, 0x18c, 0x18d, 0x18e, 0x18f,
+		0x190, 0x191, 0x192, 0x193, 0x194, 0x195, 0x196, 0x197,
+		0x198, 0x199, 0x19a, 0x19b, 0x19c, 0x19d, 0x19e, 0x19f,
+		0x1a0, 0x1a1, 0x1a2, 0x1a3, 0x1a4, 0x1a5, 0x1a6, 0x1a7,
+		0x1a8, 0x1a9, 0x1aa, 0x1ab, 0x1ac, 0x1ad, 0x1ae, 0x1af,
+		0x1b0, 0x1b1, 0x1b2, 0x1b3, 0x1b4, 0x1b5, 0x1b6, 0x1b7,
+		0x1b8, 0x1b9, 0x1ba, 0x1bb, 0x1bc, 0x1bd, 0x1be, 0x1bf,
+		0x1c0, 0x1c1, 0x1c2, 0x1c3, 0x1c4, 0x1c5, 0x1c6, 0x1c7,
+		0x1c8, 0x1c9, 0x1ca, 0x1cb, 0x1cc, 0x1cd, 0x1ce, 0x1cf,
+		0x1d0, 0x1d1, 0x1d2, 0x1d3, 0x1d4, 0x1d5, 0x1d6, 0x1d7,
+		0x1d8, 0x1d9, 0x1da, 0x1db, 0x1dc, 0x1dd, 0x1de, 0x1df,
+		0x1e0, 0x1e1, 0x1e2, 0x1e3, 0x1e4, 0x1e5, 0x1e6, 0x1e7,
+		0x1e8, 0x1e9, 0x1ea, 0x1eb, 0x1ec, 0x1ed, 0x1ee, 0x1ef,
+		0x1f0, 0x1f1, 0x1f2, 0x1f3, 0x1f4, 0x1f5, 0x1f6, 0x1f7,
+		0x1f8, 0x1f9, 0x1fa, 0x1fb, 0x1fc, 0x1fd, 0x1fe, 0x1ff,
+	},
+};
+
+static const struct cstab iso8859_1 = {
+	"iso8859-1",
+	{
+		{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+		{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+		{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+		{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+		{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+		{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+		{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+		{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+		{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+		{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+		{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+		{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+		{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+		{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+		{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+		{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+		{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+		{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+		{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+		{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+		{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+		{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+		{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+		{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+		{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+		{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+		{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+		{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+		{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+		{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+		{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+		{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+		{ 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+		{ 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+		{ 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+		{ 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+		{ 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+		{ 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+		{ 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+		{ 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+		{ 0xc2, 0xa0, 0x00, 2 }, { 0xc2, 0xa1, 0x00, 2 }, { 0xc2, 0xa2, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+		{ 0xc2, 0xa4, 0x00, 2 }, { 0xc2, 0xa5, 0x00, 2 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+		{ 0xc2, 0xa8, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xc2, 0xaa, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+		{ 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc2, 0xaf, 0x00, 2 },
+		{ 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+		{ 0xc2, 0xb4, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+		{ 0xc2, 0xb8, 0x00, 2 }, { 0xc2, 0xb9, 0x00, 2 }, { 0xc2, 0xba, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+		{ 0xc2, 0xbc, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0xc2, 0xbe, 0x00, 2 }, { 0xc2, 0xbf, 0x00, 2 },
+		{ 0xc3, 0x80, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc3, 0x83, 0x00, 2 },
+		{ 0xc3, 0x84, 0x00, 2 }, { 0xc3, 0x85, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 }, { 0xc3, 0x87, 0x00, 2 },
+		{ 0xc3, 0x88, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc3, 0x8a, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+		{ 0xc3, 0x8c, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc3, 0x8f, 0x00, 2 },
+		{ 0xc3, 0x90, 0x00, 2 }, { 0xc3, 0x91, 0x00, 2 }, { 0xc3, 0x92, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+		{ 0xc3, 0x94, 0x00, 2 }, { 0xc3, 0x95, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+		{ 0xc3, 0x98, 0x00, 2 }, { 0xc3, 0x99, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc3, 0x9b, 0x00, 2 },
+		{ 0xc3, 0x9c, 0x00, 2 }, { 0xc3, 0x9d, 0x00, 2 }, { 0xc3, 0x9e, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+		{ 0xc3, 0xa0, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xc3, 0xa3, 0x00, 2 },
+		{ 0xc3, 0xa4, 0x00, 2 }, { 0xc3, 0xa5, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+		{ 0xc3, 0xa8, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc3, 0xaa, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+		{ 0xc3, 0xac, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc3, 0xaf, 0x00, 2 },
+		{ 0xc3, 0xb0, 0x00, 2 }, { 0xc3, 0xb1, 0x00, 2 }, { 0xc3, 0xb2, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+		{ 0xc3, 0xb4, 0x00, 2 }, { 0xc3, 0xb5, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+		{ 0xc3, 0xb8, 0x00, 2 }, { 0xc3, 0xb9, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 },
+		{ 0xc3, 0xbc, 0x00, 2 }, { 0xc3, 0xbd, 0x00, 2 }, { 0xc3, 0xbe, 0x00, 2 }, { 0xc3, 0xbf, 0x00, 2 },
+	},
+	{
+		1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	iso8859_1_rev,
+	0
+};
+
+static const unsigned short iso8859_2_rev[3][256] = {
+	{
+		0x100, 0x101, 0x102, 0x103, 0x104, 0x105, 0x106, 0x107,
+		0x108, 0x109, 0x10a, 0x10b, 0x10c, 0x10d, 0x10e, 0x10f,
+		0x110, 0x111, 0x112, 0x113, 0x114, 0x115, 0x116, 0x117,
+		0x118, 0x119, 0x11a, 0x11b, 0x11c, 0x11d, 0x11e, 0x11f,
+		0x120, 0x121, 0x122, 0x123, 0x124, 0x125, 0x126, 0x127,
+		0x128, 0x129, 0x12a, 0x12b, 0x12c, 0x12d, 0x12e, 0x12f,
+		0x130, 0x131, 0x132, 0x133, 0x134, 0x135, 0x136, 0x137,
+		0x138, 0x139, 0x13a, 0x13b, 0x13c, 0x13d, 0x13e, 0x13f,
+		0x140, 0x141, 0x142, 0x143, 0x144, 0x145, 0x146, 0x147,
+		0x148, 0x149, 0x14a, 0x14b, 0x14c, 0x14d, 0x14e, 0x14f,
+		0x150, 0x151, 0x152, 0x153, 0x154, 0x155, 0x156, 0x157,
+		0x158, 0x159, 0x15a, 0x15b, 0x15c, 0x15d, 0x15e, 0x15f,
+		0x160, 0x161, 0x162, 0x163, 0x164, 0x165, 0x166, 0x167,
+		0x168, 0x169, 0x16a, 0x16b, 0x16c, 0x16d, 0x16e, 0x16f,
+		0x170, 0x171, 0x172, 0x173, 0x174, 0x175, 0x176, 0x177,
+		0x178, 0x179, 0x17a, 0x17b, 0x17c, 0x17d, 0x17e, 0x17f,
+		0x180, 0x181, 0x182, 0x183, 0x184, 0x185, 0x186, 0x187,
+		0x188, 0x189, 0x18a, 0x18b, 0x18c, 0x18d, 0x18e, 0x18f,
+		0x190, 0x191, 0x192, 0x193, 0x194, 0x195, 0x196, 0x197,
+		0x198, 0x199, 0x19a, 0x19b, 0x19c, 0x19d, 0x19e, 0x19f,
+		0x1a0, 0x000, 0x000, 0x000, 0x1a4, 0x000, 0x000, 0x1a7,
+		0x1a8, 0x000, 0x000, 0x000, 0x000, 0x1ad, 0x000, 0x000,
+		0x1b0, 0x000, 0x000, 0x000, 0x1b4, 0x000, 0x000, 0x000,
+		0x1b8, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x1c1, 0x1c2, 0x000, 0x1c4, 0x000, 0x000, 0x1c7,
+		0x000, 0x1c9, 0x000, 0x1cb, 0x000, 0x1cd, 0x1ce, 0x000,
+		0x000, 0x000, 0x000, 0x1d3, 0x1d4, 0x000, 0x1d6, 0x1d7,
+		0x000, 0x000, 0x1da, 0x000, 0x1dc, 0x1dd, 0x000, 0x1df,
+		0x000, 0x1e1, 0x1e2, 0x000, 0x1e4, 0x000, 0x000, 0x1e7,
+		0x000, 0x1e9, 0x000, 0x1eb, 0x000, 0x1ed, 0x1ee, 0x000,
+		0x000, 0x000, 0x000, 0x1f3, 0x1f4, 0x000, 0x1f6, 0x1f7,
+		0x000, 0x000, 0x1fa, 0x000, 0x1fc, 0x1fd, 0x000, 0x000,
+	},
+	{
+		0x000, 0x000, 0x1c3, 0x1e3, 0x1a1, 0x1b1, 0x1c6, 0x1e6,
+		0x000, 0x000, 0x000, 0x000, 0x1c8, 0x1e8, 0x1cf, 0x1ef,
+		0x1d0, 0x1f0, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1ca, 0x1ea, 0x1cc, 0x1ec, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x1c5, 0x1e5, 0x000, 0x000, 0x1a5, 0x1b5, 0x000,
+		0x000, 0x1a3, 0x1b3, 0x1d1, 0x1f1, 0x000, 0x000, 0x1d2,
+		0x1f2, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1d5, 0x1f5, 0x000, 0x000, 0x1c0, 0x1e0, 0x000, 0x000,
+		0x1d8, 0x1f8, 0x1a6, 0x1b6, 0x000, 0x000, 0x1aa, 0x1ba,
+		0x1a9, 0x1b9, 0x1de, 0x1fe, 0x1ab, 0x1bb, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1d9, 0x1f9,
+		0x1db, 0x1fb, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x1ac, 0x1bc, 0x1af, 0x1bf, 0x1ae, 0x1be, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+	{
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1b7,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1a2, 0x1ff, 0x000, 0x1b2, 0x000, 0x1bd, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+};
+
+static const struct cstab iso8859_2 = {
+	"iso8859-2",
+	{
+		{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+		{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+		{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+		{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+		{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+		{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+		{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+		{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+		{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+		{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+		{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+		{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+		{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+		{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+		{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+		{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+		{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+		{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+		{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+		{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+		{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+		{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+		{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+		{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+		{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+		{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+		{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+		{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+		{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+		{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+		{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+		{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+		{ 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+		{ 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+		{ 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+		{ 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+		{ 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+		{ 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+		{ 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+		{ 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+		{ 0xc2, 0xa0, 0x00, 2 }, { 0xc4, 0x84, 0x00, 2 }, { 0xcb, 0x98, 0x00, 2 }, { 0xc5, 0x81, 0x00, 2 },
+		{ 0xc2, 0xa4, 0x00, 2 }, { 0xc4, 0xbd, 0x00, 2 }, { 0xc5, 0x9a, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+		{ 0xc2, 0xa8, 0x00, 2 }, { 0xc5, 0xa0, 0x00, 2 }, { 0xc5, 0x9e, 0x00, 2 }, { 0xc5, 0xa4, 0x00, 2 },
+		{ 0xc5, 0xb9, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc5, 0xbd, 0x00, 2 }, { 0xc5, 0xbb, 0x00, 2 },
+		{ 0xc2, 0xb0, 0x00, 2 }, { 0xc4, 0x85, 0x00, 2 }, { 0xcb, 0x9b, 0x00, 2 }, { 0xc5, 0x82, 0x00, 2 },
+		{ 0xc2, 0xb4, 0x00, 2 }, { 0xc4, 0xbe, 0x00, 2 }, { 0xc5, 0x9b, 0x00, 2 }, { 0xcb, 0x87, 0x00, 2 },
+		{ 0xc2, 0xb8, 0x00, 2 }, { 0xc5, 0xa1, 0x00, 2 }, { 0xc5, 0x9f, 0x00, 2 }, { 0xc5, 0xa5, 0x00, 2 },
+		{ 0xc5, 0xba, 0x00, 2 }, { 0xcb, 0x9d, 0x00, 2 }, { 0xc5, 0xbe, 0x00, 2 }, { 0xc5, 0xbc, 0x00, 2 },
+		{ 0xc5, 0x94, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc4, 0x82, 0x00, 2 },
+		{ 0xc3, 0x84, 0x00, 2 }, { 0xc4, 0xb9, 0x00, 2 }, { 0xc4, 0x86, 0x00, 2 }, { 0xc3, 0x87, 0x00, 2 },
+		{ 0xc4, 0x8c, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc4, 0x98, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+		{ 0xc4, 0x9a, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc4, 0x8e, 0x00, 2 },
+		{ 0xc4, 0x90, 0x00, 2 }, { 0xc5, 0x83, 0x00, 2 }, { 0xc5, 0x87, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+		{ 0xc3, 0x94, 0x00, 2 }, { 0xc5, 0x90, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+		{ 0xc5, 0x98, 0x00, 2 }, { 0xc5, 0xae, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc5, 0xb0, 0x00, 2 },
+		{ 0xc3, 0x9c, 0x00, 2 }, { 0xc3, 0x9d, 0x00, 2 }, { 0xc5, 0xa2, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+		{ 0xc5, 0x95, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xc4, 0x83, 0x00, 2 },
+		{ 0xc3, 0xa4, 0x00, 2 }, { 0xc4, 0xba, 0x00, 2 }, { 0xc4, 0x87, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+		{ 0xc4, 0x8d, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc4, 0x99, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+		{ 0xc4, 0x9b, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc4, 0x8f, 0x00, 2 },
+		{ 0xc4, 0x91, 0x00, 2 }, { 0xc5, 0x84, 0x00, 2 }, { 0xc5, 0x88, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+		{ 0xc3, 0xb4, 0x00, 2 }, { 0xc5, 0x91, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+		{ 0xc5, 0x99, 0x00, 2 }, { 0xc5, 0xaf, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc5, 0xb1, 0x00, 2 },
+		{ 0xc3, 0xbc, 0x00, 2 }, { 0xc3, 0xbd, 0x00, 2 }, { 0xc5, 0xa3, 0x00, 2 }, { 0xcb, 0x99, 0x00, 2 },
+	},
+	{
+		1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	iso8859_2_rev,
+	0
+};
+
+static const unsigned short iso8859_3_rev[3][256] = {
+	{
+		0x100, 0x101, 0x102, 0x103, 0x104, 0x105, 0x106, 0x107,
+		0x108, 0x109, 0x10a, 0x10b, 0x10c, 0x10d, 0x10e, 0x10f,
+		0x110, 0x111, 0x112, 0x113, 0x114, 0x115, 0x116, 0x117,
+		0x118, 0x119, 0x11a, 0x11b, 0x11c, 0x11d, 0x11e, 0x11f,
+		0x120, 0x121, 0x122, 0x123, 0x124, 0x125, 0x126, 0x127,
+		0x128, 0x129, 0x12a, 0x12b, 0x12c, 0x12d, 0x12e, 0x12f,
+		0x130, 0x131, 0x132, 0x133, 0x134, 0x135, 0x136, 0x137,
+		0x138, 0x139, 0x13a, 0x13b, 0x13c, 0x13d, 0x13e, 0x13f,
+		0x140, 0x141, 0x142, 0x143, 0x144, 0x145, 0x146, 0x147,
+		0x148, 0x149, 0x14a, 0x14b, 0x14c, 0x14d, 0x14e, 0x14f,
+		0x150, 0x151, 0x152, 0x153, 0x154, 0x155, 0x156, 0x157,
+		0x158, 0x159, 0x15a, 0x15b, 0x15c, 0x15d, 0x15e, 0x15f,
+		0x160, 0x161, 0x162, 0x163, 0x164, 0x165, 0x166, 0x167,
+		0x168, 0x169, 0x16a, 0x16b, 0x16c, 0x16d, 0x16e, 0x16f,
+		0x170, 0x171, 0x172, 0x173, 0x174, 0x175, 0x176, 0x177,
+		0x178, 0x179, 0x17a, 0x17b, 0x17c, 0x17d, 0x17e, 0x17f,
+		0x180, 0x181, 0x182, 0x183, 0x184, 0x185, 0x186, 0x187,
+		0x188, 0x189, 0x18a, 0x18b, 0x18c, 0x18d, 0x18e, 0x18f,
+		0x190, 0x191, 0x192, 0x193, 0x194, 0x195, 0x196, 0x197,
+		0x198, 0x199, 0x19a, 0x19b, 0x19c, 0x19d, 0x19e, 0x19f,
+		0x1a0, 0x000, 0x000, 0x1a3, 0x1a4, 0x000, 0x000, 0x1a7,
+		0x1a8, 0x000, 0x000, 0x000, 0x000, 0x1ad, 0x000, 0x000,
+		0x1b0, 0x000, 0x1b2, 0x1b3, 0x1b4, 0x1b5, 0x000, 0x1b7,
+		0x1b8, 0x000, 0x000, 0x000, 0x000, 0x1bd, 0x000, 0x000,
+		0x1c0, 0x1c1, 0x1c2, 0x000, 0x1c4, 0x000, 0x000, 0x1c7,
+		0x1c8, 0x1c9, 0x1ca, 0x1cb, 0x1cc, 0x1cd, 0x1ce, 0x1cf,
+		0x000, 0x1d1, 0x1d2, 0x1d3, 0x1d4, 0x000, 0x1d6, 0x1d7,
+		0x000, 0x1d9, 0x1da, 0x1db, 0x1dc, 0x000, 0x000, 0x1df,
+		0x1e0, 0x1e1, 0x1e2, 0x000, 0x1e4, 0x000, 0x000, 0x1e7,
+		0x1e8, 0x1e9, 0x1ea, 0x1eb, 0x1ec, 0x1ed, 0x1ee, 0x1ef,
+		0x000, 0x1f1, 0x1f2, 0x1f3, 0x1f4, 0x000, 0x1f6, 0x1f7,
+		0x000, 0x1f9, 0x1fa, 0x1fb, 0x1fc, 0x000, 0x000, 0x000,
+	},
+	{
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1c6, 0x1e6, 0x1c5, 0x1e5, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x1d8, 0x1f8, 0x1ab, 0x1bb,
+		0x1d5, 0x1f5, 0x000, 0x000, 0x1a6, 0x1b6, 0x1a1, 0x1b1,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1a9, 0x1b9, 0x000, 0x000, 0x1ac, 0x1bc, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x1de, 0x1fe, 0x1aa, 0x1ba,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x1dd, 0x1fd, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x1af, 0x1bf, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+	{
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1a2, 0x1ff, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+};
+
+static const struct cstab iso8859_3 = {
+	"iso8859-3",
+	{
+		{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+		{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+		{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+		{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+		{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+		{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+		{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+		{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+		{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+		{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+		{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+		{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+		{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+		{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+		{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+		{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+		{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+		{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+		{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+		{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+		{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+		{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+		{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+		{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+		{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+		{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+		{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+		{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+		{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+		{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+		{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+		{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+		{ 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+		{ 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+		{ 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+		{ 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+		{ 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+		{ 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+		{ 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+		{ 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+		{ 0xc2, 0xa0, 0x00, 2 }, { 0xc4, 0xa6, 0x00, 2 }, { 0xcb, 0x98, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+		{ 0xc2, 0xa4, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0xc4, 0xa4, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+		{ 0xc2, 0xa8, 0x00, 2 }, { 0xc4, 0xb0, 0x00, 2 }, { 0xc5, 0x9e, 0x00, 2 }, { 0xc4, 0x9e, 0x00, 2 },
+		{ 0xc4, 0xb4, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0xc5, 0xbb, 0x00, 2 },
+		{ 0xc2, 0xb0, 0x00, 2 }, { 0xc4, 0xa7, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+		{ 0xc2, 0xb4, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc4, 0xa5, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+		{ 0xc2, 0xb8, 0x00, 2 }, { 0xc4, 0xb1, 0x00, 2 }, { 0xc5, 0x9f, 0x00, 2 }, { 0xc4, 0x9f, 0x00, 2 },
+		{ 0xc4, 0xb5, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0xc5, 0xbc, 0x00, 2 },
+		{ 0xc3, 0x80, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 },
+		{ 0xc3, 0x84, 0x00, 2 }, { 0xc4, 0x8a, 0x00, 2 }, { 0xc4, 0x88, 0x00, 2 }, { 0xc3, 0x87, 0x00, 2 },
+		{ 0xc3, 0x88, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc3, 0x8a, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+		{ 0xc3, 0x8c, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc3, 0x8f, 0x00, 2 },
+		{ 0x00, 0x00, 0x00, 0 }, { 0xc3, 0x91, 0x00, 2 }, { 0xc3, 0x92, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+		{ 0xc3, 0x94, 0x00, 2 }, { 0xc4, 0xa0, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+		{ 0xc4, 0x9c, 0x00, 2 }, { 0xc3, 0x99, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc3, 0x9b, 0x00, 2 },
+		{ 0xc3, 0x9c, 0x00, 2 }, { 0xc5, 0xac, 0x00, 2 }, { 0xc5, 0x9c, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+		{ 0xc3, 0xa0, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 },
+		{ 0xc3, 0xa4, 0x00, 2 }, { 0xc4, 0x8b, 0x00, 2 }, { 0xc4, 0x89, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+		{ 0xc3, 0xa8, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc3, 0xaa, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+		{ 0xc3, 0xac, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc3, 0xaf, 0x00, 2 },
+		{ 0x00, 0x00, 0x00, 0 }, { 0xc3, 0xb1, 0x00, 2 }, { 0xc3, 0xb2, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+		{ 0xc3, 0xb4, 0x00, 2 }, { 0xc4, 0xa1, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+		{ 0xc4, 0x9d, 0x00, 2 }, { 0xc3, 0xb9, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 },
+		{ 0xc3, 0xbc, 0x00, 2 }, { 0xc5, 0xad, 0x00, 2 }, { 0xc5, 0x9d, 0x00, 2 }, { 0xcb, 0x99, 0x00, 2 },
+	},
+	{
+		1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	iso8859_3_rev,
+	0
+};
+
+static const unsigned short iso8859_4_rev[3][256] = {
+	{
+		0x100, 0x101, 0x102, 0x103, 0x104, 0x105, 0x106, 0x107,
+		0x108, 0x109, 0x10a, 0x10b, 0x10c, 0x10d, 0x10e, 0x10f,
+		0x110, 0x111, 0x112, 0x113, 0x114, 0x115, 0x116, 0x117,
+		0x118, 0x119, 0x11a, 0x11b, 0x11c, 0x11d, 0x11e, 0x11f,
+		0x120, 0x121, 0x122, 0x123, 0x124, 0x125, 0x126, 0x127,
+		0x128, 0x129, 0x12a, 0x12b, 0x12c, 0x12d, 0x12e, 0x12f,
+		0x130, 0x131, 0x132, 0x133, 0x134, 0x135, 0x136, 0x137,
+		0x138, 0x139, 0x13a, 0x13b, 0x13c, 0x13d, 0x13e, 0x13f,
+		0x140, 0x141, 0x142, 0x143, 0x144, 0x145, 0x146, 0x147,
+		0x148, 0x149, 0x14a, 0x14b, 0x14c, 0x14d, 0x14e, 0x14f,
+		0x150, 0x151, 0x152, 0x153, 0x154, 0x155, 0x156, 0x157,
+		0x158, 0x159, 0x15a, 0x15b, 0x15c, 0x15d, 0x15e, 0x15f,
+		0x160, 0x161, 0x162, 0x163, 0x164, 0x165, 0x166, 0x167,
+		0x168, 0x169, 0x16a, 0x16b, 0x16c, 0x16d, 0x16e, 0x16f,
+		0x170, 0x171, 0x172, 0x173, 0x174, 0x175, 0x176, 0x177,
+		0x178, 0x179, 0x17a, 0x17b, 0x17c, 0x17d, 0x17e, 0x17f,
+		0x180, 0x181, 0x182, 0x183, 0x184, 0x185, 0x186, 0x187,
+		0x188, 0x189, 0x18a, 0x18b, 0x18c, 0x18d, 0x18e, 0x18f,
+		0x190, 0x191, 0x192, 0x193, 0x194, 0x195, 0x196, 0x197,
+		0x198, 0x199, 0x19a, 0x19b, 0x19c, 0x19d, 0x19e, 0x19f,
+		0x1a0, 0x000, 0x000, 0x000, 0x1a4, 0x000, 0x000, 0x1a7,
+		0x1a8, 0x000, 0x000, 0x000, 0x000, 0x1ad, 0x000, 0x1af,
+		0x1b0, 0x000, 0x000, 0x000, 0x1b4, 0x000, 0x000, 0x000,
+		0x1b8, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x1c1, 0x1c2, 0x1c3, 0x1c4, 0x1c5, 0x1c6, 0x000,
+		0x000, 0x1c9, 0x000, 0x1cb, 0x000, 0x1cd, 0x1ce, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x1d4, 0x1d5, 0x1d6, 0x1d7,
+		0x1d8, 0x000, 0x1da, 0x1db, 0x1dc, 0x000, 0x000, 0x1df,
+		0x000, 0x1e1, 0x1e2, 0x1e3, 0x1e4, 0x1e5, 0x1e6, 0x000,
+		0x000, 0x1e9, 0x000, 0x1eb, 0x000, 0x1ed, 0x1ee, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x1f4, 0x1f5, 0x1f6, 0x1f7,
+		0x1f8, 0x000, 0x1fa, 0x1fb, 0x1fc, 0x000, 0x000, 0x000,
+	},
+	{
+		0x1c0, 0x1e0, 0x000, 0x000, 0x1a1, 0x1b1, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x1c8, 0x1e8, 0x000, 0x000,
+		0x1d0, 0x1f0, 0x1aa, 0x1ba, 0x000, 0x000, 0x1cc, 0x1ec,
+		0x1ca, 0x1ea, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x1ab, 0x1bb, 0x000, 0x000, 0x000, 0x000,
+		0x1a5, 0x1b5, 0x1cf, 0x1ef, 0x000, 0x000, 0x1c7, 0x1e7,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1d3, 0x1f3,
+		0x1a2, 0x000, 0x000, 0x1a6, 0x1b6, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x1d1, 0x1f1, 0x000,
+		0x000, 0x000, 0x1bd, 0x1bf, 0x1d2, 0x1f2, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1a3, 0x1b3,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1a9, 0x1b9, 0x000, 0x000, 0x000, 0x000, 0x1ac, 0x1bc,
+		0x1dd, 0x1fd, 0x1de, 0x1fe, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x1d9, 0x1f9, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x1ae, 0x1be, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+	{
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1b7,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x1ff, 0x000, 0x1b2, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+};
+
+static const struct cstab iso8859_4 = {
+	"iso8859-4",
+	{
+		{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+		{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+		{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+		{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+		{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+		{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+		{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+		{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+		{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+		{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+		{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+		{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+		{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+		{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+		{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+		{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+		{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+		{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+		{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+		{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+		{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+		{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+		{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+		{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+		{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+		{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+		{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+		{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+		{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+		{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+		{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+		{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+		{ 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+		{ 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+		{ 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+		{ 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+		{ 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+		{ 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+		{ 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+		{ 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+		{ 0xc2, 0xa0, 0x00, 2 }, { 0xc4, 0x84, 0x00, 2 }, { 0xc4, 0xb8, 0x00, 2 }, { 0xc5, 0x96, 0x00, 2 },
+		{ 0xc2, 0xa4, 0x00, 2 }, { 0xc4, 0xa8, 0x00, 2 }, { 0xc4, 0xbb, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+		{ 0xc2, 0xa8, 0x00, 2 }, { 0xc5, 0xa0, 0x00, 2 }, { 0xc4, 0x92, 0x00, 2 }, { 0xc4, 0xa2, 0x00, 2 },
+		{ 0xc5, 0xa6, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc5, 0xbd, 0x00, 2 }, { 0xc2, 0xaf, 0x00, 2 },
+		{ 0xc2, 0xb0, 0x00, 2 }, { 0xc4, 0x85, 0x00, 2 }, { 0xcb, 0x9b, 0x00, 2 }, { 0xc5, 0x97, 0x00, 2 },
+		{ 0xc2, 0xb4, 0x00, 2 }, { 0xc4, 0xa9, 0x00, 2 }, { 0xc4, 0xbc, 0x00, 2 }, { 0xcb, 0x87, 0x00, 2 },
+		{ 0xc2, 0xb8, 0x00, 2 }, { 0xc5, 0xa1, 0x00, 2 }, { 0xc4, 0x93, 0x00, 2 }, { 0xc4, 0xa3, 0x00, 2 },
+		{ 0xc5, 0xa7, 0x00, 2 }, { 0xc5, 0x8a, 0x00, 2 }, { 0xc5, 0xbe, 0x00, 2 }, { 0xc5, 0x8b, 0x00, 2 },
+		{ 0xc4, 0x80, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc3, 0x83, 0x00, 2 },
+		{ 0xc3, 0x84, 0x00, 2 }, { 0xc3, 0x85, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 }, { 0xc4, 0xae, 0x00, 2 },
+		{ 0xc4, 0x8c, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc4, 0x98, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+		{ 0xc4, 0x96, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc4, 0xaa, 0x00, 2 },
+		{ 0xc4, 0x90, 0x00, 2 }, { 0xc5, 0x85, 0x00, 2 }, { 0xc5, 0x8c, 0x00, 2 }, { 0xc4, 0xb6, 0x00, 2 },
+		{ 0xc3, 0x94, 0x00, 2 }, { 0xc3, 0x95, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+		{ 0xc3, 0x98, 0x00, 2 }, { 0xc5, 0xb2, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc3, 0x9b, 0x00, 2 },
+		{ 0xc3, 0x9c, 0x00, 2 }, { 0xc5, 0xa8, 0x00, 2 }, { 0xc5, 0xaa, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+		{ 0xc4, 0x81, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xc3, 0xa3, 0x00, 2 },
+		{ 0xc3, 0xa4, 0x00, 2 }, { 0xc3, 0xa5, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 }, { 0xc4, 0xaf, 0x00, 2 },
+		{ 0xc4, 0x8d, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc4, 0x99, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+		{ 0xc4, 0x97, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc4, 0xab, 0x00, 2 },
+		{ 0xc4, 0x91, 0x00, 2 }, { 0xc5, 0x86, 0x00, 2 }, { 0xc5, 0x8d, 0x00, 2 }, { 0xc4, 0xb7, 0x00, 2 },
+		{ 0xc3, 0xb4, 0x00, 2 }, { 0xc3, 0xb5, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+		{ 0xc3, 0xb8, 0x00, 2 }, { 0xc5, 0xb3, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 },
+		{ 0xc3, 0xbc, 0x00, 2 }, { 0xc5, 0xa9, 0x00, 2 }, { 0xc5, 0xab, 0x00, 2 }, { 0xcb, 0x99, 0x00, 2 },
+	},
+	{
+		1, 2, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	iso8859_4_rev,
+	0
+};
+
+static const unsigned short iso8859_5_rev[3][256] = {
+	{
+		0x100, 0x101, 0x102, 0x103, 0x104, 0x105, 0x106, 0x107,
+		0x108, 0x109, 0x10a, 0x10b, 0x10c, 0x10d, 0x10e, 0x10f,
+		0x110, 0x111, 0x112, 0x113, 0x114, 0x115, 0x116, 0x117,
+		0x118, 0x119, 0x11a, 0x11b, 0x11c, 0x11d, 0x11e, 0x11f,
+		0x120, 0x121, 0x122, 0x123, 0x124, 0x125, 0x126, 0x127,
+		0x128, 0x129, 0x12a, 0x12b, 0x12c, 0x12d, 0x12e, 0x12f,
+		0x130, 0x131, 0x132, 0x133, 0x134, 0x135, 0x136, 0x137,
+		0x138, 0x139, 0x13a, 0x13b, 0x13c, 0x13d, 0x13e, 0x13f,
+		0x140, 0x141, 0x142, 0x143, 0x144, 0x145, 0x146, 0x147,
+		0x148, 0x149, 0x14a, 0x14b, 0x14c, 0x14d, 0x14e, 0x14f,
+		0x150, 0x151, 0x152, 0x153, 0x154, 0x155, 0x156, 0x157,
+		0x158, 0x159, 0x15a, 0x15b, 0x15c, 0x15d, 0x15e, 0x15f,
+		0x160, 0x161, 0x162, 0x163, 0x164, 0x165, 0x166, 0x167,
+		0x168, 0x169, 0x16a, 0x16b, 0x16c, 0x16d, 0x16e, 0x16f,
+		0x170, 0x171, 0x172, 0x173, 0x174, 0x175, 0x176, 0x177,
+		0x178, 0x179, 0x17a, 0x17b, 0x17c, 0x17d, 0x17e, 0x17f,
+		0x180, 0x181, 0x182, 0x183, 0x184, 0x185, 0x186, 0x187,
+		0x188, 0x189, 0x18a, 0x18b, 0x18c, 0x18d, 0x18e, 0x18f,
+		0x190, 0x191, 0x192, 0x193, 0x194, 0x195, 0x196, 0x197,
+		0x198, 0x199, 0x19a, 0x19b, 0x19c, 0x19d, 0x19e, 0x19f,
+		0x1a0, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1fd,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x1ad, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+	{
+		0x000, 0x1a1, 0x1a2, 0x1a3, 0x1a4, 0x1a5, 0x1a6, 0x1a7,
+		0x1a8, 0x1a9, 0x1aa, 0x1ab, 0x1ac, 0x000, 0x1ae, 0x1af,
+		0x1b0, 0x1b1, 0x1b2, 0x1b3, 0x1b4, 0x1b5, 0x1b6, 0x1b7,
+		0x1b8, 0x1b9, 0x1ba, 0x1bb, 0x1bc, 0x1bd, 0x1be, 0x1bf,
+		0x1c0, 0x1c1, 0x1c2, 0x1c3, 0x1c4, 0x1c5, 0x1c6, 0x1c7,
+		0x1c8, 0x1c9, 0x1ca, 0x1cb, 0x1cc, 0x1cd, 0x1ce, 0x1cf,
+		0x1d0, 0x1d1, 0x1d2, 0x1d3, 0x1d4, 0x1d5, 0x1d6, 0x1d7,
+		0x1d8, 0x1d9, 0x1da, 0x1db, 0x1dc, 0x1dd, 0x1de, 0x1df,
+		0x1e0, 0x1e1, 0x1e2, 0x1e3, 0x1e4, 0x1e5, 0x1e6, 0x1e7,
+		0x1e8, 0x1e9, 0x1ea, 0x1eb, 0x1ec, 0x1ed, 0x1ee, 0x1ef,
+		0x000, 0x1f1, 0x1f2, 0x1f3, 0x1f4, 0x1f5, 0x1f6, 0x1f7,
+		0x1f8, 0x1f9, 0x1fa, 0x1fb, 0x1fc, 0x000, 0x1fe, 0x1ff,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+	{
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1f0, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+};
+
+static const struct cstab iso8859_5 = {
+	"iso8859-5",
+	{
+		{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+		{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+		{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+		{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+		{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+		{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+		{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+		{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+		{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+		{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+		{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+		{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+		{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+		{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+		{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+		{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+		{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+		{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+		{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+		{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+		{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+		{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+		{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+		{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+		{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+		{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+		{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+		{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+		{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+		{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+		{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+		{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+		{ 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+		{ 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+		{ 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+		{ 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+		{ 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+		{ 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+		{ 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+		{ 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+		{ 0xc2, 0xa0, 0x00, 2 }, { 0xd0, 0x81, 0x00, 2 }, { 0xd0, 0x82, 0x00, 2 }, { 0xd0, 0x83, 0x00, 2 },
+		{ 0xd0, 0x84, 0x00, 2 }, { 0xd0, 0x85, 0x00, 2 }, { 0xd0, 0x86, 0x00, 2 }, { 0xd0, 0x87, 0x00, 2 },
+		{ 0xd0, 0x88, 0x00, 2 }, { 0xd0, 0x89, 0x00, 2 }, { 0xd0, 0x8a, 0x00, 2 }, { 0xd0, 0x8b, 0x00, 2 },
+		{ 0xd0, 0x8c, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xd0, 0x8e, 0x00, 2 }, { 0xd0, 0x8f, 0x00, 2 },
+		{ 0xd0, 0x90, 0x00, 2 }, { 0xd0, 0x91, 0x00, 2 }, { 0xd0, 0x92, 0x00, 2 }, { 0xd0, 0x93, 0x00, 2 },
+		{ 0xd0, 0x94, 0x00, 2 }, { 0xd0, 0x95, 0x00, 2 }, { 0xd0, 0x96, 0x00, 2 }, { 0xd0, 0x97, 0x00, 2 },
+		{ 0xd0, 0x98, 0x00, 2 }, { 0xd0, 0x99, 0x00, 2 }, { 0xd0, 0x9a, 0x00, 2 }, { 0xd0, 0x9b, 0x00, 2 },
+		{ 0xd0, 0x9c, 0x00, 2 }, { 0xd0, 0x9d, 0x00, 2 }, { 0xd0, 0x9e, 0x00, 2 }, { 0xd0, 0x9f, 0x00, 2 },
+		{ 0xd0, 0xa0, 0x00, 2 }, { 0xd0, 0xa1, 0x00, 2 }, { 0xd0, 0xa2, 0x00, 2 }, { 0xd0, 0xa3, 0x00, 2 },
+		{ 0xd0, 0xa4, 0x00, 2 }, { 0xd0, 0xa5, 0x00, 2 }, { 0xd0, 0xa6, 0x00, 2 }, { 0xd0, 0xa7, 0x00, 2 },
+		{ 0xd0, 0xa8, 0x00, 2 }, { 0xd0, 0xa9, 0x00, 2 }, { 0xd0, 0xaa, 0x00, 2 }, { 0xd0, 0xab, 0x00, 2 },
+		{ 0xd0, 0xac, 0x00, 2 }, { 0xd0, 0xad, 0x00, 2 }, { 0xd0, 0xae, 0x00, 2 }, { 0xd0, 0xaf, 0x00, 2 },
+		{ 0xd0, 0xb0, 0x00, 2 }, { 0xd0, 0xb1, 0x00, 2 }, { 0xd0, 0xb2, 0x00, 2 }, { 0xd0, 0xb3, 0x00, 2 },
+		{ 0xd0, 0xb4, 0x00, 2 }, { 0xd0, 0xb5, 0x00, 2 }, { 0xd0, 0xb6, 0x00, 2 }, { 0xd0, 0xb7, 0x00, 2 },
+		{ 0xd0, 0xb8, 0x00, 2 }, { 0xd0, 0xb9, 0x00, 2 }, { 0xd0, 0xba, 0x00, 2 }, { 0xd0, 0xbb, 0x00, 2 },
+		{ 0xd0, 0xbc, 0x00, 2 }, { 0xd0, 0xbd, 0x00, 2 }, { 0xd0, 0xbe, 0x00, 2 }, { 0xd0, 0xbf, 0x00, 2 },
+		{ 0xd1, 0x80, 0x00, 2 }, { 0xd1, 0x81, 0x00, 2 }, { 0xd1, 0x82, 0x00, 2 }, { 0xd1, 0x83, 0x00, 2 },
+		{ 0xd1, 0x84, 0x00, 2 }, { 0xd1, 0x85, 0x00, 2 }, { 0xd1, 0x86, 0x00, 2 }, { 0xd1, 0x87, 0x00, 2 },
+		{ 0xd1, 0x88, 0x00, 2 }, { 0xd1, 0x89, 0x00, 2 }, { 0xd1, 0x8a, 0x00, 2 }, { 0xd1, 0x8b, 0x00, 2 },
+		{ 0xd1, 0x8c, 0x00, 2 }, { 0xd1, 0x8d, 0x00, 2 }, { 0xd1, 0x8e, 0x00, 2 }, { 0xd1, 0x8f, 0x00, 2 },
+		{ 0xe2, 0x84, 0x96, 3 }, { 0xd1, 0x91, 0x00, 2 }, { 0xd1, 0x92, 0x00, 2 }, { 0xd1, 0x93, 0x00, 2 },
+		{ 0xd1, 0x94, 0x00, 2 }, { 0xd1, 0x95, 0x00, 2 }, { 0xd1, 0x96, 0x00, 2 }, { 0xd1, 0x97, 0x00, 2 },
+		{ 0xd1, 0x98, 0x00, 2 }, { 0xd1, 0x99, 0x00, 2 }, { 0xd1, 0x9a, 0x00, 2 }, { 0xd1, 0x9b, 0x00, 2 },
+		{ 0xd1, 0x9c, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 }, { 0xd1, 0x9e, 0x00, 2 }, { 0xd1, 0x9f, 0x00, 2 },
+	},
+	{
+		1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	iso8859_5_rev,
+	0
+};
+
+static const unsigned short iso8859_6_rev[2][256] = {
+	{
+		0x100, 0x101, 0x102, 0x103, 0x104, 0x105, 0x106, 0x107,
+		0x108, 0x109, 0x10a, 0x10b, 0x10c, 0x10d, 0x10e, 0x10f,
+		0x110, 0x111, 0x112, 0x113, 0x114, 0x115, 0x116, 0x117,
+		0x118, 0x119, 0x11a, 0x11b, 0x11c, 0x11d, 0x11e, 0x11f,
+		0x120, 0x121, 0x122, 0x123, 0x124, 0x125, 0x126, 0x127,
+		0x128, 0x129, 0x12a, 0x12b, 0x12c, 0x12d, 0x12e, 0x12f,
+		0x130, 0x131, 0x132, 0x133, 0x134, 0x135, 0x136, 0x137,
+		0x138, 0x139, 0x13a, 0x13b, 0x13c, 0x13d, 0x13e, 0x13f,
+		0x140, 0x141, 0x142, 0x143, 0x144, 0x145, 0x146, 0x147,
+		0x148, 0x149, 0x14a, 0x14b, 0x14c, 0x14d, 0x14e, 0x14f,
+		0x150, 0x151, 0x152, 0x153, 0x154, 0x155, 0x156, 0x157,
+		0x158, 0x159, 0x15a, 0x15b, 0x15c, 0x15d, 0x15e, 0x15f,
+		0x160, 0x161, 0x162, 0x163, 0x164, 0x165, 0x166, 0x167,
+		0x168, 0x169, 0x16a, 0x16b, 0x16c, 0x16d, 0x16e, 0x16f,
+		0x170, 0x171, 0x172, 0x173, 0x174, 0x175, 0x176, 0x177,
+		0x178, 0x179, 0x17a, 0x17b, 0x17c, 0x17d, 0x17e, 0x17f,
+		0x180, 0x181, 0x182, 0x183, 0x184, 0x185, 0x186, 0x187,
+		0x188, 0x189, 0x18a, 0x18b, 0x18c, 0x18d, 0x18e, 0x18f,
+		0x190, 0x191, 0x192, 0x193, 0x194, 0x195, 0x196, 0x197,
+		0x198, 0x199, 0x19a, 0x19b, 0x19c, 0x19d, 0x19e, 0x19f,
+		0x1a0, 0x000, 0x000, 0x000, 0x1a4, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x1ad, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+	{
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x1ac, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x1bb, 0x000, 0x000, 0x000, 0x1bf,
+		0x000, 0x1c1, 0x1c2, 0x1c3, 0x1c4, 0x1c5, 0x1c6, 0x1c7,
+		0x1c8, 0x1c9, 0x1ca, 0x1cb, 0x1cc, 0x1cd, 0x1ce, 0x1cf,
+		0x1d0, 0x1d1, 0x1d2, 0x1d3, 0x1d4, 0x1d5, 0x1d6, 0x1d7,
+		0x1d8, 0x1d9, 0x1da, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1e0, 0x1e1, 0x1e2, 0x1e3, 0x1e4, 0x1e5, 0x1e6, 0x1e7,
+		0x1e8, 0x1e9, 0x1ea, 0x1eb, 0x1ec, 0x1ed, 0x1ee, 0x1ef,
+		0x1f0, 0x1f1, 0x1f2, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+};
+
+static const struct cstab iso8859_6 = {
+	"iso8859-6",
+	{
+		{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+		{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+		{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+		{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+		{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+		{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+		{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+		{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+		{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+		{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+		{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+		{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+		{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+		{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+		{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+		{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+		{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+		{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+		{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+		{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+		{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+		{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+		{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+		{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+		{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+		{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+		{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+		{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+		{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+		{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+		{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+		{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+		{ 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+		{ 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+		{ 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+		{ 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+		{ 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+		{ 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+		{ 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+		{ 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+		{ 0xc2, 0xa0, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+		{ 0xc2, 0xa4, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+		{ 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+		{ 0xd8, 0x8c, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+		{ 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+		{ 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+		{ 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0xd8, 0x9b, 0x00, 2 },
+		{ 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0xd8, 0x9f, 0x00, 2 },
+		{ 0x00, 0x00, 0x00, 0 }, { 0xd8, 0xa1, 0x00, 2 }, { 0xd8, 0xa2, 0x00, 2 }, { 0xd8, 0xa3, 0x00, 2 },
+		{ 0xd8, 0xa4, 0x00, 2 }, { 0xd8, 0xa5, 0x00, 2 }, { 0xd8, 0xa6, 0x00, 2 }, { 0xd8, 0xa7, 0x00, 2 },
+		{ 0xd8, 0xa8, 0x00, 2 }, { 0xd8, 0xa9, 0x00, 2 }, { 0xd8, 0xaa, 0x00, 2 }, { 0xd8, 0xab, 0x00, 2 },
+		{ 0xd8, 0xac, 0x00, 2 }, { 0xd8, 0xad, 0x00, 2 }, { 0xd8, 0xae, 0x00, 2 }, { 0xd8, 0xaf, 0x00, 2 },
+		{ 0xd8, 0xb0, 0x00, 2 }, { 0xd8, 0xb1, 0x00, 2 }, { 0xd8, 0xb2, 0x00, 2 }, { 0xd8, 0xb3, 0x00, 2 },
+		{ 0xd8, 0xb4, 0x00, 2 }, { 0xd8, 0xb5, 0x00, 2 }, { 0xd8, 0xb6, 0x00, 2 }, { 0xd8, 0xb7, 0x00, 2 },
+		{ 0xd8, 0xb8, 0x00, 2 }, { 0xd8, 0xb9, 0x00, 2 }, { 0xd8, 0xba, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 },
+		{ 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+		{ 0xd9, 0x80, 0x00, 2 }, { 0xd9, 0x81, 0x00, 2 }, { 0xd9, 0x82, 0x00, 2 }, { 0xd9, 0x83, 0x00, 2 },
+		{ 0xd9, 0x84, 0x00, 2 }, { 0xd9, 0x85, 0x00, 2 }, { 0xd9, 0x86, 0x00, 2 }, { 0xd9, 0x87, 0x00, 2 },
+		{ 0xd9, 0x88, 0x00, 2 }, { 0xd9, 0x89, 0x00, 2 }, { 0xd9, 0x8a, 0x00, 2 }, { 0xd9, 0x8b, 0x00, 2 },
+		{ 0xd9, 0x8c, 0x00, 2 }, { 0xd9, 0x8d, 0x00, 2 }, { 0xd9, 0x8e, 0x00, 2 }, { 0xd9, 0x8f, 0x00, 2 },
+		{ 0xd9, 0x90, 0x00, 2 }, { 0xd9, 0x91, 0x00, 2 }, { 0xd9, 0x92, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 },
+		{ 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+		{ 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+		{ 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+	},
+	{
+		1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	iso8859_6_rev,
+	0
+};
+
+static const unsigned short iso8859_7_rev[3][256] = {
+	{
+		0x100, 0x101, 0x102, 0x103, 0x104, 0x105, 0x106, 0x107,
+		0x108, 0x109, 0x10a, 0x10b, 0x10c, 0x10d, 0x10e, 0x10f,
+		0x110, 0x111, 0x112, 0x113, 0x114, 0x115, 0x116, 0x117,
+		0x118, 0x119, 0x11a, 0x11b, 0x11c, 0x11d, 0x11e, 0x11f,
+		0x120, 0x121, 0x122, 0x123, 0x124, 0x125, 0x126, 0x127,
+		0x128, 0x129, 0x12a, 0x12b, 0x12c, 0x12d, 0x12e, 0x12f,
+		0x130, 0x131, 0x132, 0x133, 0x134, 0x135, 0x136, 0x137,
+		0x138, 0x139, 0x13a, 0x13b, 0x13c, 0x13d, 0x13e, 0x13f,
+		0x140, 0x141, 0x142, 0x143, 0x144, 0x145, 0x146, 0x147,
+		0x148, 0x149, 0x14a, 0x14b, 0x14c, 0x14d, 0x14e, 0x14f,
+		0x150, 0x151, 0x152, 0x153, 0x154, 0x155, 0x156, 0x157,
+		0x158, 0x159, 0x15a, 0x15b, 0x15c, 0x15d, 0x15e, 0x15f,
+		0x160, 0x161, 0x162, 0x163, 0x164, 0x165, 0x166, 0x167,
+		0x168, 0x169, 0x16a, 0x16b, 0x16c, 0x16d, 0x16e, 0x16f,
+		0x170, 0x171, 0x172, 0x173, 0x174, 0x175, 0x176, 0x177,
+		0x178, 0x179, 0x17a, 0x17b, 0x17c, 0x17d, 0x17e, 0x17f,
+		0x180, 0x181, 0x182, 0x183, 0x184, 0x185, 0x186, 0x187,
+		0x188, 0x189, 0x18a, 0x18b, 0x18c, 0x18d, 0x18e, 0x18f,
+		0x190, 0x191, 0x192, 0x193, 0x194, 0x195, 0x196, 0x197,
+		0x198, 0x199, 0x19a, 0x19b, 0x19c, 0x19d, 0x19e, 0x19f,
+		0x1a0, 0x000, 0x000, 0x1a3, 0x000, 0x000, 0x1a6, 0x1a7,
+		0x1a8, 0x1a9, 0x000, 0x1ab, 0x1ac, 0x1ad, 0x000, 0x000,
+		0x1b0, 0x1b1, 0x1b2, 0x1b3, 0x000, 0x000, 0x000, 0x1b7,
+		0x000, 0x000, 0x000, 0x1bb, 0x000, 0x1bd, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+	{
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x1af, 0x000, 0x000,
+		0x1a1, 0x1a2, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x1a4, 0x000, 0x000, 0x1a5,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+	{
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x1aa, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x1b4, 0x1b5, 0x1b6, 0x000,
+		0x1b8, 0x1b9, 0x1ba, 0x000, 0x1bc, 0x000, 0x1be, 0x1bf,
+		0x1c0, 0x1c1, 0x1c2, 0x1c3, 0x1c4, 0x1c5, 0x1c6, 0x1c7,
+		0x1c8, 0x1c9, 0x1ca, 0x1cb, 0x1cc, 0x1cd, 0x1ce, 0x1cf,
+		0x1d0, 0x1d1, 0x000, 0x1d3, 0x1d4, 0x1d5, 0x1d6, 0x1d7,
+		0x1d8, 0x1d9, 0x1da, 0x1db, 0x1dc, 0x1dd, 0x1de, 0x1df,
+		0x1e0, 0x1e1, 0x1e2, 0x1e3, 0x1e4, 0x1e5, 0x1e6, 0x1e7,
+		0x1e8, 0x1e9, 0x1ea, 0x1eb, 0x1ec, 0x1ed, 0x1ee, 0x1ef,
+		0x1f0, 0x1f1, 0x1f2, 0x1f3, 0x1f4, 0x1f5, 0x1f6, 0x1f7,
+		0x1f8, 0x1f9, 0x1fa, 0x1fb, 0x1fc, 0x1fd, 0x1fe, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+};
+
+static const struct cstab iso8859_7 = {
+	"iso8859-7",
+	{
+		{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+		{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+		{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+		{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+		{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+		{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+		{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+		{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+		{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+		{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+		{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+		{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+		{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+		{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+		{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+		{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+		{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+		{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+		{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+		{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+		{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+		{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+		{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+		{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+		{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+		{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+		{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+		{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+		{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+		{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+		{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+		{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+		{ 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+		{ 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+		{ 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+		{ 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+		{ 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+		{ 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+		{ 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+		{ 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+		{ 0xc2, 0xa0, 0x00, 2 }, { 0xe2, 0x80, 0x98, 3 }, { 0xe2, 0x80, 0x99, 3 }, { 0xc2, 0xa3, 0x00, 2 },
+		{ 0xe2, 0x82, 0xac, 3 }, { 0xe2, 0x82, 0xaf, 3 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+		{ 0xc2, 0xa8, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xcd, 0xba, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+		{ 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0x95, 3 },
+		{ 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+		{ 0xce, 0x84, 0x00, 2 }, { 0xce, 0x85, 0x00, 2 }, { 0xce, 0x86, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+		{ 0xce, 0x88, 0x00, 2 }, { 0xce, 0x89, 0x00, 2 }, { 0xce, 0x8a, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+		{ 0xce, 0x8c, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0xce, 0x8e, 0x00, 2 }, { 0xce, 0x8f, 0x00, 2 },
+		{ 0xce, 0x90, 0x00, 2 }, { 0xce, 0x91, 0x00, 2 }, { 0xce, 0x92, 0x00, 2 }, { 0xce, 0x93, 0x00, 2 },
+		{ 0xce, 0x94, 0x00, 2 }, { 0xce, 0x95, 0x00, 2 }, { 0xce, 0x96, 0x00, 2 }, { 0xce, 0x97, 0x00, 2 },
+		{ 0xce, 0x98, 0x00, 2 }, { 0xce, 0x99, 0x00, 2 }, { 0xce, 0x9a, 0x00, 2 }, { 0xce, 0x9b, 0x00, 2 },
+		{ 0xce, 0x9c, 0x00, 2 }, { 0xce, 0x9d, 0x00, 2 }, { 0xce, 0x9e, 0x00, 2 }, { 0xce, 0x9f, 0x00, 2 },
+		{ 0xce, 0xa0, 0x00, 2 }, { 0xce, 0xa1, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0xce, 0xa3, 0x00, 2 },
+		{ 0xce, 0xa4, 0x00, 2 }, { 0xce, 0xa5, 0x00, 2 }, { 0xce, 0xa6, 0x00, 2 }, { 0xce, 0xa7, 0x00, 2 },
+		{ 0xce, 0xa8, 0x00, 2 }, { 0xce, 0xa9, 0x00, 2 }, { 0xce, 0xaa, 0x00, 2 }, { 0xce, 0xab, 0x00, 2 },
+		{ 0xce, 0xac, 0x00, 2 }, { 0xce, 0xad, 0x00, 2 }, { 0xce, 0xae, 0x00, 2 }, { 0xce, 0xaf, 0x00, 2 },
+		{ 0xce, 0xb0, 0x00, 2 }, { 0xce, 0xb1, 0x00, 2 }, { 0xce, 0xb2, 0x00, 2 }, { 0xce, 0xb3, 0x00, 2 },
+		{ 0xce, 0xb4, 0x00, 2 }, { 0xce, 0xb5, 0x00, 2 }, { 0xce, 0xb6, 0x00, 2 }, { 0xce, 0xb7, 0x00, 2 },
+		{ 0xce, 0xb8, 0x00, 2 }, { 0xce, 0xb9, 0x00, 2 }, { 0xce, 0xba, 0x00, 2 }, { 0xce, 0xbb, 0x00, 2 },
+		{ 0xce, 0xbc, 0x00, 2 }, { 0xce, 0xbd, 0x00, 2 }, { 0xce, 0xbe, 0x00, 2 }, { 0xce, 0xbf, 0x00, 2 },
+		{ 0xcf, 0x80, 0x00, 2 }, { 0xcf, 0x81, 0x00, 2 }, { 0xcf, 0x82, 0x00, 2 }, { 0xcf, 0x83, 0x00, 2 },
+		{ 0xcf, 0x84, 0x00, 2 }, { 0xcf, 0x85, 0x00, 2 }, { 0xcf, 0x86, 0x00, 2 }, { 0xcf, 0x87, 0x00, 2 },
+		{ 0xcf, 0x88, 0x00, 2 }, { 0xcf, 0x89, 0x00, 2 }, { 0xcf, 0x8a, 0x00, 2 }, { 0xcf, 0x8b, 0x00, 2 },
+		{ 0xcf, 0x8c, 0x00, 2 }, { 0xcf, 0x8d, 0x00, 2 }, { 0xcf, 0x8e, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 },
+	},
+	{
+		1, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	iso8859_7_rev,
+	0
+};
+
+static const unsigned short iso8859_8_rev[3][256] = {
+	{
+		0x100, 0x101, 0x102, 0x103, 0x104, 0x105, 0x106, 0x107,
+		0x108, 0x109, 0x10a, 0x10b, 0x10c, 0x10d, 0x10e, 0x10f,
+		0x110, 0x111, 0x112, 0x113, 0x114, 0x115, 0x116, 0x117,
+		0x118, 0x119, 0x11a, 0x11b, 0x11c, 0x11d, 0x11e, 0x11f,
+		0x120, 0x121, 0x122, 0x123, 0x124, 0x125, 0x126, 0x127,
+		0x128, 0x129, 0x12a, 0x12b, 0x12c, 0x12d, 0x12e, 0x12f,
+		0x130, 0x131, 0x132, 0x133, 0x134, 0x135, 0x136, 0x137,
+		0x138, 0x139, 0x13a, 0x13b, 0x13c, 0x13d, 0x13e, 0x13f,
+		0x140, 0x141, 0x142, 0x143, 0x144, 0x145, 0x146, 0x147,
+		0x148, 0x149, 0x14a, 0x14b, 0x14c, 0x14d, 0x14e, 0x14f,
+		0x150, 0x151, 0x152, 0x153, 0x154, 0x155, 0x156, 0x157,
+		0x158, 0x159, 0x15a, 0x15b, 0x15c, 0x15d, 0x15e, 0x15f,
+		0x160, 0x161, 0x162, 0x163, 0x164, 0x165, 0x166, 0x167,
+		0x168, 0x169, 0x16a, 0x16b, 0x16c, 0x16d, 0x16e, 0x16f,
+		0x170, 0x171, 0x172, 0x173, 0x174, 0x175, 0x176, 0x177,
+		0x178, 0x179, 0x17a, 0x17b, 0x17c, 0x17d, 0x17e, 0x17f,
+		0x180, 0x181, 0x182, 0x183, 0x184, 0x185, 0x186, 0x187,
+		0x188, 0x189, 0x18a, 0x18b, 0x18c, 0x18d, 0x18e, 0x18f,
+		0x190, 0x191, 0x192, 0x193, 0x194, 0x195, 0x196, 0x197,
+		0x198, 0x199, 0x19a, 0x19b, 0x19c, 0x19d, 0x19e, 0x19f,
+		0x1a0, 0x000, 0x1a2, 0x1a3, 0x1a4, 0x1a5, 0x1a6, 0x1a7,
+		0x1a8, 0x1a9, 0x000, 0x1ab, 0x1ac, 0x1ad, 0x1ae, 0x1af,
+		0x1b0, 0x1b1, 0x1b2, 0x1b3, 0x1b4, 0x1b5, 0x1b6, 0x1b7,
+		0x1b8, 0x1b9, 0x000, 0x1bb, 0x1bc, 0x1bd, 0x1be, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1aa,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1ba,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+	{
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1fd, 0x1fe,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1df,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+	{
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1e0, 0x1e1, 0x1e2, 0x1e3, 0x1e4, 0x1e5, 0x1e6, 0x1e7,
+		0x1e8, 0x1e9, 0x1ea, 0x1eb, 0x1ec, 0x1ed, 0x1ee, 0x1ef,
+		0x1f0, 0x1f1, 0x1f2, 0x1f3, 0x1f4, 0x1f5, 0x1f6, 0x1f7,
+		0x1f8, 0x1f9, 0x1fa, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+};
+
+static const struct cstab iso8859_8 = {
+	"iso8859-8",
+	{
+		{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+		{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+		{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+		{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+		{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+		{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+		{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+		{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+		{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+		{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+		{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+		{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+		{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+		{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+		{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+		{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+		{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+		{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+		{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+		{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+		{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+		{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+		{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+		{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+		{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+		{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+		{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+		{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+		{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+		{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+		{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+		{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+		{ 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+		{ 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+		{ 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+		{ 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+		{ 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+		{ 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+		{ 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+		{ 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+		{ 0xc2, 0xa0, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0xc2, 0xa2, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+		{ 0xc2, 0xa4, 0x00, 2 }, { 0xc2, 0xa5, 0x00, 2 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+		{ 0xc2, 0xa8, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+		{ 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc2, 0xaf, 0x00, 2 },
+		{ 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+		{ 0xc2, 0xb4, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+		{ 0xc2, 0xb8, 0x00, 2 }, { 0xc2, 0xb9, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+		{ 0xc2, 0xbc, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0xc2, 0xbe, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 },
+		{ 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+		{ 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+		{ 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+		{ 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+		{ 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+		{ 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+		{ 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+		{ 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0x97, 3 },
+		{ 0xd7, 0x90, 0x00, 2 }, { 0xd7, 0x91, 0x00, 2 }, { 0xd7, 0x92, 0x00, 2 }, { 0xd7, 0x93, 0x00, 2 },
+		{ 0xd7, 0x94, 0x00, 2 }, { 0xd7, 0x95, 0x00, 2 }, { 0xd7, 0x96, 0x00, 2 }, { 0xd7, 0x97, 0x00, 2 },
+		{ 0xd7, 0x98, 0x00, 2 }, { 0xd7, 0x99, 0x00, 2 }, { 0xd7, 0x9a, 0x00, 2 }, { 0xd7, 0x9b, 0x00, 2 },
+		{ 0xd7, 0x9c, 0x00, 2 }, { 0xd7, 0x9d, 0x00, 2 }, { 0xd7, 0x9e, 0x00, 2 }, { 0xd7, 0x9f, 0x00, 2 },
+		{ 0xd7, 0xa0, 0x00, 2 }, { 0xd7, 0xa1, 0x00, 2 }, { 0xd7, 0xa2, 0x00, 2 }, { 0xd7, 0xa3, 0x00, 2 },
+		{ 0xd7, 0xa4, 0x00, 2 }, { 0xd7, 0xa5, 0x00, 2 }, { 0xd7, 0xa6, 0x00, 2 }, { 0xd7, 0xa7, 0x00, 2 },
+		{ 0xd7, 0xa8, 0x00, 2 }, { 0xd7, 0xa9, 0x00, 2 }, { 0xd7, 0xaa, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 },
+		{ 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0x8e, 3 }, { 0xe2, 0x80, 0x8f, 3 }, { 0x00, 0x00, 0x00, 0 },
+	},
+	{
+		1, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	iso8859_8_rev,
+	0
+};
+
+static const unsigned short iso8859_9_rev[2][256] = {
+	{
+		0x100, 0x101, 0x102, 0x103, 0x104, 0x105, 0x106, 0x107,
+		0x108, 0x109, 0x10a, 0x10b, 0x10c, 0x10d, 0x10e, 0x10f,
+		0x110, 0x111, 0x112, 0x113, 0x114, 0x115, 0x116, 0x117,
+		0x118, 0x119, 0x11a, 0x11b, 0x11c, 0x11d, 0x11e, 0x11f,
+		0x120, 0x121, 0x122, 0x123, 0x124, 0x125, 0x126, 0x127,
+		0x128, 0x129, 0x12a, 0x12b, 0x12c, 0x12d, 0x12e, 0x12f,
+		0x130, 0x131, 0x132, 0x133, 0x134, 0x135, 0x136, 0x137,
+		0x138, 0x139, 0x13a, 0x13b, 0x13c, 0x13d, 0x13e, 0x13f,
+		0x140, 0x141, 0x142, 0x143, 0x144, 0x145, 0x146, 0x147,
+		0x148, 0x149, 0x14a, 0x14b, 0x14c, 0x14d, 0x14e, 0x14f,
+		0x150, 0x151, 0x152, 0x153, 0x154, 0x155, 0x156, 0x157,
+		0x158, 0x159, 0x15a, 0x15b, 0x15c, 0x15d, 0x15e, 0x15f,
+		0x160, 0x161, 0x162, 0x163, 0x164, 0x165, 0x166, 0x167,
+		0x168, 0x169, 0x16a, 0x16b, 0x16c, 0x16d, 0x16e, 0x16f,
+		0x170, 0x171, 0x172, 0x173, 0x174, 0x175, 0x176, 0x177,
+		0x178, 0x179, 0x17a, 0x17b, 0x17c, 0x17d, 0x17e, 0x17f,
+		0x180, 0x181, 0x182, 0x183, 0x184, 0x185, 0x186, 0x187,
+		0x188, 0x189, 0x18a, 0x18b, 0x18c, 0x18d, 0x18e, 0x18f,
+		0x190, 0x191, 0x192, 0x193, 0x194, 0x195, 0x196, 0x197,
+		0x198, 0x199, 0x19a, 0x19b, 0x19c, 0x19d, 0x19e, 0x19f,
+		0x1a0, 0x1a1, 0x1a2, 0x1a3, 0x1a4, 0x1a5, 0x1a6, 0x1a7,
+		0x1a8, 0x1a9, 0x1aa, 0x1ab, 0x1ac, 0x1ad, 0x1ae, 0x1af,
+		0x1b0, 0x1b1, 0x1b2, 0x1b3, 0x1b4, 0x1b5, 0x1b6, 0x1b7,
+		0x1b8, 0x1b9, 0x1ba, 0x1bb, 0x1bc, 0x1bd, 0x1be, 0x1bf,
+		0x1c0, 0x1c1, 0x1c2, 0x1c3, 0x1c4, 0x1c5, 0x1c6, 0x1c7,
+		0x1c8, 0x1c9, 0x1ca, 0x1cb, 0x1cc, 0x1cd, 0x1ce, 0x1cf,
+		0x000, 0x1d1, 0x1d2, 0x1d3, 0x1d4, 0x1d5, 0x1d6, 0x1d7,
+		0x1d8, 0x1d9, 0x1da, 0x1db, 0x1dc, 0x000, 0x000, 0x1df,
+		0x1e0, 0x1e1, 0x1e2, 0x1e3, 0x1e4, 0x1e5, 0x1e6, 0x1e7,
+		0x1e8, 0x1e9, 0x1ea, 0x1eb, 0x1ec, 0x1ed, 0x1ee, 0x1ef,
+		0x000, 0x1f1, 0x1f2, 0x1f3, 0x1f4, 0x1f5, 0x1f6, 0x1f7,
+		0x1f8, 0x1f9, 0x1fa, 0x1fb, 0x1fc, 0x000, 0x000, 0x1ff,
+	},
+	{
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1d0, 0x1f0,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1dd, 0x1fd, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1de, 0x1fe,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+};
+
+static const struct cstab iso8859_9 = {
+	"iso8859-9",
+	{
+		{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+		{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+		{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+		{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+		{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+		{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+		{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+		{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+		{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+		{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+		{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+		{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+		{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+		{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+		{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+		{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+		{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+		{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+		{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+		{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+		{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+		{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+		{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+		{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+		{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+		{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+		{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+		{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+		{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+		{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+		{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+		{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+		{ 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+		{ 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+		{ 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+		{ 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+		{ 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+		{ 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+		{ 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+		{ 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+		{ 0xc2, 0xa0, 0x00, 2 }, { 0xc2, 0xa1, 0x00, 2 }, { 0xc2, 0xa2, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+		{ 0xc2, 0xa4, 0x00, 2 }, { 0xc2, 0xa5, 0x00, 2 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+		{ 0xc2, 0xa8, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xc2, 0xaa, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+		{ 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc2, 0xaf, 0x00, 2 },
+		{ 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+		{ 0xc2, 0xb4, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+		{ 0xc2, 0xb8, 0x00, 2 }, { 0xc2, 0xb9, 0x00, 2 }, { 0xc2, 0xba, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+		{ 0xc2, 0xbc, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0xc2, 0xbe, 0x00, 2 }, { 0xc2, 0xbf, 0x00, 2 },
+		{ 0xc3, 0x80, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc3, 0x83, 0x00, 2 },
+		{ 0xc3, 0x84, 0x00, 2 }, { 0xc3, 0x85, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 }, { 0xc3, 0x87, 0x00, 2 },
+		{ 0xc3, 0x88, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc3, 0x8a, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+		{ 0xc3, 0x8c, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc3, 0x8f, 0x00, 2 },
+		{ 0xc4, 0x9e, 0x00, 2 }, { 0xc3, 0x91, 0x00, 2 }, { 0xc3, 0x92, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+		{ 0xc3, 0x94, 0x00, 2 }, { 0xc3, 0x95, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+		{ 0xc3, 0x98, 0x00, 2 }, { 0xc3, 0x99, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc3, 0x9b, 0x00, 2 },
+		{ 0xc3, 0x9c, 0x00, 2 }, { 0xc4, 0xb0, 0x00, 2 }, { 0xc5, 0x9e, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+		{ 0xc3, 0xa0, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xc3, 0xa3, 0x00, 2 },
+		{ 0xc3, 0xa4, 0x00, 2 }, { 0xc3, 0xa5, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+		{ 0xc3, 0xa8, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc3, 0xaa, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+		{ 0xc3, 0xac, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc3, 0xaf, 0x00, 2 },
+		{ 0xc4, 0x9f, 0x00, 2 }, { 0xc3, 0xb1, 0x00, 2 }, { 0xc3, 0xb2, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+		{ 0xc3, 0xb4, 0x00, 2 }, { 0xc3, 0xb5, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+		{ 0xc3, 0xb8, 0x00, 2 }, { 0xc3, 0xb9, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 },
+		{ 0xc3, 0xbc, 0x00, 2 }, { 0xc4, 0xb1, 0x00, 2 }, { 0xc5, 0x9f, 0x00, 2 }, { 0xc3, 0xbf, 0x00, 2 },
+	},
+	{
+		1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	iso8859_9_rev,
+	0
+};
+
+static const unsigned short iso8859_10_rev[3][256] = {
+	{
+		0x100, 0x101, 0x102, 0x103, 0x104, 0x105, 0x106, 0x107,
+		0x108, 0x109, 0x10a, 0x10b, 0x10c, 0x10d, 0x10e, 0x10f,
+		0x110, 0x111, 0x112, 0x113, 0x114, 0x115, 0x116, 0x117,
+		0x118, 0x119, 0x11a, 0x11b, 0x11c, 0x11d, 0x11e, 0x11f,
+		0x120, 0x121, 0x122, 0x123, 0x124, 0x125, 0x126, 0x127,
+		0x128, 0x129, 0x12a, 0x12b, 0x12c, 0x12d, 0x12e, 0x12f,
+		0x130, 0x131, 0x132, 0x133, 0x134, 0x135, 0x136, 0x137,
+		0x138, 0x139, 0x13a, 0x13b, 0x13c, 0x13d, 0x13e, 0x13f,
+		0x140, 0x141, 0x142, 0x143, 0x144, 0x145, 0x146, 0x147,
+		0x148, 0x149, 0x14a, 0x14b, 0x14c, 0x14d, 0x14e, 0x14f,
+		0x150, 0x151, 0x152, 0x153, 0x154, 0x155, 0x156, 0x157,
+		0x158, 0x159, 0x15a, 0x15b, 0x15c, 0x15d, 0x15e, 0x15f,
+		0x160, 0x161, 0x162, 0x163, 0x164, 0x165, 0x166, 0x167,
+		0x168, 0x169, 0x16a, 0x16b, 0x16c, 0x16d, 0x16e, 0x16f,
+		0x170, 0x171, 0x172, 0x173, 0x174, 0x175, 0x176, 0x177,
+		0x178, 0x179, 0x17a, 0x17b, 0x17c, 0x17d, 0x17e, 0x17f,
+		0x180, 0x181, 0x182, 0x183, 0x184, 0x185, 0x186, 0x187,
+		0x188, 0x189, 0x18a, 0x18b, 0x18c, 0x18d, 0x18e, 0x18f,
+		0x190, 0x191, 0x192, 0x193, 0x194, 0x195, 0x196, 0x197,
+		0x198, 0x199, 0x19a, 0x19b, 0x19c, 0x19d, 0x19e, 0x19f,
+		0x1a0, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1a7,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x1ad, 0x000, 0x000,
+		0x1b0, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1b7,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x1c1, 0x1c2, 0x1c3, 0x1c4, 0x1c5, 0x1c6, 0x000,
+		0x000, 0x1c9, 0x000, 0x1cb, 0x000, 0x1cd, 0x1ce, 0x1cf,
+		0x1d0, 0x000, 0x000, 0x1d3, 0x1d4, 0x1d5, 0x1d6, 0x000,
+		0x1d8, 0x000, 0x1da, 0x1db, 0x1dc, 0x1dd, 0x1de, 0x1df,
+		0x000, 0x1e1, 0x1e2, 0x1e3, 0x1e4, 0x1e5, 0x1e6, 0x000,
+		0x000, 0x1e9, 0x000, 0x1eb, 0x000, 0x1ed, 0x1ee, 0x1ef,
+		0x1f0, 0x000, 0x000, 0x1f3, 0x1f4, 0x1f5, 0x1f6, 0x000,
+		0x1f8, 0x000, 0x1fa, 0x1fb, 0x1fc, 0x1fd, 0x1fe, 0x000,
+	},
+	{
+		0x1c0, 0x1e0, 0x000, 0x000, 0x1a1, 0x1b1, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x1c8, 0x1e8, 0x000, 0x000,
+		0x1a9, 0x1b9, 0x1a2, 0x1b2, 0x000, 0x000, 0x1cc, 0x1ec,
+		0x1ca, 0x1ea, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x1a3, 0x1b3, 0x000, 0x000, 0x000, 0x000,
+		0x1a5, 0x1b5, 0x1a4, 0x1b4, 0x000, 0x000, 0x1c7, 0x1e7,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1a6, 0x1b6,
+		0x1ff, 0x000, 0x000, 0x1a8, 0x1b8, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x1d1, 0x1f1, 0x000,
+		0x000, 0x000, 0x1af, 0x1bf, 0x1d2, 0x1f2, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1aa, 0x1ba, 0x000, 0x000, 0x000, 0x000, 0x1ab, 0x1bb,
+		0x1d7, 0x1f7, 0x1ae, 0x1be, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x1d9, 0x1f9, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x1ac, 0x1bc, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+	{
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x1bd, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+};
+
+static const struct cstab iso8859_10 = {
+	"iso8859-10",
+	{
+		{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+		{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+		{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+		{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+		{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+		{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+		{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+		{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+		{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+		{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+		{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+		{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+		{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+		{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+		{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+		{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+		{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+		{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+		{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+		{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+		{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+		{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+		{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+		{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+		{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+		{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+		{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+		{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+		{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+		{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+		{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+		{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+		{ 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+		{ 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+		{ 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+		{ 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+		{ 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+		{ 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+		{ 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+		{ 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+		{ 0xc2, 0xa0, 0x00, 2 }, { 0xc4, 0x84, 0x00, 2 }, { 0xc4, 0x92, 0x00, 2 }, { 0xc4, 0xa2, 0x00, 2 },
+		{ 0xc4, 0xaa, 0x00, 2 }, { 0xc4, 0xa8, 0x00, 2 }, { 0xc4, 0xb6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+		{ 0xc4, 0xbb, 0x00, 2 }, { 0xc4, 0x90, 0x00, 2 }, { 0xc5, 0xa0, 0x00, 2 }, { 0xc5, 0xa6, 0x00, 2 },
+		{ 0xc5, 0xbd, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc5, 0xaa, 0x00, 2 }, { 0xc5, 0x8a, 0x00, 2 },
+		{ 0xc2, 0xb0, 0x00, 2 }, { 0xc4, 0x85, 0x00, 2 }, { 0xc4, 0x93, 0x00, 2 }, { 0xc4, 0xa3, 0x00, 2 },
+		{ 0xc4, 0xab, 0x00, 2 }, { 0xc4, 0xa9, 0x00, 2 }, { 0xc4, 0xb7, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+		{ 0xc4, 0xbc, 0x00, 2 }, { 0xc4, 0x91, 0x00, 2 }, { 0xc5, 0xa1, 0x00, 2 }, { 0xc5, 0xa7, 0x00, 2 },
+		{ 0xc5, 0xbe, 0x00, 2 }, { 0xe2, 0x80, 0x95, 3 }, { 0xc5, 0xab, 0x00, 2 }, { 0xc5, 0x8b, 0x00, 2 },
+		{ 0xc4, 0x80, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc3, 0x83, 0x00, 2 },
+		{ 0xc3, 0x84, 0x00, 2 }, { 0xc3, 0x85, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 }, { 0xc4, 0xae, 0x00, 2 },
+		{ 0xc4, 0x8c, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc4, 0x98, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+		{ 0xc4, 0x96, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc3, 0x8f, 0x00, 2 },
+		{ 0xc3, 0x90, 0x00, 2 }, { 0xc5, 0x85, 0x00, 2 }, { 0xc5, 0x8c, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+		{ 0xc3, 0x94, 0x00, 2 }, { 0xc3, 0x95, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc5, 0xa8, 0x00, 2 },
+		{ 0xc3, 0x98, 0x00, 2 }, { 0xc5, 0xb2, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc3, 0x9b, 0x00, 2 },
+		{ 0xc3, 0x9c, 0x00, 2 }, { 0xc3, 0x9d, 0x00, 2 }, { 0xc3, 0x9e, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+		{ 0xc4, 0x81, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xc3, 0xa3, 0x00, 2 },
+		{ 0xc3, 0xa4, 0x00, 2 }, { 0xc3, 0xa5, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 }, { 0xc4, 0xaf, 0x00, 2 },
+		{ 0xc4, 0x8d, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc4, 0x99, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+		{ 0xc4, 0x97, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc3, 0xaf, 0x00, 2 },
+		{ 0xc3, 0xb0, 0x00, 2 }, { 0xc5, 0x86, 0x00, 2 }, { 0xc5, 0x8d, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+		{ 0xc3, 0xb4, 0x00, 2 }, { 0xc3, 0xb5, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc5, 0xa9, 0x00, 2 },
+		{ 0xc3, 0xb8, 0x00, 2 }, { 0xc5, 0xb3, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 },
+		{ 0xc3, 0xbc, 0x00, 2 }, { 0xc3, 0xbd, 0x00, 2 }, { 0xc3, 0xbe, 0x00, 2 }, { 0xc4, 0xb8, 0x00, 2 },
+	},
+	{
+		1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	iso8859_10_rev,
+	0
+};
+
+static const unsigned short iso8859_11_rev[2][256] = {
+	{
+		0x100, 0x101, 0x102, 0x103, 0x104, 0x105, 0x106, 0x107,
+		0x108, 0x109, 0x10a, 0x10b, 0x10c, 0x10d, 0x10e, 0x10f,
+		0x110, 0x111, 0x112, 0x113, 0x114, 0x115, 0x116, 0x117,
+		0x118, 0x119, 0x11a, 0x11b, 0x11c, 0x11d, 0x11e, 0x11f,
+		0x120, 0x121, 0x122, 0x123, 0x124, 0x125, 0x126, 0x127,
+		0x128, 0x129, 0x12a, 0x12b, 0x12c, 0x12d, 0x12e, 0x12f,
+		0x130, 0x131, 0x132, 0x133, 0x134, 0x135, 0x136, 0x137,
+		0x138, 0x139, 0x13a, 0x13b, 0x13c, 0x13d, 0x13e, 0x13f,
+		0x140, 0x141, 0x142, 0x143, 0x144, 0x145, 0x146, 0x147,
+		0x148, 0x149, 0x14a, 0x14b, 0x14c, 0x14d, 0x14e, 0x14f,
+		0x150, 0x151, 0x152, 0x153, 0x154, 0x155, 0x156, 0x157,
+		0x158, 0x159, 0x15a, 0x15b, 0x15c, 0x15d, 0x15e, 0x15f,
+		0x160, 0x161, 0x162, 0x163, 0x164, 0x165, 0x166, 0x167,
+		0x168, 0x169, 0x16a, 0x16b, 0x16c, 0x16d, 0x16e, 0x16f,
+		0x170, 0x171, 0x172, 0x173, 0x174, 0x175, 0x176, 0x177,
+		0x178, 0x179, 0x17a, 0x17b, 0x17c, 0x17d, 0x17e, 0x17f,
+		0x180, 0x181, 0x182, 0x183, 0x184, 0x185, 0x186, 0x187,
+		0x188, 0x189, 0x18a, 0x18b, 0x18c, 0x18d, 0x18e, 0x18f,
+		0x190, 0x191, 0x192, 0x193, 0x194, 0x195, 0x196, 0x197,
+		0x198, 0x199, 0x19a, 0x19b, 0x19c, 0x19d, 0x19e, 0x19f,
+		0x1a0, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+	{
+		0x000, 0x1a1, 0x1a2, 0x1a3, 0x1a4, 0x1a5, 0x1a6, 0x1a7,
+		0x1a8, 0x1a9, 0x1aa, 0x1ab, 0x1ac, 0x1ad, 0x1ae, 0x1af,
+		0x1b0, 0x1b1, 0x1b2, 0x1b3, 0x1b4, 0x1b5, 0x1b6, 0x1b7,
+		0x1b8, 0x1b9, 0x1ba, 0x1bb, 0x1bc, 0x1bd, 0x1be, 0x1bf,
+		0x1c0, 0x1c1, 0x1c2, 0x1c3, 0x1c4, 0x1c5, 0x1c6, 0x1c7,
+		0x1c8, 0x1c9, 0x1ca, 0x1cb, 0x1cc, 0x1cd, 0x1ce, 0x1cf,
+		0x1d0, 0x1d1, 0x1d2, 0x1d3, 0x1d4, 0x1d5, 0x1d6, 0x1d7,
+		0x1d8, 0x1d9, 0x1da, 0x000, 0x000, 0x000, 0x000, 0x1df,
+		0x1e0, 0x1e1, 0x1e2, 0x1e3, 0x1e4, 0x1e5, 0x1e6, 0x1e7,
+		0x1e8, 0x1e9, 0x1ea, 0x1eb, 0x1ec, 0x1ed, 0x1ee, 0x1ef,
+		0x1f0, 0x1f1, 0x1f2, 0x1f3, 0x1f4, 0x1f5, 0x1f6, 0x1f7,
+		0x1f8, 0x1f9, 0x1fa, 0x1fb, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+};
+
+static const struct cstab iso8859_11 = {
+	"iso8859-11",
+	{
+		{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+		{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+		{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+		{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+		{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+		{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+		{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+		{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+		{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+		{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+		{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+		{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+		{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+		{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+		{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+		{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+		{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+		{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+		{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+		{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+		{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+		{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+		{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+		{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+		{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+		{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+		{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+		{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+		{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+		{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+		{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+		{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+		{ 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+		{ 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+		{ 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+		{ 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+		{ 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+		{ 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+		{ 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+		{ 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+		{ 0xc2, 0xa0, 0x00, 2 }, { 0xe0, 0xb8, 0x81, 3 }, { 0xe0, 0xb8, 0x82, 3 }, { 0xe0, 0xb8, 0x83, 3 },
+		{ 0xe0, 0xb8, 0x84, 3 }, { 0xe0, 0xb8, 0x85, 3 }, { 0xe0, 0xb8, 0x86, 3 }, { 0xe0, 0xb8, 0x87, 3 },
+		{ 0xe0, 0xb8, 0x88, 3 }, { 0xe0, 0xb8, 0x89, 3 }, { 0xe0, 0xb8, 0x8a, 3 }, { 0xe0, 0xb8, 0x8b, 3 },
+		{ 0xe0, 0xb8, 0x8c, 3 }, { 0xe0, 0xb8, 0x8d, 3 }, { 0xe0, 0xb8, 0x8e, 3 }, { 0xe0, 0xb8, 0x8f, 3 },
+		{ 0xe0, 0xb8, 0x90, 3 }, { 0xe0, 0xb8, 0x91, 3 }, { 0xe0, 0xb8, 0x92, 3 }, { 0xe0, 0xb8, 0x93, 3 },
+		{ 0xe0, 0xb8, 0x94, 3 }, { 0xe0, 0xb8, 0x95, 3 }, { 0xe0, 0xb8, 0x96, 3 }, { 0xe0, 0xb8, 0x97, 3 },
+		{ 0xe0, 0xb8, 0x98, 3 }, { 0xe0, 0xb8, 0x99, 3 }, { 0xe0, 0xb8, 0x9a, 3 }, { 0xe0, 0xb8, 0x9b, 3 },
+		{ 0xe0, 0xb8, 0x9c, 3 }, { 0xe0, 0xb8, 0x9d, 3 }, { 0xe0, 0xb8, 0x9e, 3 }, { 0xe0, 0xb8, 0x9f, 3 },
+		{ 0xe0, 0xb8, 0xa0, 3 }, { 0xe0, 0xb8, 0xa1, 3 }, { 0xe0, 0xb8, 0xa2, 3 }, { 0xe0, 0xb8, 0xa3, 3 },
+		{ 0xe0, 0xb8, 0xa4, 3 }, { 0xe0, 0xb8, 0xa5, 3 }, { 0xe0, 0xb8, 0xa6, 3 }, { 0xe0, 0xb8, 0xa7, 3 },
+		{ 0xe0, 0xb8, 0xa8, 3 }, { 0xe0, 0xb8, 0xa9, 3 }, { 0xe0, 0xb8, 0xaa, 3 }, { 0xe0, 0xb8, 0xab, 3 },
+		{ 0xe0, 0xb8, 0xac, 3 }, { 0xe0, 0xb8, 0xad, 3 }, { 0xe0, 0xb8, 0xae, 3 }, { 0xe0, 0xb8, 0xaf, 3 },
+		{ 0xe0, 0xb8, 0xb0, 3 }, { 0xe0, 0xb8, 0xb1, 3 }, { 0xe0, 0xb8, 0xb2, 3 }, { 0xe0, 0xb8, 0xb3, 3 },
+		{ 0xe0, 0xb8, 0xb4, 3 }, { 0xe0, 0xb8, 0xb5, 3 }, { 0xe0, 0xb8, 0xb6, 3 }, { 0xe0, 0xb8, 0xb7, 3 },
+		{ 0xe0, 0xb8, 0xb8, 3 }, { 0xe0, 0xb8, 0xb9, 3 }, { 0xe0, 0xb8, 0xba, 3 }, { 0x00, 0x00, 0x00, 0 },
+		{ 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0xe0, 0xb8, 0xbf, 3 },
+		{ 0xe0, 0xb9, 0x80, 3 }, { 0xe0, 0xb9, 0x81, 3 }, { 0xe0, 0xb9, 0x82, 3 }, { 0xe0, 0xb9, 0x83, 3 },
+		{ 0xe0, 0xb9, 0x84, 3 }, { 0xe0, 0xb9, 0x85, 3 }, { 0xe0, 0xb9, 0x86, 3 }, { 0xe0, 0xb9, 0x87, 3 },
+		{ 0xe0, 0xb9, 0x88, 3 }, { 0xe0, 0xb9, 0x89, 3 }, { 0xe0, 0xb9, 0x8a, 3 }, { 0xe0, 0xb9, 0x8b, 3 },
+		{ 0xe0, 0xb9, 0x8c, 3 }, { 0xe0, 0xb9, 0x8d, 3 }, { 0xe0, 0xb9, 0x8e, 3 }, { 0xe0, 0xb9, 0x8f, 3 },
+		{ 0xe0, 0xb9, 0x90, 3 }, { 0xe0, 0xb9, 0x91, 3 }, { 0xe0, 0xb9, 0x92, 3 }, { 0xe0, 0xb9, 0x93, 3 },
+		{ 0xe0, 0xb9, 0x94, 3 }, { 0xe0, 0xb9, 0x95, 3 }, { 0xe0, 0xb9, 0x96, 3 }, { 0xe0, 0xb9, 0x97, 3 },
+		{ 0xe0, 0xb9, 0x98, 3 }, { 0xe0, 0xb9, 0x99, 3 }, { 0xe0, 0xb9, 0x9a, 3 }, { 0xe0, 0xb9, 0x9b, 3 },
+		{ 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 }, { 0x00, 0x00, 0x00, 0 },
+	},
+	{
+		1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	iso8859_11_rev,
+	0
+};
+
+static const unsigned short iso8859_13_rev[3][256] = {
+	{
+		0x100, 0x101, 0x102, 0x103, 0x104, 0x105, 0x106, 0x107,
+		0x108, 0x109, 0x10a, 0x10b, 0x10c, 0x10d, 0x10e, 0x10f,
+		0x110, 0x111, 0x112, 0x113, 0x114, 0x115, 0x116, 0x117,
+		0x118, 0x119, 0x11a, 0x11b, 0x11c, 0x11d, 0x11e, 0x11f,
+		0x120, 0x121, 0x122, 0x123, 0x124, 0x125, 0x126, 0x127,
+		0x128, 0x129, 0x12a, 0x12b, 0x12c, 0x12d, 0x12e, 0x12f,
+		0x130, 0x131, 0x132, 0x133, 0x134, 0x135, 0x136, 0x137,
+		0x138, 0x139, 0x13a, 0x13b, 0x13c, 0x13d, 0x13e, 0x13f,
+		0x140, 0x141, 0x142, 0x143, 0x144, 0x145, 0x146, 0x147,
+		0x148, 0x149, 0x14a, 0x14b, 0x14c, 0x14d, 0x14e, 0x14f,
+		0x150, 0x151, 0x152, 0x153, 0x154, 0x155, 0x156, 0x157,
+		0x158, 0x159, 0x15a, 0x15b, 0x15c, 0x15d, 0x15e, 0x15f,
+		0x160, 0x161, 0x162, 0x163, 0x164, 0x165, 0x166, 0x167,
+		0x168, 0x169, 0x16a, 0x16b, 0x16c, 0x16d, 0x16e, 0x16f,
+		0x170, 0x171, 0x172, 0x173, 0x174, 0x175, 0x176, 0x177,
+		0x178, 0x179, 0x17a, 0x17b, 0x17c, 0x17d, 0x17e, 0x17f,
+		0x180, 0x181, 0x182, 0x183, 0x184, 0x185, 0x186, 0x187,
+		0x188, 0x189, 0x18a, 0x18b, 0x18c, 0x18d, 0x18e, 0x18f,
+		0x190, 0x191, 0x192, 0x193, 0x194, 0x195, 0x196, 0x197,
+		0x198, 0x199, 0x19a, 0x19b, 0x19c, 0x19d, 0x19e, 0x19f,
+		0x1a0, 0x000, 0x1a2, 0x1a3, 0x1a4, 0x000, 0x1a6, 0x1a7,
+		0x000, 0x1a9, 0x000, 0x1ab, 0x1ac, 0x1ad, 0x1ae, 0x000,
+		0x1b0, 0x1b1, 0x1b2, 0x1b3, 0x000, 0x1b5, 0x1b6, 0x1b7,
+		0x000, 0x1b9, 0x000, 0x1bb, 0x1bc, 0x1bd, 0x1be, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x1c4, 0x1c5, 0x1af, 0x000,
+		0x000, 0x1c9, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x1d3, 0x000, 0x1d5, 0x1d6, 0x1d7,
+		0x1a8, 0x000, 0x000, 0x000, 0x1dc, 0x000, 0x000, 0x1df,
+		0x000, 0x000, 0x000, 0x000, 0x1e4, 0x1e5, 0x1bf, 0x000,
+		0x000, 0x1e9, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x1f3, 0x000, 0x1f5, 0x1f6, 0x1f7,
+		0x1b8, 0x000, 0x000, 0x000, 0x1fc, 0x000, 0x000, 0x000,
+	},
+	{
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x1ff, 0x000, 0x000, 0x1b4, 0x1a1, 0x1a5, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+	{
+		0x1c2, 0x1e2, 0x000, 0x000, 0x1c0, 0x1e0, 0x1c3, 0x1e3,
+		0x000, 0x000, 0x000, 0x000, 0x1c8, 0x1e8, 0x000, 0x000,
+		0x000, 0x000, 0x1c7, 0x1e7, 0x000, 0x000, 0x1cb, 0x1eb,
+		0x1c6, 0x1e6, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x1cc, 0x1ec, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x1ce, 0x1ee, 0x000, 0x000, 0x1c1, 0x1e1,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1cd, 0x1ed,
+		0x000, 0x000, 0x000, 0x1cf, 0x1ef, 0x000, 0x000, 0x000,
+		0x000, 0x1d9, 0x1f9, 0x1d1, 0x1f1, 0x1d2, 0x1f2, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x1d4, 0x1f4, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1aa, 0x1ba,
+		0x000, 0x000, 0x1da, 0x1fa, 0x000, 0x000, 0x000, 0x000,
+		0x1d0, 0x1f0, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x1db, 0x1fb, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x1d8, 0x1f8, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x1ca, 0x1ea, 0x1dd, 0x1fd, 0x1de, 0x1fe, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+};
+
+static const struct cstab iso8859_13 = {
+	"iso8859-13",
+	{
+		{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+		{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+		{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+		{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+		{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+		{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+		{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+		{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+		{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+		{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+		{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+		{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+		{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+		{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+		{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+		{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+		{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+		{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+		{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+		{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+		{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+		{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+		{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+		{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+		{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+		{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+		{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+		{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+		{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+		{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+		{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+		{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+		{ 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+		{ 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+		{ 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+		{ 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+		{ 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+		{ 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+		{ 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+		{ 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+		{ 0xc2, 0xa0, 0x00, 2 }, { 0xe2, 0x80, 0x9d, 3 }, { 0xc2, 0xa2, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+		{ 0xc2, 0xa4, 0x00, 2 }, { 0xe2, 0x80, 0x9e, 3 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+		{ 0xc3, 0x98, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xc5, 0x96, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+		{ 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 },
+		{ 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+		{ 0xe2, 0x80, 0x9c, 3 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+		{ 0xc3, 0xb8, 0x00, 2 }, { 0xc2, 0xb9, 0x00, 2 }, { 0xc5, 0x97, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+		{ 0xc2, 0xbc, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0xc2, 0xbe, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 },
+		{ 0xc4, 0x84, 0x00, 2 }, { 0xc4, 0xae, 0x00, 2 }, { 0xc4, 0x80, 0x00, 2 }, { 0xc4, 0x86, 0x00, 2 },
+		{ 0xc3, 0x84, 0x00, 2 }, { 0xc3, 0x85, 0x00, 2 }, { 0xc4, 0x98, 0x00, 2 }, { 0xc4, 0x92, 0x00, 2 },
+		{ 0xc4, 0x8c, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc5, 0xb9, 0x00, 2 }, { 0xc4, 0x96, 0x00, 2 },
+		{ 0xc4, 0xa2, 0x00, 2 }, { 0xc4, 0xb6, 0x00, 2 }, { 0xc4, 0xaa, 0x00, 2 }, { 0xc4, 0xbb, 0x00, 2 },
+		{ 0xc5, 0xa0, 0x00, 2 }, { 0xc5, 0x83, 0x00, 2 }, { 0xc5, 0x85, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+		{ 0xc5, 0x8c, 0x00, 2 }, { 0xc3, 0x95, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+		{ 0xc5, 0xb2, 0x00, 2 }, { 0xc5, 0x81, 0x00, 2 }, { 0xc5, 0x9a, 0x00, 2 }, { 0xc5, 0xaa, 0x00, 2 },
+		{ 0xc3, 0x9c, 0x00, 2 }, { 0xc5, 0xbb, 0x00, 2 }, { 0xc5, 0xbd, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+		{ 0xc4, 0x85, 0x00, 2 }, { 0xc4, 0xaf, 0x00, 2 }, { 0xc4, 0x81, 0x00, 2 }, { 0xc4, 0x87, 0x00, 2 },
+		{ 0xc3, 0xa4, 0x00, 2 }, { 0xc3, 0xa5, 0x00, 2 }, { 0xc4, 0x99, 0x00, 2 }, { 0xc4, 0x93, 0x00, 2 },
+		{ 0xc4, 0x8d, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc5, 0xba, 0x00, 2 }, { 0xc4, 0x97, 0x00, 2 },
+		{ 0xc4, 0xa3, 0x00, 2 }, { 0xc4, 0xb7, 0x00, 2 }, { 0xc4, 0xab, 0x00, 2 }, { 0xc4, 0xbc, 0x00, 2 },
+		{ 0xc5, 0xa1, 0x00, 2 }, { 0xc5, 0x84, 0x00, 2 }, { 0xc5, 0x86, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+		{ 0xc5, 0x8d, 0x00, 2 }, { 0xc3, 0xb5, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+		{ 0xc5, 0xb3, 0x00, 2 }, { 0xc5, 0x82, 0x00, 2 }, { 0xc5, 0x9b, 0x00, 2 }, { 0xc5, 0xab, 0x00, 2 },
+		{ 0xc3, 0xbc, 0x00, 2 }, { 0xc5, 0xbc, 0x00, 2 }, { 0xc5, 0xbe, 0x00, 2 }, { 0xe2, 0x80, 0x99, 3 },
+	},
+	{
+		1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	iso8859_13_rev,
+	0
+};
+
+static const unsigned short iso8859_14_rev[3][256] = {
+	{
+		0x100, 0x101, 0x102, 0x103, 0x104, 0x105, 0x106, 0x107,
+		0x108, 0x109, 0x10a, 0x10b, 0x10c, 0x10d, 0x10e, 0x10f,
+		0x110, 0x111, 0x112, 0x113, 0x114, 0x115, 0x116, 0x117,
+		0x118, 0x119, 0x11a, 0x11b, 0x11c, 0x11d, 0x11e, 0x11f,
+		0x120, 0x121, 0x122, 0x123, 0x124, 0x125, 0x126, 0x127,
+		0x128, 0x129, 0x12a, 0x12b, 0x12c, 0x12d, 0x12e, 0x12f,
+		0x130, 0x131, 0x132, 0x133, 0x134, 0x135, 0x136, 0x137,
+		0x138, 0x139, 0x13a, 0x13b, 0x13c, 0x13d, 0x13e, 0x13f,
+		0x140, 0x141, 0x142, 0x143, 0x144, 0x145, 0x146, 0x147,
+		0x148, 0x149, 0x14a, 0x14b, 0x14c, 0x14d, 0x14e, 0x14f,
+		0x150, 0x151, 0x152, 0x153, 0x154, 0x155, 0x156, 0x157,
+		0x158, 0x159, 0x15a, 0x15b, 0x15c, 0x15d, 0x15e, 0x15f,
+		0x160, 0x161, 0x162, 0x163, 0x164, 0x165, 0x166, 0x167,
+		0x168, 0x169, 0x16a, 0x16b, 0x16c, 0x16d, 0x16e, 0x16f,
+		0x170, 0x171, 0x172, 0x173, 0x174, 0x175, 0x176, 0x177,
+		0x178, 0x179, 0x17a, 0x17b, 0x17c, 0x17d, 0x17e, 0x17f,
+		0x180, 0x181, 0x182, 0x183, 0x184, 0x185, 0x186, 0x187,
+		0x188, 0x189, 0x18a, 0x18b, 0x18c, 0x18d, 0x18e, 0x18f,
+		0x190, 0x191, 0x192, 0x193, 0x194, 0x195, 0x196, 0x197,
+		0x198, 0x199, 0x19a, 0x19b, 0x19c, 0x19d, 0x19e, 0x19f,
+		0x1a0, 0x000, 0x000, 0x1a3, 0x000, 0x000, 0x000, 0x1a7,
+		0x000, 0x1a9, 0x000, 0x000, 0x000, 0x1ad, 0x1ae, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1b6, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1c0, 0x1c1, 0x1c2, 0x1c3, 0x1c4, 0x1c5, 0x1c6, 0x1c7,
+		0x1c8, 0x1c9, 0x1ca, 0x1cb, 0x1cc, 0x1cd, 0x1ce, 0x1cf,
+		0x000, 0x1d1, 0x1d2, 0x1d3, 0x1d4, 0x1d5, 0x1d6, 0x000,
+		0x1d8, 0x1d9, 0x1da, 0x1db, 0x1dc, 0x1dd, 0x000, 0x1df,
+		0x1e0, 0x1e1, 0x1e2, 0x1e3, 0x1e4, 0x1e5, 0x1e6, 0x1e7,
+		0x1e8, 0x1e9, 0x1ea, 0x1eb, 0x1ec, 0x1ed, 0x1ee, 0x1ef,
+		0x000, 0x1f1, 0x1f2, 0x1f3, 0x1f4, 0x1f5, 0x1f6, 0x000,
+		0x1f8, 0x1f9, 0x1fa, 0x1fb, 0x1fc, 0x1fd, 0x000, 0x1ff,
+	},
+	{
+		0x000, 0x000, 0x1a1, 0x1a2, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x1a6, 0x1ab, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1b0, 0x1b1,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1b4, 0x1b5, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1b7, 0x1b9,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1bb, 0x1bf, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x1d7, 0x1f7, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1a8, 0x1b8, 0x1aa, 0x1ba, 0x1bd, 0x1be, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x1ac, 0x1bc, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+	{
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x1a4, 0x1a5, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1b2, 0x1b3, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x1d0, 0x1f0, 0x1de, 0x1fe,
+		0x1af, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+};
+
+static const struct cstab iso8859_14 = {
+	"iso8859-14",
+	{
+		{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+		{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+		{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+		{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+		{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+		{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+		{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+		{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+		{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+		{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+		{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+		{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+		{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+		{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+		{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+		{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+		{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+		{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+		{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+		{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+		{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+		{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+		{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+		{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+		{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+		{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+		{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+		{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+		{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+		{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+		{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+		{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+		{ 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+		{ 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+		{ 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+		{ 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+		{ 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+		{ 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+		{ 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+		{ 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+		{ 0xc2, 0xa0, 0x00, 2 }, { 0xe1, 0xb8, 0x82, 3 }, { 0xe1, 0xb8, 0x83, 3 }, { 0xc2, 0xa3, 0x00, 2 },
+		{ 0xc4, 0x8a, 0x00, 2 }, { 0xc4, 0x8b, 0x00, 2 }, { 0xe1, 0xb8, 0x8a, 3 }, { 0xc2, 0xa7, 0x00, 2 },
+		{ 0xe1, 0xba, 0x80, 3 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xe1, 0xba, 0x82, 3 }, { 0xe1, 0xb8, 0x8b, 3 },
+		{ 0xe1, 0xbb, 0xb2, 3 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc5, 0xb8, 0x00, 2 },
+		{ 0xe1, 0xb8, 0x9e, 3 }, { 0xe1, 0xb8, 0x9f, 3 }, { 0xc4, 0xa0, 0x00, 2 }, { 0xc4, 0xa1, 0x00, 2 },
+		{ 0xe1, 0xb9, 0x80, 3 }, { 0xe1, 0xb9, 0x81, 3 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xe1, 0xb9, 0x96, 3 },
+		{ 0xe1, 0xba, 0x81, 3 }, { 0xe1, 0xb9, 0x97, 3 }, { 0xe1, 0xba, 0x83, 3 }, { 0xe1, 0xb9, 0xa0, 3 },
+		{ 0xe1, 0xbb, 0xb3, 3 }, { 0xe1, 0xba, 0x84, 3 }, { 0xe1, 0xba, 0x85, 3 }, { 0xe1, 0xb9, 0xa1, 3 },
+		{ 0xc3, 0x80, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc3, 0x83, 0x00, 2 },
+		{ 0xc3, 0x84, 0x00, 2 }, { 0xc3, 0x85, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 }, { 0xc3, 0x87, 0x00, 2 },
+		{ 0xc3, 0x88, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc3, 0x8a, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+		{ 0xc3, 0x8c, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc3, 0x8f, 0x00, 2 },
+		{ 0xc5, 0xb4, 0x00, 2 }, { 0xc3, 0x91, 0x00, 2 }, { 0xc3, 0x92, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+		{ 0xc3, 0x94, 0x00, 2 }, { 0xc3, 0x95, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xe1, 0xb9, 0xaa, 3 },
+		{ 0xc3, 0x98, 0x00, 2 }, { 0xc3, 0x99, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc3, 0x9b, 0x00, 2 },
+		{ 0xc3, 0x9c, 0x00, 2 }, { 0xc3, 0x9d, 0x00, 2 }, { 0xc5, 0xb6, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+		{ 0xc3, 0xa0, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xc3, 0xa3, 0x00, 2 },
+		{ 0xc3, 0xa4, 0x00, 2 }, { 0xc3, 0xa5, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+		{ 0xc3, 0xa8, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc3, 0xaa, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+		{ 0xc3, 0xac, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc3, 0xaf, 0x00, 2 },
+		{ 0xc5, 0xb5, 0x00, 2 }, { 0xc3, 0xb1, 0x00, 2 }, { 0xc3, 0xb2, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+		{ 0xc3, 0xb4, 0x00, 2 }, { 0xc3, 0xb5, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xe1, 0xb9, 0xab, 3 },
+		{ 0xc3, 0xb8, 0x00, 2 }, { 0xc3, 0xb9, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 },
+		{ 0xc3, 0xbc, 0x00, 2 }, { 0xc3, 0xbd, 0x00, 2 }, { 0xc5, 0xb7, 0x00, 2 }, { 0xc3, 0xbf, 0x00, 2 },
+	},
+	{
+		1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	iso8859_14_rev,
+	0
+};
+
+static const unsigned short iso8859_15_rev[3][256] = {
+	{
+		0x100, 0x101, 0x102, 0x103, 0x104, 0x105, 0x106, 0x107,
+		0x108, 0x109, 0x10a, 0x10b, 0x10c, 0x10d, 0x10e, 0x10f,
+		0x110, 0x111, 0x112, 0x113, 0x114, 0x115, 0x116, 0x117,
+		0x118, 0x119, 0x11a, 0x11b, 0x11c, 0x11d, 0x11e, 0x11f,
+		0x120, 0x121, 0x122, 0x123, 0x124, 0x125, 0x126, 0x127,
+		0x128, 0x129, 0x12a, 0x12b, 0x12c, 0x12d, 0x12e, 0x12f,
+		0x130, 0x131, 0x132, 0x133, 0x134, 0x135, 0x136, 0x137,
+		0x138, 0x139, 0x13a, 0x13b, 0x13c, 0x13d, 0x13e, 0x13f,
+		0x140, 0x141, 0x142, 0x143, 0x144, 0x145, 0x146, 0x147,
+		0x148, 0x149, 0x14a, 0x14b, 0x14c, 0x14d, 0x14e, 0x14f,
+		0x150, 0x151, 0x152, 0x153, 0x154, 0x155, 0x156, 0x157,
+		0x158, 0x159, 0x15a, 0x15b, 0x15c, 0x15d, 0x15e, 0x15f,
+		0x160, 0x161, 0x162, 0x163, 0x164, 0x165, 0x166, 0x167,
+		0x168, 0x169, 0x16a, 0x16b, 0x16c, 0x16d, 0x16e, 0x16f,
+		0x170, 0x171, 0x172, 0x173, 0x174, 0x175, 0x176, 0x177,
+		0x178, 0x179, 0x17a, 0x17b, 0x17c, 0x17d, 0x17e, 0x17f,
+		0x180, 0x181, 0x182, 0x183, 0x184, 0x185, 0x186, 0x187,
+		0x188, 0x189, 0x18a, 0x18b, 0x18c, 0x18d, 0x18e, 0x18f,
+		0x190, 0x191, 0x192, 0x193, 0x194, 0x195, 0x196, 0x197,
+		0x198, 0x199, 0x19a, 0x19b, 0x19c, 0x19d, 0x19e, 0x19f,
+		0x1a0, 0x1a1, 0x1a2, 0x1a3, 0x000, 0x1a5, 0x000, 0x1a7,
+		0x000, 0x1a9, 0x1aa, 0x1ab, 0x1ac, 0x1ad, 0x1ae, 0x1af,
+		0x1b0, 0x1b1, 0x1b2, 0x1b3, 0x000, 0x1b5, 0x1b6, 0x1b7,
+		0x000, 0x1b9, 0x1ba, 0x1bb, 0x000, 0x000, 0x000, 0x1bf,
+		0x1c0, 0x1c1, 0x1c2, 0x1c3, 0x1c4, 0x1c5, 0x1c6, 0x1c7,
+		0x1c8, 0x1c9, 0x1ca, 0x1cb, 0x1cc, 0x1cd, 0x1ce, 0x1cf,
+		0x1d0, 0x1d1, 0x1d2, 0x1d3, 0x1d4, 0x1d5, 0x1d6, 0x1d7,
+		0x1d8, 0x1d9, 0x1da, 0x1db, 0x1dc, 0x1dd, 0x1de, 0x1df,
+		0x1e0, 0x1e1, 0x1e2, 0x1e3, 0x1e4, 0x1e5, 0x1e6, 0x1e7,
+		0x1e8, 0x1e9, 0x1ea, 0x1eb, 0x1ec, 0x1ed, 0x1ee, 0x1ef,
+		0x1f0, 0x1f1, 0x1f2, 0x1f3, 0x1f4, 0x1f5, 0x1f6, 0x1f7,
+		0x1f8, 0x1f9, 0x1fa, 0x1fb, 0x1fc, 0x1fd, 0x1fe, 0x1ff,
+	},
+	{
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x1a4, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+	{
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x1bc, 0x1bd, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1a6, 0x1a8, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1be, 0x000, 0x000, 0x000, 0x000, 0x1b4, 0x1b8, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+};
+
+static const struct cstab iso8859_15 = {
+	"iso8859-15",
+	{
+		{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+		{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+		{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+		{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+		{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+		{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+		{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+		{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+		{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+		{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+		{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+		{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+		{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+		{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+		{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+		{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+		{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+		{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+		{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+		{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+		{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+		{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+		{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+		{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+		{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+		{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+		{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+		{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+		{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+		{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+		{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+		{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+		{ 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+		{ 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+		{ 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+		{ 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+		{ 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+		{ 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+		{ 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+		{ 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+		{ 0xc2, 0xa0, 0x00, 2 }, { 0xc2, 0xa1, 0x00, 2 }, { 0xc2, 0xa2, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+		{ 0xe2, 0x82, 0xac, 3 }, { 0xc2, 0xa5, 0x00, 2 }, { 0xc5, 0xa0, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+		{ 0xc5, 0xa1, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xc2, 0xaa, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+		{ 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc2, 0xaf, 0x00, 2 },
+		{ 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+		{ 0xc5, 0xbd, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+		{ 0xc5, 0xbe, 0x00, 2 }, { 0xc2, 0xb9, 0x00, 2 }, { 0xc2, 0xba, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+		{ 0xc5, 0x92, 0x00, 2 }, { 0xc5, 0x93, 0x00, 2 }, { 0xc5, 0xb8, 0x00, 2 }, { 0xc2, 0xbf, 0x00, 2 },
+		{ 0xc3, 0x80, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc3, 0x83, 0x00, 2 },
+		{ 0xc3, 0x84, 0x00, 2 }, { 0xc3, 0x85, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 }, { 0xc3, 0x87, 0x00, 2 },
+		{ 0xc3, 0x88, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc3, 0x8a, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+		{ 0xc3, 0x8c, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc3, 0x8f, 0x00, 2 },
+		{ 0xc3, 0x90, 0x00, 2 }, { 0xc3, 0x91, 0x00, 2 }, { 0xc3, 0x92, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+		{ 0xc3, 0x94, 0x00, 2 }, { 0xc3, 0x95, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+		{ 0xc3, 0x98, 0x00, 2 }, { 0xc3, 0x99, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc3, 0x9b, 0x00, 2 },
+		{ 0xc3, 0x9c, 0x00, 2 }, { 0xc3, 0x9d, 0x00, 2 }, { 0xc3, 0x9e, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+		{ 0xc3, 0xa0, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xc3, 0xa3, 0x00, 2 },
+		{ 0xc3, 0xa4, 0x00, 2 }, { 0xc3, 0xa5, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+		{ 0xc3, 0xa8, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc3, 0xaa, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+		{ 0xc3, 0xac, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc3, 0xaf, 0x00, 2 },
+		{ 0xc3, 0xb0, 0x00, 2 }, { 0xc3, 0xb1, 0x00, 2 }, { 0xc3, 0xb2, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+		{ 0xc3, 0xb4, 0x00, 2 }, { 0xc3, 0xb5, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+		{ 0xc3, 0xb8, 0x00, 2 }, { 0xc3, 0xb9, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 },
+		{ 0xc3, 0xbc, 0x00, 2 }, { 0xc3, 0xbd, 0x00, 2 }, { 0xc3, 0xbe, 0x00, 2 }, { 0xc3, 0xbf, 0x00, 2 },
+	},
+	{
+		1, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	iso8859_15_rev,
+	0
+};
+
+static const unsigned short iso8859_16_rev[4][256] = {
+	{
+		0x100, 0x101, 0x102, 0x103, 0x104, 0x105, 0x106, 0x107,
+		0x108, 0x109, 0x10a, 0x10b, 0x10c, 0x10d, 0x10e, 0x10f,
+		0x110, 0x111, 0x112, 0x113, 0x114, 0x115, 0x116, 0x117,
+		0x118, 0x119, 0x11a, 0x11b, 0x11c, 0x11d, 0x11e, 0x11f,
+		0x120, 0x121, 0x122, 0x123, 0x124, 0x125, 0x126, 0x127,
+		0x128, 0x129, 0x12a, 0x12b, 0x12c, 0x12d, 0x12e, 0x12f,
+		0x130, 0x131, 0x132, 0x133, 0x134, 0x135, 0x136, 0x137,
+		0x138, 0x139, 0x13a, 0x13b, 0x13c, 0x13d, 0x13e, 0x13f,
+		0x140, 0x141, 0x142, 0x143, 0x144, 0x145, 0x146, 0x147,
+		0x148, 0x149, 0x14a, 0x14b, 0x14c, 0x14d, 0x14e, 0x14f,
+		0x150, 0x151, 0x152, 0x153, 0x154, 0x155, 0x156, 0x157,
+		0x158, 0x159, 0x15a, 0x15b, 0x15c, 0x15d, 0x15e, 0x15f,
+		0x160, 0x161, 0x162, 0x163, 0x164, 0x165, 0x166, 0x167,
+		0x168, 0x169, 0x16a, 0x16b, 0x16c, 0x16d, 0x16e, 0x16f,
+		0x170, 0x171, 0x172, 0x173, 0x174, 0x175, 0x176, 0x177,
+		0x178, 0x179, 0x17a, 0x17b, 0x17c, 0x17d, 0x17e, 0x17f,
+		0x180, 0x181, 0x182, 0x183, 0x184, 0x185, 0x186, 0x187,
+		0x188, 0x189, 0x18a, 0x18b, 0x18c, 0x18d, 0x18e, 0x18f,
+		0x190, 0x191, 0x192, 0x193, 0x194, 0x195, 0x196, 0x197,
+		0x198, 0x199, 0x19a, 0x19b, 0x19c, 0x19d, 0x19e, 0x19f,
+		0x1a0, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x1a7,
+		0x000, 0x1a9, 0x000, 0x1ab, 0x000, 0x1ad, 0x000, 0x000,
+		0x1b0, 0x1b1, 0x000, 0x000, 0x000, 0x000, 0x1b6, 0x1b7,
+		0x000, 0x000, 0x000, 0x1bb, 0x000, 0x000, 0x000, 0x000,
+		0x1c0, 0x1c1, 0x1c2, 0x000, 0x1c4, 0x000, 0x1c6, 0x1c7,
+		0x1c8, 0x1c9, 0x1ca, 0x1cb, 0x1cc, 0x1cd, 0x1ce, 0x1cf,
+		0x000, 0x000, 0x1d2, 0x1d3, 0x1d4, 0x000, 0x1d6, 0x000,
+		0x000, 0x1d9, 0x1da, 0x1db, 0x1dc, 0x000, 0x000, 0x1df,
+		0x1e0, 0x1e1, 0x1e2, 0x000, 0x1e4, 0x000, 0x1e6, 0x1e7,
+		0x1e8, 0x1e9, 0x1ea, 0x1eb, 0x1ec, 0x1ed, 0x1ee, 0x1ef,
+		0x000, 0x000, 0x1f2, 0x1f3, 0x1f4, 0x000, 0x1f6, 0x000,
+		0x000, 0x1f9, 0x1fa, 0x1fb, 0x1fc, 0x000, 0x000, 0x1ff,
+	},
+	{
+		0x000, 0x000, 0x1c3, 0x1e3, 0x1a1, 0x1a2, 0x1c5, 0x1e5,
+		0x000, 0x000, 0x000, 0x000, 0x1b2, 0x1b9, 0x000, 0x000,
+		0x1d0, 0x1f0, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1dd, 0x1fd, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x1a3, 0x1b3, 0x1d1, 0x1f1, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1d5, 0x1f5, 0x1bc, 0x1bd, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x1d7, 0x1f7, 0x000, 0x000, 0x000, 0x000,
+		0x1a6, 0x1a8, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1d8, 0x1f8, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1be, 0x1ac, 0x1ae, 0x1af, 0x1bf, 0x1b4, 0x1b8, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+	{
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x1b5, 0x1a5, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x1a4, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+	{
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1aa, 0x1ba, 0x1de, 0x1fe, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+};
+
+static const struct cstab iso8859_16 = {
+	"iso8859-16",
+	{
+		{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+		{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+		{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+		{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+		{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+		{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+		{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+		{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+		{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+		{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+		{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+		{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+		{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+		{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+		{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+		{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+		{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+		{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+		{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+		{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+		{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+		{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+		{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+		{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+		{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+		{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+		{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+		{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+		{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+		{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+		{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+		{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+		{ 0xc2, 0x80, 0x00, 2 }, { 0xc2, 0x81, 0x00, 2 }, { 0xc2, 0x82, 0x00, 2 }, { 0xc2, 0x83, 0x00, 2 },
+		{ 0xc2, 0x84, 0x00, 2 }, { 0xc2, 0x85, 0x00, 2 }, { 0xc2, 0x86, 0x00, 2 }, { 0xc2, 0x87, 0x00, 2 },
+		{ 0xc2, 0x88, 0x00, 2 }, { 0xc2, 0x89, 0x00, 2 }, { 0xc2, 0x8a, 0x00, 2 }, { 0xc2, 0x8b, 0x00, 2 },
+		{ 0xc2, 0x8c, 0x00, 2 }, { 0xc2, 0x8d, 0x00, 2 }, { 0xc2, 0x8e, 0x00, 2 }, { 0xc2, 0x8f, 0x00, 2 },
+		{ 0xc2, 0x90, 0x00, 2 }, { 0xc2, 0x91, 0x00, 2 }, { 0xc2, 0x92, 0x00, 2 }, { 0xc2, 0x93, 0x00, 2 },
+		{ 0xc2, 0x94, 0x00, 2 }, { 0xc2, 0x95, 0x00, 2 }, { 0xc2, 0x96, 0x00, 2 }, { 0xc2, 0x97, 0x00, 2 },
+		{ 0xc2, 0x98, 0x00, 2 }, { 0xc2, 0x99, 0x00, 2 }, { 0xc2, 0x9a, 0x00, 2 }, { 0xc2, 0x9b, 0x00, 2 },
+		{ 0xc2, 0x9c, 0x00, 2 }, { 0xc2, 0x9d, 0x00, 2 }, { 0xc2, 0x9e, 0x00, 2 }, { 0xc2, 0x9f, 0x00, 2 },
+		{ 0xc2, 0xa0, 0x00, 2 }, { 0xc4, 0x84, 0x00, 2 }, { 0xc4, 0x85, 0x00, 2 }, { 0xc5, 0x81, 0x00, 2 },
+		{ 0xe2, 0x82, 0xac, 3 }, { 0xe2, 0x80, 0x9e, 3 }, { 0xc5, 0xa0, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+		{ 0xc5, 0xa1, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xc8, 0x98, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+		{ 0xc5, 0xb9, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc5, 0xba, 0x00, 2 }, { 0xc5, 0xbb, 0x00, 2 },
+		{ 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc4, 0x8c, 0x00, 2 }, { 0xc5, 0x82, 0x00, 2 },
+		{ 0xc5, 0xbd, 0x00, 2 }, { 0xe2, 0x80, 0x9d, 3 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+		{ 0xc5, 0xbe, 0x00, 2 }, { 0xc4, 0x8d, 0x00, 2 }, { 0xc8, 0x99, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+		{ 0xc5, 0x92, 0x00, 2 }, { 0xc5, 0x93, 0x00, 2 }, { 0xc5, 0xb8, 0x00, 2 }, { 0xc5, 0xbc, 0x00, 2 },
+		{ 0xc3, 0x80, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc4, 0x82, 0x00, 2 },
+		{ 0xc3, 0x84, 0x00, 2 }, { 0xc4, 0x86, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 }, { 0xc3, 0x87, 0x00, 2 },
+		{ 0xc3, 0x88, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc3, 0x8a, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+		{ 0xc3, 0x8c, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc3, 0x8f, 0x00, 2 },
+		{ 0xc4, 0x90, 0x00, 2 }, { 0xc5, 0x83, 0x00, 2 }, { 0xc3, 0x92, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+		{ 0xc3, 0x94, 0x00, 2 }, { 0xc5, 0x90, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc5, 0x9a, 0x00, 2 },
+		{ 0xc5, 0xb0, 0x00, 2 }, { 0xc3, 0x99, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc3, 0x9b, 0x00, 2 },
+		{ 0xc3, 0x9c, 0x00, 2 }, { 0xc4, 0x98, 0x00, 2 }, { 0xc8, 0x9a, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+		{ 0xc3, 0xa0, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xc4, 0x83, 0x00, 2 },
+		{ 0xc3, 0xa4, 0x00, 2 }, { 0xc4, 0x87, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+		{ 0xc3, 0xa8, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc3, 0xaa, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+		{ 0xc3, 0xac, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc3, 0xaf, 0x00, 2 },
+		{ 0xc4, 0x91, 0x00, 2 }, { 0xc5, 0x84, 0x00, 2 }, { 0xc3, 0xb2, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+		{ 0xc3, 0xb4, 0x00, 2 }, { 0xc5, 0x91, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc5, 0x9b, 0x00, 2 },
+		{ 0xc5, 0xb1, 0x00, 2 }, { 0xc3, 0xb9, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 },
+		{ 0xc3, 0xbc, 0x00, 2 }, { 0xc4, 0x99, 0x00, 2 }, { 0xc8, 0x9b, 0x00, 2 }, { 0xc3, 0xbf, 0x00, 2 },
+	},
+	{
+		1, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	iso8859_16_rev,
+	0
+};
+
+static const unsigned short cp1252_rev[5][256] = {
+	{
+		0x100, 0x101, 0x102, 0x103, 0x104, 0x105, 0x106, 0x107,
+		0x108, 0x109, 0x10a, 0x10b, 0x10c, 0x10d, 0x10e, 0x10f,
+		0x110, 0x111, 0x112, 0x113, 0x114, 0x115, 0x116, 0x117,
+		0x118, 0x119, 0x11a, 0x11b, 0x11c, 0x11d, 0x11e, 0x11f,
+		0x120, 0x121, 0x122, 0x123, 0x124, 0x125, 0x126, 0x127,
+		0x128, 0x129, 0x12a, 0x12b, 0x12c, 0x12d, 0x12e, 0x12f,
+		0x130, 0x131, 0x132, 0x133, 0x134, 0x135, 0x136, 0x137,
+		0x138, 0x139, 0x13a, 0x13b, 0x13c, 0x13d, 0x13e, 0x13f,
+		0x140, 0x141, 0x142, 0x143, 0x144, 0x145, 0x146, 0x147,
+		0x148, 0x149, 0x14a, 0x14b, 0x14c, 0x14d, 0x14e, 0x14f,
+		0x150, 0x151, 0x152, 0x153, 0x154, 0x155, 0x156, 0x157,
+		0x158, 0x159, 0x15a, 0x15b, 0x15c, 0x15d, 0x15e, 0x15f,
+		0x160, 0x161, 0x162, 0x163, 0x164, 0x165, 0x166, 0x167,
+		0x168, 0x169, 0x16a, 0x16b, 0x16c, 0x16d, 0x16e, 0x16f,
+		0x170, 0x171, 0x172, 0x173, 0x174, 0x175, 0x176, 0x177,
+		0x178, 0x179, 0x17a, 0x17b, 0x17c, 0x17d, 0x17e, 0x17f,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1a0, 0x1a1, 0x1a2, 0x1a3, 0x1a4, 0x1a5, 0x1a6, 0x1a7,
+		0x1a8, 0x1a9, 0x1aa, 0x1ab, 0x1ac, 0x1ad, 0x1ae, 0x1af,
+		0x1b0, 0x1b1, 0x1b2, 0x1b3, 0x1b4, 0x1b5, 0x1b6, 0x1b7,
+		0x1b8, 0x1b9, 0x1ba, 0x1bb, 0x1bc, 0x1bd, 0x1be, 0x1bf,
+		0x1c0, 0x1c1, 0x1c2, 0x1c3, 0x1c4, 0x1c5, 0x1c6, 0x1c7,
+		0x1c8, 0x1c9, 0x1ca, 0x1cb, 0x1cc, 0x1cd, 0x1ce, 0x1cf,
+		0x1d0, 0x1d1, 0x1d2, 0x1d3, 0x1d4, 0x1d5, 0x1d6, 0x1d7,
+		0x1d8, 0x1d9, 0x1da, 0x1db, 0x1dc, 0x1dd, 0x1de, 0x1df,
+		0x1e0, 0x1e1, 0x1e2, 0x1e3, 0x1e4, 0x1e5, 0x1e6, 0x1e7,
+		0x1e8, 0x1e9, 0x1ea, 0x1eb, 0x1ec, 0x1ed, 0x1ee, 0x1ef,
+		0x1f0, 0x1f1, 0x1f2, 0x1f3, 0x1f4, 0x1f5, 0x1f6, 0x1f7,
+		0x1f8, 0x1f9, 0x1fa, 0x1fb, 0x1fc, 0x1fd, 0x1fe, 0x1ff,
+	},
+	{
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x196, 0x197, 0x000, 0x000, 0x000,
+		0x191, 0x192, 0x182, 0x000, 0x193, 0x194, 0x184, 0x000,
+		0x186, 0x187, 0x195, 0x000, 0x000, 0x000, 0x185, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x189, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x18b, 0x19b, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x180, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+	{
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x18c, 0x19c, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x18a, 0x19a, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x19f, 0x000, 0x000, 0x000, 0x000, 0x18e, 0x19e, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x183, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+	{
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x188, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x198, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+	{
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x199, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+};
+
+static const struct cstab cp1252 = {
+	"cp1252",
+	{
+		{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+		{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+		{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+		{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+		{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+		{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+		{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+		{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+		{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+		{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+		{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+		{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+		{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+		{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+		{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+		{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+		{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+		{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+		{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+		{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+		{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+		{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+		{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+		{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+		{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+		{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+		{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+		{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+		{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+		{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+		{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+		{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+		{ 0xe2, 0x82, 0xac, 3 }, { 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0x9a, 3 }, { 0xc6, 0x92, 0x00, 2 },
+		{ 0xe2, 0x80, 0x9e, 3 }, { 0xe2, 0x80, 0xa6, 3 }, { 0xe2, 0x80, 0xa0, 3 }, { 0xe2, 0x80, 0xa1, 3 },
+		{ 0xcb, 0x86, 0x00, 2 }, { 0xe2, 0x80, 0xb0, 3 }, { 0xc5, 0xa0, 0x00, 2 }, { 0xe2, 0x80, 0xb9, 3 },
+		{ 0xc5, 0x92, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0xc5, 0xbd, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 },
+		{ 0x00, 0x00, 0x00, 0 }, { 0xe2, 0x80, 0x98, 3 }, { 0xe2, 0x80, 0x99, 3 }, { 0xe2, 0x80, 0x9c, 3 },
+		{ 0xe2, 0x80, 0x9d, 3 }, { 0xe2, 0x80, 0xa2, 3 }, { 0xe2, 0x80, 0x93, 3 }, { 0xe2, 0x80, 0x94, 3 },
+		{ 0xcb, 0x9c, 0x00, 2 }, { 0xe2, 0x84, 0xa2, 3 }, { 0xc5, 0xa1, 0x00, 2 }, { 0xe2, 0x80, 0xba, 3 },
+		{ 0xc5, 0x93, 0x00, 2 }, { 0x00, 0x00, 0x00, 0 }, { 0xc5, 0xbe, 0x00, 2 }, { 0xc5, 0xb8, 0x00, 2 },
+		{ 0xc2, 0xa0, 0x00, 2 }, { 0xc2, 0xa1, 0x00, 2 }, { 0xc2, 0xa2, 0x00, 2 }, { 0xc2, 0xa3, 0x00, 2 },
+		{ 0xc2, 0xa4, 0x00, 2 }, { 0xc2, 0xa5, 0x00, 2 }, { 0xc2, 0xa6, 0x00, 2 }, { 0xc2, 0xa7, 0x00, 2 },
+		{ 0xc2, 0xa8, 0x00, 2 }, { 0xc2, 0xa9, 0x00, 2 }, { 0xc2, 0xaa, 0x00, 2 }, { 0xc2, 0xab, 0x00, 2 },
+		{ 0xc2, 0xac, 0x00, 2 }, { 0xc2, 0xad, 0x00, 2 }, { 0xc2, 0xae, 0x00, 2 }, { 0xc2, 0xaf, 0x00, 2 },
+		{ 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb1, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb3, 0x00, 2 },
+		{ 0xc2, 0xb4, 0x00, 2 }, { 0xc2, 0xb5, 0x00, 2 }, { 0xc2, 0xb6, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 },
+		{ 0xc2, 0xb8, 0x00, 2 }, { 0xc2, 0xb9, 0x00, 2 }, { 0xc2, 0xba, 0x00, 2 }, { 0xc2, 0xbb, 0x00, 2 },
+		{ 0xc2, 0xbc, 0x00, 2 }, { 0xc2, 0xbd, 0x00, 2 }, { 0xc2, 0xbe, 0x00, 2 }, { 0xc2, 0xbf, 0x00, 2 },
+		{ 0xc3, 0x80, 0x00, 2 }, { 0xc3, 0x81, 0x00, 2 }, { 0xc3, 0x82, 0x00, 2 }, { 0xc3, 0x83, 0x00, 2 },
+		{ 0xc3, 0x84, 0x00, 2 }, { 0xc3, 0x85, 0x00, 2 }, { 0xc3, 0x86, 0x00, 2 }, { 0xc3, 0x87, 0x00, 2 },
+		{ 0xc3, 0x88, 0x00, 2 }, { 0xc3, 0x89, 0x00, 2 }, { 0xc3, 0x8a, 0x00, 2 }, { 0xc3, 0x8b, 0x00, 2 },
+		{ 0xc3, 0x8c, 0x00, 2 }, { 0xc3, 0x8d, 0x00, 2 }, { 0xc3, 0x8e, 0x00, 2 }, { 0xc3, 0x8f, 0x00, 2 },
+		{ 0xc3, 0x90, 0x00, 2 }, { 0xc3, 0x91, 0x00, 2 }, { 0xc3, 0x92, 0x00, 2 }, { 0xc3, 0x93, 0x00, 2 },
+		{ 0xc3, 0x94, 0x00, 2 }, { 0xc3, 0x95, 0x00, 2 }, { 0xc3, 0x96, 0x00, 2 }, { 0xc3, 0x97, 0x00, 2 },
+		{ 0xc3, 0x98, 0x00, 2 }, { 0xc3, 0x99, 0x00, 2 }, { 0xc3, 0x9a, 0x00, 2 }, { 0xc3, 0x9b, 0x00, 2 },
+		{ 0xc3, 0x9c, 0x00, 2 }, { 0xc3, 0x9d, 0x00, 2 }, { 0xc3, 0x9e, 0x00, 2 }, { 0xc3, 0x9f, 0x00, 2 },
+		{ 0xc3, 0xa0, 0x00, 2 }, { 0xc3, 0xa1, 0x00, 2 }, { 0xc3, 0xa2, 0x00, 2 }, { 0xc3, 0xa3, 0x00, 2 },
+		{ 0xc3, 0xa4, 0x00, 2 }, { 0xc3, 0xa5, 0x00, 2 }, { 0xc3, 0xa6, 0x00, 2 }, { 0xc3, 0xa7, 0x00, 2 },
+		{ 0xc3, 0xa8, 0x00, 2 }, { 0xc3, 0xa9, 0x00, 2 }, { 0xc3, 0xaa, 0x00, 2 }, { 0xc3, 0xab, 0x00, 2 },
+		{ 0xc3, 0xac, 0x00, 2 }, { 0xc3, 0xad, 0x00, 2 }, { 0xc3, 0xae, 0x00, 2 }, { 0xc3, 0xaf, 0x00, 2 },
+		{ 0xc3, 0xb0, 0x00, 2 }, { 0xc3, 0xb1, 0x00, 2 }, { 0xc3, 0xb2, 0x00, 2 }, { 0xc3, 0xb3, 0x00, 2 },
+		{ 0xc3, 0xb4, 0x00, 2 }, { 0xc3, 0xb5, 0x00, 2 }, { 0xc3, 0xb6, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+		{ 0xc3, 0xb8, 0x00, 2 }, { 0xc3, 0xb9, 0x00, 2 }, { 0xc3, 0xba, 0x00, 2 }, { 0xc3, 0xbb, 0x00, 2 },
+		{ 0xc3, 0xbc, 0x00, 2 }, { 0xc3, 0xbd, 0x00, 2 }, { 0xc3, 0xbe, 0x00, 2 }, { 0xc3, 0xbf, 0x00, 2 },
+	},
+	{
+		1, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	cp1252_rev,
+	0
+};
+
+static const unsigned short koi8_r_rev[5][256] = {
+	{
+		0x100, 0x101, 0x102, 0x103, 0x104, 0x105, 0x106, 0x107,
+		0x108, 0x109, 0x10a, 0x10b, 0x10c, 0x10d, 0x10e, 0x10f,
+		0x110, 0x111, 0x112, 0x113, 0x114, 0x115, 0x116, 0x117,
+		0x118, 0x119, 0x11a, 0x11b, 0x11c, 0x11d, 0x11e, 0x11f,
+		0x120, 0x121, 0x122, 0x123, 0x124, 0x125, 0x126, 0x127,
+		0x128, 0x129, 0x12a, 0x12b, 0x12c, 0x12d, 0x12e, 0x12f,
+		0x130, 0x131, 0x132, 0x133, 0x134, 0x135, 0x136, 0x137,
+		0x138, 0x139, 0x13a, 0x13b, 0x13c, 0x13d, 0x13e, 0x13f,
+		0x140, 0x141, 0x142, 0x143, 0x144, 0x145, 0x146, 0x147,
+		0x148, 0x149, 0x14a, 0x14b, 0x14c, 0x14d, 0x14e, 0x14f,
+		0x150, 0x151, 0x152, 0x153, 0x154, 0x155, 0x156, 0x157,
+		0x158, 0x159, 0x15a, 0x15b, 0x15c, 0x15d, 0x15e, 0x15f,
+		0x160, 0x161, 0x162, 0x163, 0x164, 0x165, 0x166, 0x167,
+		0x168, 0x169, 0x16a, 0x16b, 0x16c, 0x16d, 0x16e, 0x16f,
+		0x170, 0x171, 0x172, 0x173, 0x174, 0x175, 0x176, 0x177,
+		0x178, 0x179, 0x17a, 0x17b, 0x17c, 0x17d, 0x17e, 0x17f,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x19a, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x1bf, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x19c, 0x000, 0x19d, 0x000, 0x000, 0x000, 0x000, 0x19e,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x19f,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+	{
+		0x180, 0x000, 0x181, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x182, 0x000, 0x000, 0x000,
+		0x183, 0x000, 0x000, 0x000, 0x184, 0x000, 0x000, 0x000,
+		0x185, 0x000, 0x000, 0x000, 0x186, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x187, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x188, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x189, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x18a, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1a0, 0x1a1, 0x1a2, 0x1a4, 0x1a5, 0x1a6, 0x1a7, 0x1a8,
+		0x1a9, 0x1aa, 0x1ab, 0x1ac, 0x1ad, 0x1ae, 0x1af, 0x1b0,
+		0x1b1, 0x1b2, 0x1b4, 0x1b5, 0x1b6, 0x1b7, 0x1b8, 0x1b9,
+		0x1ba, 0x1bb, 0x1bc, 0x1bd, 0x1be, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x18b, 0x000, 0x000, 0x000, 0x18c, 0x000, 0x000, 0x000,
+		0x18d, 0x000, 0x000, 0x000, 0x18e, 0x000, 0x000, 0x000,
+		0x18f, 0x190, 0x191, 0x192, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x194, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+	{
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x193, 0x19b, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+	{
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x195, 0x196, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x197, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x198, 0x199, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+	{
+		0x000, 0x1b3, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x1e1, 0x1e2, 0x1f7, 0x1e7, 0x1e4, 0x1e5, 0x1f6, 0x1fa,
+		0x1e9, 0x1ea, 0x1eb, 0x1ec, 0x1ed, 0x1ee, 0x1ef, 0x1f0,
+		0x1f2, 0x1f3, 0x1f4, 0x1f5, 0x1e6, 0x1e8, 0x1e3, 0x1fe,
+		0x1fb, 0x1fd, 0x1ff, 0x1f9, 0x1f8, 0x1fc, 0x1e0, 0x1f1,
+		0x1c1, 0x1c2, 0x1d7, 0x1c7, 0x1c4, 0x1c5, 0x1d6, 0x1da,
+		0x1c9, 0x1ca, 0x1cb, 0x1cc, 0x1cd, 0x1ce, 0x1cf, 0x1d0,
+		0x1d2, 0x1d3, 0x1d4, 0x1d5, 0x1c6, 0x1c8, 0x1c3, 0x1de,
+		0x1db, 0x1dd, 0x1df, 0x1d9, 0x1d8, 0x1dc, 0x1c0, 0x1d1,
+		0x000, 0x1a3, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+		0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000, 0x000,
+	},
+};
+
+static const struct cstab koi8_r = {
+	"koi8-r",
+	{
+		{ 0x00, 0x00, 0x00, 1 }, { 0x01, 0x00, 0x00, 1 }, { 0x02, 0x00, 0x00, 1 }, { 0x03, 0x00, 0x00, 1 },
+		{ 0x04, 0x00, 0x00, 1 }, { 0x05, 0x00, 0x00, 1 }, { 0x06, 0x00, 0x00, 1 }, { 0x07, 0x00, 0x00, 1 },
+		{ 0x08, 0x00, 0x00, 1 }, { 0x09, 0x00, 0x00, 1 }, { 0x0a, 0x00, 0x00, 1 }, { 0x0b, 0x00, 0x00, 1 },
+		{ 0x0c, 0x00, 0x00, 1 }, { 0x0d, 0x00, 0x00, 1 }, { 0x0e, 0x00, 0x00, 1 }, { 0x0f, 0x00, 0x00, 1 },
+		{ 0x10, 0x00, 0x00, 1 }, { 0x11, 0x00, 0x00, 1 }, { 0x12, 0x00, 0x00, 1 }, { 0x13, 0x00, 0x00, 1 },
+		{ 0x14, 0x00, 0x00, 1 }, { 0x15, 0x00, 0x00, 1 }, { 0x16, 0x00, 0x00, 1 }, { 0x17, 0x00, 0x00, 1 },
+		{ 0x18, 0x00, 0x00, 1 }, { 0x19, 0x00, 0x00, 1 }, { 0x1a, 0x00, 0x00, 1 }, { 0x1b, 0x00, 0x00, 1 },
+		{ 0x1c, 0x00, 0x00, 1 }, { 0x1d, 0x00, 0x00, 1 }, { 0x1e, 0x00, 0x00, 1 }, { 0x1f, 0x00, 0x00, 1 },
+		{ 0x20, 0x00, 0x00, 1 }, { 0x21, 0x00, 0x00, 1 }, { 0x22, 0x00, 0x00, 1 }, { 0x23, 0x00, 0x00, 1 },
+		{ 0x24, 0x00, 0x00, 1 }, { 0x25, 0x00, 0x00, 1 }, { 0x26, 0x00, 0x00, 1 }, { 0x27, 0x00, 0x00, 1 },
+		{ 0x28, 0x00, 0x00, 1 }, { 0x29, 0x00, 0x00, 1 }, { 0x2a, 0x00, 0x00, 1 }, { 0x2b, 0x00, 0x00, 1 },
+		{ 0x2c, 0x00, 0x00, 1 }, { 0x2d, 0x00, 0x00, 1 }, { 0x2e, 0x00, 0x00, 1 }, { 0x2f, 0x00, 0x00, 1 },
+		{ 0x30, 0x00, 0x00, 1 }, { 0x31, 0x00, 0x00, 1 }, { 0x32, 0x00, 0x00, 1 }, { 0x33, 0x00, 0x00, 1 },
+		{ 0x34, 0x00, 0x00, 1 }, { 0x35, 0x00, 0x00, 1 }, { 0x36, 0x00, 0x00, 1 }, { 0x37, 0x00, 0x00, 1 },
+		{ 0x38, 0x00, 0x00, 1 }, { 0x39, 0x00, 0x00, 1 }, { 0x3a, 0x00, 0x00, 1 }, { 0x3b, 0x00, 0x00, 1 },
+		{ 0x3c, 0x00, 0x00, 1 }, { 0x3d, 0x00, 0x00, 1 }, { 0x3e, 0x00, 0x00, 1 }, { 0x3f, 0x00, 0x00, 1 },
+		{ 0x40, 0x00, 0x00, 1 }, { 0x41, 0x00, 0x00, 1 }, { 0x42, 0x00, 0x00, 1 }, { 0x43, 0x00, 0x00, 1 },
+		{ 0x44, 0x00, 0x00, 1 }, { 0x45, 0x00, 0x00, 1 }, { 0x46, 0x00, 0x00, 1 }, { 0x47, 0x00, 0x00, 1 },
+		{ 0x48, 0x00, 0x00, 1 }, { 0x49, 0x00, 0x00, 1 }, { 0x4a, 0x00, 0x00, 1 }, { 0x4b, 0x00, 0x00, 1 },
+		{ 0x4c, 0x00, 0x00, 1 }, { 0x4d, 0x00, 0x00, 1 }, { 0x4e, 0x00, 0x00, 1 }, { 0x4f, 0x00, 0x00, 1 },
+		{ 0x50, 0x00, 0x00, 1 }, { 0x51, 0x00, 0x00, 1 }, { 0x52, 0x00, 0x00, 1 }, { 0x53, 0x00, 0x00, 1 },
+		{ 0x54, 0x00, 0x00, 1 }, { 0x55, 0x00, 0x00, 1 }, { 0x56, 0x00, 0x00, 1 }, { 0x57, 0x00, 0x00, 1 },
+		{ 0x58, 0x00, 0x00, 1 }, { 0x59, 0x00, 0x00, 1 }, { 0x5a, 0x00, 0x00, 1 }, { 0x5b, 0x00, 0x00, 1 },
+		{ 0x5c, 0x00, 0x00, 1 }, { 0x5d, 0x00, 0x00, 1 }, { 0x5e, 0x00, 0x00, 1 }, { 0x5f, 0x00, 0x00, 1 },
+		{ 0x60, 0x00, 0x00, 1 }, { 0x61, 0x00, 0x00, 1 }, { 0x62, 0x00, 0x00, 1 }, { 0x63, 0x00, 0x00, 1 },
+		{ 0x64, 0x00, 0x00, 1 }, { 0x65, 0x00, 0x00, 1 }, { 0x66, 0x00, 0x00, 1 }, { 0x67, 0x00, 0x00, 1 },
+		{ 0x68, 0x00, 0x00, 1 }, { 0x69, 0x00, 0x00, 1 }, { 0x6a, 0x00, 0x00, 1 }, { 0x6b, 0x00, 0x00, 1 },
+		{ 0x6c, 0x00, 0x00, 1 }, { 0x6d, 0x00, 0x00, 1 }, { 0x6e, 0x00, 0x00, 1 }, { 0x6f, 0x00, 0x00, 1 },
+		{ 0x70, 0x00, 0x00, 1 }, { 0x71, 0x00, 0x00, 1 }, { 0x72, 0x00, 0x00, 1 }, { 0x73, 0x00, 0x00, 1 },
+		{ 0x74, 0x00, 0x00, 1 }, { 0x75, 0x00, 0x00, 1 }, { 0x76, 0x00, 0x00, 1 }, { 0x77, 0x00, 0x00, 1 },
+		{ 0x78, 0x00, 0x00, 1 }, { 0x79, 0x00, 0x00, 1 }, { 0x7a, 0x00, 0x00, 1 }, { 0x7b, 0x00, 0x00, 1 },
+		{ 0x7c, 0x00, 0x00, 1 }, { 0x7d, 0x00, 0x00, 1 }, { 0x7e, 0x00, 0x00, 1 }, { 0x7f, 0x00, 0x00, 1 },
+		{ 0xe2, 0x94, 0x80, 3 }, { 0xe2, 0x94, 0x82, 3 }, { 0xe2, 0x94, 0x8c, 3 }, { 0xe2, 0x94, 0x90, 3 },
+		{ 0xe2, 0x94, 0x94, 3 }, { 0xe2, 0x94, 0x98, 3 }, { 0xe2, 0x94, 0x9c, 3 }, { 0xe2, 0x94, 0xa4, 3 },
+		{ 0xe2, 0x94, 0xac, 3 }, { 0xe2, 0x94, 0xb4, 3 }, { 0xe2, 0x94, 0xbc, 3 }, { 0xe2, 0x96, 0x80, 3 },
+		{ 0xe2, 0x96, 0x84, 3 }, { 0xe2, 0x96, 0x88, 3 }, { 0xe2, 0x96, 0x8c, 3 }, { 0xe2, 0x96, 0x90, 3 },
+		{ 0xe2, 0x96, 0x91, 3 }, { 0xe2, 0x96, 0x92, 3 }, { 0xe2, 0x96, 0x93, 3 }, { 0xe2, 0x8c, 0xa0, 3 },
+		{ 0xe2, 0x96, 0xa0, 3 }, { 0xe2, 0x88, 0x99, 3 }, { 0xe2, 0x88, 0x9a, 3 }, { 0xe2, 0x89, 0x88, 3 },
+		{ 0xe2, 0x89, 0xa4, 3 }, { 0xe2, 0x89, 0xa5, 3 }, { 0xc2, 0xa0, 0x00, 2 }, { 0xe2, 0x8c, 0xa1, 3 },
+		{ 0xc2, 0xb0, 0x00, 2 }, { 0xc2, 0xb2, 0x00, 2 }, { 0xc2, 0xb7, 0x00, 2 }, { 0xc3, 0xb7, 0x00, 2 },
+		{ 0xe2, 0x95, 0x90, 3 }, { 0xe2, 0x95, 0x91, 3 }, { 0xe2, 0x95, 0x92, 3 }, { 0xd1, 0x91, 0x00, 2 },
+		{ 0xe2, 0x95, 0x93, 3 }, { 0xe2, 0x95, 0x94, 3 }, { 0xe2, 0x95, 0x95, 3 }, { 0xe2, 0x95, 0x96, 3 },
+		{ 0xe2, 0x95, 0x97, 3 }, { 0xe2, 0x95, 0x98, 3 }, { 0xe2, 0x95, 0x99, 3 }, { 0xe2, 0x95, 0x9a, 3 },
+		{ 0xe2, 0x95, 0x9b, 3 }, { 0xe2, 0x95, 0x9c, 3 }, { 0xe2, 0x95, 0x9d, 3 }, { 0xe2, 0x95, 0x9e, 3 },
+		{ 0xe2, 0x95, 0x9f, 3 }, { 0xe2, 0x95, 0xa0, 3 }, { 0xe2, 0x95, 0xa1, 3 }, { 0xd0, 0x81, 0x00, 2 },
+		{ 0xe2, 0x95, 0xa2, 3 }, { 0xe2, 0x95, 0xa3, 3 }, { 0xe2, 0x95, 0xa4, 3 }, { 0xe2, 0x95, 0xa5, 3 },
+		{ 0xe2, 0x95, 0xa6, 3 }, { 0xe2, 0x95, 0xa7, 3 }, { 0xe2, 0x95, 0xa8, 3 }, { 0xe2, 0x95, 0xa9, 3 },
+		{ 0xe2, 0x95, 0xaa, 3 }, { 0xe2, 0x95, 0xab, 3 }, { 0xe2, 0x95, 0xac, 3 }, { 0xc2, 0xa9, 0x00, 2 },
+		{ 0xd1, 0x8e, 0x00, 2 }, { 0xd0, 0xb0, 0x00, 2 }, { 0xd0, 0xb1, 0x00, 2 }, { 0xd1, 0x86, 0x00, 2 },
+		{ 0xd0, 0xb4, 0x00, 2 }, { 0xd0, 0xb5, 0x00, 2 }, { 0xd1, 0x84, 0x00, 2 }, { 0xd0, 0xb3, 0x00, 2 },
+		{ 0xd1, 0x85, 0x00, 2 }, { 0xd0, 0xb8, 0x00, 2 }, { 0xd0, 0xb9, 0x00, 2 }, { 0xd0, 0xba, 0x00, 2 },
+		{ 0xd0, 0xbb, 0x00, 2 }, { 0xd0, 0xbc, 0x00, 2 }, { 0xd0, 0xbd, 0x00, 2 }, { 0xd0, 0xbe, 0x00, 2 },
+		{ 0xd0, 0xbf, 0x00, 2 }, { 0xd1, 0x8f, 0x00, 2 }, { 0xd1, 0x80, 0x00, 2 }, { 0xd1, 0x81, 0x00, 2 },
+		{ 0xd1, 0x82, 0x00, 2 }, { 0xd1, 0x83, 0x00, 2 }, { 0xd0, 0xb6, 0x00, 2 }, { 0xd0, 0xb2, 0x00, 2 },
+		{ 0xd1, 0x8c, 0x00, 2 }, { 0xd1, 0x8b, 0x00, 2 }, { 0xd0, 0xb7, 0x00, 2 }, { 0xd1, 0x88, 0x00, 2 },
+		{ 0xd1, 0x8d, 0x00, 2 }, { 0xd1, 0x89, 0x00, 2 }, { 0xd1, 0x87, 0x00, 2 }, { 0xd1, 0x8a, 0x00, 2 },
+		{ 0xd0, 0xae, 0x00, 2 }, { 0xd0, 0x90, 0x00, 2 }, { 0xd0, 0x91, 0x00, 2 }, { 0xd0, 0xa6, 0x00, 2 },
+		{ 0xd0, 0x94, 0x00, 2 }, { 0xd0, 0x95, 0x00, 2 }, { 0xd0, 0xa4, 0x00, 2 }, { 0xd0, 0x93, 0x00, 2 },
+		{ 0xd0, 0xa5, 0x00, 2 }, { 0xd0, 0x98, 0x00, 2 }, { 0xd0, 0x99, 0x00, 2 }, { 0xd0, 0x9a, 0x00, 2 },
+		{ 0xd0, 0x9b, 0x00, 2 }, { 0xd0, 0x9c, 0x00, 2 }, { 0xd0, 0x9d, 0x00, 2 }, { 0xd0, 0x9e, 0x00, 2 },
+		{ 0xd0, 0x9f, 0x00, 2 }, { 0xd0, 0xaf, 0x00, 2 }, { 0xd0, 0xa0, 0x00, 2 }, { 0xd0, 0xa1, 0x00, 2 },
+		{ 0xd0, 0xa2, 0x00, 2 }, { 0xd0, 0xa3, 0x00, 2 }, { 0xd0, 0x96, 0x00, 2 }, { 0xd0, 0x92, 0x00, 2 },
+		{ 0xd0, 0xac, 0x00, 2 }, { 0xd0, 0xab, 0x00, 2 }, { 0xd0, 0x97, 0x00, 2 }, { 0xd0, 0xa8, 0x00, 2 },
+		{ 0xd0, 0xad, 0x00, 2 }, { 0xd0, 0xa9, 0x00, 2 }, { 0xd0, 0xa7, 0x00, 2 }, { 0xd0, 0xaa, 0x00, 2 },
+	},
+	{
+		1, 0, 0, 0, 5, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 4, 3, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	koi8_r_rev,
+	0
+};
+
+const struct cstab *const cstab_builtin[] = {
+	&iso8859_1,
+	&iso8859_2,
+	&iso8859_3,
+	&iso8859_4,
+	&iso8859_5,
+	&iso8859_6,
+	&iso8859_7,
+	&iso8859_8,
+	&iso8859_9,
+	&iso8859_10,
+	&iso8859_11,
+	&iso8859_13,
+	&iso8859_14,
+	&iso8859_15,
+	&iso8859_16,
+	&cp1252,
+	&koi8_r,
+	NULL
+};
+
+const char *const cstab_builtin_names[] = {
+	"iso8859-1",
+	"iso8859-2",
+	"iso8859-3",
+	"iso8859-4",
+	"iso8859-5",
+	"iso8859-6",
+	"iso8859-7",
+	"iso8859-8",
+	"iso8859-9",
+	"iso8859-10",
+	"iso8859-11",
+	"iso8859-13",
+	"iso8859-14",
+	"iso8859-15",
+	"iso8859-16",
+	"cp1252",
+	"koi8-r",
+	NULL
+};
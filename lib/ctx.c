@@ -0,0 +1,386 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <iconv.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cv-impl.h"
+
+/*
+ * Create a context for a list of candidate encodings: one for each of
+ * them, the first of which also holds the detection models.  Detection
+ * needs a transcoding table for every candidate.
+ */
+static cv_ctx *
+cv_open_list(const char *list, int flags)
+{
+	struct cv_cand *cc;
+	cv_ctx *ctx;
+	char name[64];
+	const char *p, *q;
+	size_t len;
+	int serrno;
+
+	if ((cc = calloc(1, sizeof *cc)) == NULL)
+		return (NULL);
+	for (p = list; *p != '\0'; p = *q ? q + 1 : q) {
+		if ((q = strchr(p, ',')) == NULL)
+			q = p + strlen(p);
+		if ((len = q - p) == 0)
+			continue;
+		if (len >= sizeof name || cc->n == CV_MAXCAND ||
+		    (flags & CV_ICONV) != 0) {
+			errno = EINVAL;
+			goto fail;
+		}
+		memcpy(name, p, len);
+		name[len] = '\0';
+		if ((cc->ctx[cc->n] = cv_open(name, flags)) == NULL)
+			goto fail;
+		if (cc->ctx[cc->n++]->tab == NULL) {
+			errno = EINVAL;
+			goto fail;
+		}
+	}
+	if (cc->n == 0) {
+		errno = EINVAL;
+		goto fail;
+	}
+	ctx = cc->ctx[0];
+	if (cc->n == 1) {
+		free(cc);
+		return (ctx);
+	}
+	ctx->cand = cc;
+	if (cv_detect_init(ctx) != 0) {
+		ctx->cand = NULL;
+		goto fail;
+	}
+	return (ctx);
+fail:
+	serrno = errno;
+	while (cc->n > 0)
+		cv_close(cc->ctx[--cc->n]);
+	free(cc->models);
+	free(cc);
+	errno = serrno;
+	return (NULL);
+}
+
+/*
+ * Create a conversion context for the given 8-bit encoding, or list of
+ * encodings.  A transcoding table is used if one is available, unless
+ * the CV_ICONV flag is specified.  With the CV_NFC flag, valid UTF-8
+ * which is not in Unicode normalization form C is classified as such,
+ * and converted to it.  Returns NULL and sets errno on failure.
+ */
+cv_ctx *
+cv_open(const char *charset, int flags)
+{
+	cv_ctx *ctx;
+	unsigned int b;
+	int serrno;
+
+	if (strchr(charset, ',') != NULL)
+		return (cv_open_list(charset, flags));
+	if ((ctx = calloc(1, sizeof *ctx)) == NULL)
+		return (NULL);
+	ctx->fwd = ctx->rev = (iconv_t)-1;
+	ctx->nfc = (flags & CV_NFC) != 0;
+	if ((ctx->charset = strdup(charset)) == NULL ||
+	    (ctx->nfc && nfc_reserve(ctx, 3 * NAME_MAX) != 0))
+		goto fail;
+	if ((flags & CV_ICONV) == 0 &&
+	    (ctx->tab = cstab_open(charset)) != NULL) {
+		/* cv_fix() passes ASCII through untouched */
+		for (b = 0; b < 0x80; ++b)
+			if (ctx->tab->fwd[b][0] != b ||
+			    ctx->tab->fwd[b][3] != 1)
+				break;
+		if (b == 0x80)
+			ctx->fixtab = ctx->tab;
+		return (ctx);
+	}
+	if ((ctx->fwd = iconv_open("utf8", charset)) == (iconv_t)-1 ||
+	    (ctx->rev = iconv_open(charset, "utf8")) == (iconv_t)-1)
+		goto fail;
+	return (ctx);
+fail:
+	serrno = errno;
+	cv_close(ctx);
+	errno = serrno;
+	return (NULL);
+}
+
+/*
+ * Destroy a conversion context.
+ */
+void
+cv_close(cv_ctx *ctx)
+{
+
+	if (ctx == NULL)
+		return;
+	if (ctx->cand != NULL) {
+		while (ctx->cand->n > 1)
+			cv_close(ctx->cand->ctx[--ctx->cand->n]);
+		free(ctx->cand->models);
+		free(ctx->cand);
+	}
+	cstab_close(ctx->tab);
+	if (ctx->fwd != (iconv_t)-1)
+		iconv_close(ctx->fwd);
+	if (ctx->rev != (iconv_t)-1)
+		iconv_close(ctx->rev);
+	free(ctx->nfcbuf);
+	free(ctx->nfcout);
+	free(ctx->charset);
+	free(ctx);
+}
+
+/*
+ * Return the name of the context's 8-bit encoding.
+ */
+const char *
+cv_charset(const cv_ctx *ctx)
+{
+
+	return (ctx->charset);
+}
+
+/*
+ * Return the number of candidate encodings, which is 1 unless the
+ * context was opened with a list.
+ */
+unsigned int
+cv_candidates(const cv_ctx *ctx)
+{
+
+	return (ctx->cand != NULL ? ctx->cand->n : 1);
+}
+
+/*
+ * Return the name of a candidate encoding.
+ */
+const char *
+cv_candidate(const cv_ctx *ctx, unsigned int i)
+{
+
+	return (ctx->cand != NULL ? ctx->cand->ctx[i]->charset :
+	    ctx->charset);
+}
+
+/*
+ * Return the index of the candidate chosen by the last call to cv_fix(),
+ * and the confidence in percent, or -1 if it did not need to choose.
+ */
+int
+cv_detected(const cv_ctx *ctx, unsigned int *confidence)
+{
+
+	if (ctx->cand == NULL || ctx->cand->detected < 0)
+		return (-1);
+	if (confidence != NULL)
+		*confidence = ctx->cand->confidence;
+	return (ctx->cand->detected);
+}
+
+/*
+ * Return non-zero if the context uses a transcoding table.
+ */
+int
+cv_tabled(const cv_ctx *ctx)
+{
+
+	return (ctx->tab != NULL);
+}
+
+/*
+ * List the character sets for which tables are built in.
+ */
+const char *const *
+cv_charsets(void)
+{
+
+	return (cstab_builtin_names);
+}
+
+/*
+ * Reset the conversion state.  This is only needed after an incomplete
+ * conversion, and only if the encoding is stateful.
+ */
+void
+cv_reset(cv_ctx *ctx, cv_dir dir)
+{
+
+	if (ctx->tab == NULL)
+		iconv(dir == CV_FWD ? ctx->fwd : ctx->rev,
+		    NULL, NULL, NULL, NULL);
+}
+
+/*
+ * Table-driven conversion from 8-bit to UTF-8.  First, convert as much as
+ * is certain to fit in one go; if that succeeds, convert whatever is left
+ * one character at a time, stopping when we run out of space or, if the
+ * first step failed, at the offending character.
+ */
+static size_t
+cv_convert_fwd(const struct cstab *tab,
+    const char **in, size_t *inleft, char **out, size_t *outleft)
+{
+	const unsigned char *ent;
+	size_t n, len;
+
+	n = *outleft > 0 ? (*outleft - 1) / 3 : 0;
+	if (n > *inleft)
+		n = *inleft;
+	if (n > 0 && (len = cstab_fwd(tab, *in, n, *out)) != (size_t)-1) {
+		*in += n;
+		*inleft -= n;
+		*out += len;
+		*outleft -= len;
+	}
+	while (*inleft > 0) {
+		ent = tab->fwd[(unsigned char)**in];
+		if (ent[3] == 0) {
+			errno = EILSEQ;
+			return ((size_t)-1);
+		}
+		if (ent[3] > *outleft) {
+			errno = E2BIG;
+			return ((size_t)-1);
+		}
+		memcpy(*out, ent, ent[3]);
+		*in += 1;
+		*inleft -= 1;
+		*out += ent[3];
+		*outleft -= ent[3];
+	}
+	return (0);
+}
+
+/*
+ * Table-driven conversion from UTF-8 to 8-bit, one character at a time.
+ */
+static size_t
+cv_convert_rev(const struct cstab *tab,
+    const char **in, size_t *inleft, char **out, size_t *outleft)
+{
+	const unsigned char *p;
+	size_t n;
+
+	while (*inleft > 0) {
+		if (*outleft == 0) {
+			errno = E2BIG;
+			return ((size_t)-1);
+		}
+		p = (const unsigned char *)*in;
+		n = *p < 0x80 ? 1 : *p < 0xe0 ? 2 : 3;
+		if (n > *inleft) {
+			errno = EINVAL;
+			return ((size_t)-1);
+		}
+		if (cstab_rev(tab, *in, n, *out) != 1) {
+			errno = EILSEQ;
+			return ((size_t)-1);
+		}
+		*in += n;
+		*inleft -= n;
+		*out += 1;
+		*outleft -= 1;
+	}
+	return (0);
+}
+
+/*
+ * Convert as much as possible of the input, with the same semantics as
+ * iconv(3): on return, the pointers and counters have been advanced past
+ * whatever was converted, and on failure, errno is set to E2BIG if the
+ * output buffer is full, EILSEQ if an invalid sequence or unconvertible
+ * character was encountered, or EINVAL if the input ends with an
+ * incomplete sequence.
+ */
+size_t
+cv_convert(cv_ctx *ctx, cv_dir dir,
+    const char **in, size_t *inleft, char **out, size_t *outleft)
+{
+	char *ip;
+	size_t ret;
+
+	if (ctx->tab != NULL) {
+		if (dir == CV_FWD)
+			return (cv_convert_fwd(ctx->tab,
+			    in, inleft, out, outleft));
+		return (cv_convert_rev(ctx->tab, in, inleft, out, outleft));
+	}
+	ip = (char *)(uintptr_t)*in;
+	ret = iconv(dir == CV_FWD ? ctx->fwd : ctx->rev,
+	    &ip, inleft, out, outleft);
+	*in = ip;
+	return (ret);
+}
+
+/*
+ * Convert an entire string into a caller-supplied buffer and terminate it
+ * with a NUL character.  Returns the length of the output, not counting
+ * the NUL, or (size_t)-1 if the conversion failed or the output did not
+ * fit.
+ */
+size_t
+cv_convstr(cv_ctx *ctx, cv_dir dir,
+    const char *in, size_t inlen, char *out, size_t outsize)
+{
+	char *op;
+	size_t olen;
+
+	op = out;
+	olen = outsize;
+	cv_reset(ctx, dir);
+	if (cv_convert(ctx, dir, &in, &inlen, &op, &olen) == (size_t)-1)
+		return ((size_t)-1);
+	/* flush any pending shift sequence */
+	if (ctx->tab == NULL &&
+	    iconv(dir == CV_FWD ? ctx->fwd : ctx->rev,
+	    NULL, NULL, &op, &olen) == (size_t)-1)
+		return ((size_t)-1);
+	if (olen == 0) {
+		errno = E2BIG;
+		return ((size_t)-1);
+	}
+	*op = '\0';
+	return (op - out);
+}
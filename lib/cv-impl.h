@@ -0,0 +1,186 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifndef CV_IMPL_H_INCLUDED
+#define CV_IMPL_H_INCLUDED
+
+#include <iconv.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define HAVE_X86_SIMD 1
+#include <immintrin.h>
+#endif
+
+#include "conv-tools.h"
+
+/*
+ * Transcoding table for a single-byte character set.
+ *
+ * Each entry in the forward table holds the UTF-8 encoding of the
+ * corresponding byte, padded to three bytes, followed by its length.  A
+ * length of zero means that the byte is not part of the character set.
+ *
+ * The reverse table is split into pages of 256 codepoints.  The index
+ * maps the upper half of a BMP codepoint to a page number plus one, or
+ * to zero if no codepoint on that page is part of the character set.
+ * Each entry in a page is either 0x100 plus the corresponding byte, or
+ * zero.
+ */
+struct cstab {
+	const char *name;
+	unsigned char fwd[256][4];
+	unsigned char revidx[256];
+	const unsigned short (*rev)[256];
+	int dynamic;
+};
+
+/* tables generated at build time, terminated by NULL */
+extern const struct cstab *const cstab_builtin[];
+extern const char *const cstab_builtin_names[];
+
+struct cstab *cstab_probe(const char *);
+const struct cstab *cstab_open(const char *);
+void cstab_close(const struct cstab *);
+size_t cstab_fwd(const struct cstab *, const char *, size_t, char *);
+size_t cstab_rev(const struct cstab *, const char *, size_t, char *);
+
+/*
+ * Conversion context.  If a transcoding table is available, the iconv
+ * descriptors are not used.
+ */
+struct cv_ctx {
+	char *charset;		/* presumed 8-bit encoding */
+	const struct cstab *tab; /* transcoding table or NULL */
+	const struct cstab *fixtab; /* tab, if it maps ASCII to itself */
+	iconv_t fwd;		/* 8-bit to UTF-8 */
+	iconv_t rev;		/* UTF-8 to 8-bit */
+	char scratch[1024];	/* scratch space for WTF-8 detection */
+	struct cv_cand *cand;	/* candidate encodings, if more than one */
+	int nfc;		/* CV_NFC was specified */
+	uint32_t *nfcbuf;	/* scratch space for normalization */
+	char *nfcout;
+	size_t nfclen;		/* longest string it has room for */
+};
+
+/*
+ * Charset detection.  When a context is opened with a list of candidate
+ * encodings, the first is the context itself, and the others get their
+ * own context.  Each candidate has a model, for every language it can
+ * represent, which assigns a weight to each non-ASCII byte: roughly the
+ * logarithm of the frequency of the character it stands for in that
+ * language, in sixteenths of a bit.
+ */
+#define CV_NLANGS	16
+
+struct cv_model {
+	unsigned int cand;		/* candidate index */
+	const char *lang;		/* language name */
+	int16_t w[128];			/* weight of each byte */
+};
+
+struct cv_cand {
+	unsigned int n;			/* number of candidates */
+	cv_ctx *ctx[CV_MAXCAND];	/* their contexts */
+	unsigned int nmodels;
+	struct cv_model *models;
+	uint32_t hist[128];		/* scratch histogram */
+	int detected;			/* outcome of the last detection */
+	unsigned int confidence;
+};
+
+int cv_detect_init(cv_ctx *);
+int cv_detect(cv_ctx *, const unsigned char *, size_t);
+
+/*
+ * Unicode normalization.  The canonical combining class and NFC quick
+ * check value of each code point below NFC_LIMIT are found through a
+ * two-stage table; those above it have neither.  Full canonical
+ * decompositions are listed by code point, and primary composites by
+ * the pair they are composed of, both sorted.  The tables are generated
+ * by mknfctab.py, which must agree with NFC_SHIFT and NFC_LIMIT.
+ */
+#define NFC_SHIFT	5
+#define NFC_LIMIT	0x30000
+
+enum { nfc_yes, nfc_maybe, nfc_no };
+
+struct nfc_prop {
+	uint8_t ccc;			/* canonical combining class */
+	uint8_t qc;			/* NFC_Quick_Check */
+};
+
+extern const struct nfc_prop nfc_props[];
+extern const uint8_t nfc_stage1[];
+extern const uint8_t nfc_stage2[][1 << NFC_SHIFT];
+extern const size_t nfc_ndecomp;
+extern const uint32_t nfc_decomp_cp[];
+extern const uint16_t nfc_decomp_idx[];
+extern const uint32_t nfc_decomp_seq[];
+extern const size_t nfc_ncomp;
+extern const uint32_t nfc_comp[][3];
+
+int nfc_check(const unsigned char *, size_t);
+int nfc_reserve(cv_ctx *, size_t);
+size_t nfc_conv(cv_ctx *, const char *, size_t, char *, size_t);
+int nfc_test(cv_ctx *, const char *, size_t);
+
+/*
+ * Incremental UTF-8 validator.
+ */
+struct utf8_state {
+	unsigned int state;	/* DFA state */
+	unsigned int hi;	/* OR of all bytes seen */
+};
+
+void utf8_init(struct utf8_state *);
+void utf8_feed(struct utf8_state *, const unsigned char *, size_t);
+cv_nameclass utf8_result(const struct utf8_state *);
+
+cv_nameclass utf8_fix(const struct cstab *, const unsigned char *, size_t,
+    unsigned char *, size_t *);
+cv_nameclass utf8_classify_scalar(const unsigned char *, size_t);
+#ifdef HAVE_X86_SIMD
+cv_nameclass utf8_classify_sse2(const unsigned char *, size_t);
+cv_nameclass utf8_classify_ssse3(const unsigned char *, size_t);
+cv_nameclass utf8_classify_avx2(const unsigned char *, size_t);
+#endif
+
+/*
+ * CPU-specific implementations of the scanning kernels.
+ */
+struct cv_impl {
+	const char *name;
+	int (*supported)(void);
+	cv_nameclass (*classify)(const unsigned char *, size_t);
+	size_t (*hist8)(const unsigned char *, size_t, uint32_t *);
+};
+
+const struct cv_impl *cv_impl_get(void);
+
+#endif
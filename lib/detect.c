@@ -0,0 +1,405 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cv-impl.h"
+
+/*
+ * Language models: the relative frequency of the non-ASCII lower-case
+ * letters of each language, in thousandths of a percent of all letters
+ * in running text.  Upper-case letters are assumed to be sixteen times
+ * less frequent than their lower-case counterparts.  Punctuation and
+ * symbols which are common to all languages are listed separately.
+ */
+struct cv_freq {
+	uint16_t cp;
+	uint16_t f;
+};
+
+static const struct cv_freq lang_danish[] = {
+	{ 0x00e5, 1100 }, { 0x00e6, 900 }, { 0x00f8, 950 }, { 0x00e9, 20 },
+	{ 0 }
+};
+
+static const struct cv_freq lang_swedish[] = {
+	{ 0x00e4, 2500 }, { 0x00e5, 700 }, { 0x00f6, 1000 }, { 0x00e9, 10 },
+	{ 0 }
+};
+
+static const struct cv_freq lang_german[] = {
+	{ 0x00e4, 578 }, { 0x00f6, 443 }, { 0x00fc, 995 }, { 0x00df, 307 },
+	{ 0x00e9, 10 },
+	{ 0 }
+};
+
+static const struct cv_freq lang_french[] = {
+	{ 0x00e9, 1504 }, { 0x00e8, 271 }, { 0x00ea, 218 }, { 0x00e0, 486 },
+	{ 0x00e2, 51 }, { 0x00e7, 85 }, { 0x00ee, 45 }, { 0x00ef, 5 },
+	{ 0x00f4, 23 }, { 0x00f9, 58 }, { 0x00fb, 60 }, { 0x00eb, 8 },
+	{ 0x0153, 18 }, { 0x00ab, 60 }, { 0x00bb, 60 },
+	{ 0 }
+};
+
+static const struct cv_freq lang_spanish[] = {
+	{ 0x00e1, 502 }, { 0x00e9, 433 }, { 0x00ed, 725 }, { 0x00f1, 311 },
+	{ 0x00f3, 827 }, { 0x00fa, 168 }, { 0x00fc, 12 }, { 0x00bf, 30 },
+	{ 0x00a1, 20 },
+	{ 0 }
+};
+
+static const struct cv_freq lang_portuguese[] = {
+	{ 0x00e3, 733 }, { 0x00e7, 530 }, { 0x00e1, 118 }, { 0x00e9, 337 },
+	{ 0x00ea, 450 }, { 0x00f3, 296 }, { 0x00f5, 40 }, { 0x00ed, 132 },
+	{ 0x00fa, 207 }, { 0x00e0, 72 }, { 0x00e2, 562 }, { 0x00f4, 635 },
+	{ 0 }
+};
+
+static const struct cv_freq lang_icelandic[] = {
+	{ 0x00f0, 4393 }, { 0x00fe, 1455 }, { 0x00e6, 867 }, { 0x00f6, 777 },
+	{ 0x00e1, 1799 }, { 0x00e9, 647 }, { 0x00ed, 1570 }, { 0x00f3, 994 },
+	{ 0x00fa, 613 }, { 0x00fd, 228 },
+	{ 0 }
+};
+
+static const struct cv_freq lang_polish[] = {
+	{ 0x0105, 699 }, { 0x0107, 743 }, { 0x0119, 1035 }, { 0x0142, 2109 },
+	{ 0x0144, 362 }, { 0x00f3, 1141 }, { 0x015b, 814 }, { 0x017a, 78 },
+	{ 0x017c, 706 }, { 0x201e, 30 },
+	{ 0 }
+};
+
+static const struct cv_freq lang_czech[] = {
+	{ 0x00e1, 867 }, { 0x010d, 462 }, { 0x010f, 15 }, { 0x00e9, 633 },
+	{ 0x011b, 1222 }, { 0x00ed, 1643 }, { 0x0148, 7 }, { 0x00f3, 24 },
+	{ 0x0159, 380 }, { 0x0161, 688 }, { 0x0165, 6 }, { 0x00fa, 45 },
+	{ 0x016f, 204 }, { 0x00fd, 995 }, { 0x017e, 721 }, { 0x201e, 30 },
+	{ 0 }
+};
+
+static const struct cv_freq lang_russian[] = {
+	{ 0x043e, 10970 }, { 0x0435, 8450 }, { 0x0430, 8010 },
+	{ 0x0438, 7350 }, { 0x043d, 6700 }, { 0x0442, 6260 },
+	{ 0x0441, 5470 }, { 0x0440, 4730 }, { 0x0432, 4540 },
+	{ 0x043b, 4400 }, { 0x043a, 3490 }, { 0x043c, 3210 },
+	{ 0x0434, 2980 }, { 0x043f, 2810 }, { 0x0443, 2620 },
+	{ 0x044f, 2010 }, { 0x044b, 1900 }, { 0x044c, 1740 },
+	{ 0x0433, 1700 }, { 0x0437, 1650 }, { 0x0431, 1590 },
+	{ 0x0447, 1440 }, { 0x0439, 1210 }, { 0x0445, 970 },
+	{ 0x0436, 940 }, { 0x0448, 730 }, { 0x044e, 640 },
+	{ 0x0446, 480 }, { 0x0449, 360 }, { 0x044d, 320 },
+	{ 0x0444, 260 }, { 0x044a, 40 }, { 0x0451, 40 },
+	{ 0x00ab, 60 }, { 0x00bb, 60 }, { 0x2116, 5 },
+	{ 0 }
+};
+
+static const struct cv_freq lang_ukrainian[] = {
+	{ 0x043e, 9400 }, { 0x0430, 8400 }, { 0x043d, 7000 },
+	{ 0x0438, 6100 }, { 0x0456, 5700 }, { 0x0432, 5400 },
+	{ 0x0442, 5300 }, { 0x0435, 4900 }, { 0x0440, 4700 },
+	{ 0x0441, 4300 }, { 0x043a, 4000 }, { 0x043b, 3600 },
+	{ 0x0443, 3400 }, { 0x0434, 3300 }, { 0x043c, 2900 },
+	{ 0x043f, 2800 }, { 0x044f, 2200 }, { 0x0437, 2100 },
+	{ 0x044c, 1600 }, { 0x0431, 1600 }, { 0x0433, 1300 },
+	{ 0x0447, 1200 }, { 0x0445, 1100 }, { 0x0436, 900 },
+	{ 0x0439, 900 }, { 0x0457, 800 }, { 0x0448, 800 },
+	{ 0x044e, 700 }, { 0x0446, 600 }, { 0x0449, 600 },
+	{ 0x0454, 400 }, { 0x0444, 300 }, { 0x0491, 20 },
+	{ 0x00ab, 60 }, { 0x00bb, 60 }, { 0x2116, 5 },
+	{ 0 }
+};
+
+static const struct cv_freq lang_greek[] = {
+	{ 0x03b1, 10000 }, { 0x03ac, 1800 }, { 0x03bf, 8300 },
+	{ 0x03cc, 1700 }, { 0x03b9, 7000 }, { 0x03af, 1400 },
+	{ 0x03b5, 7200 }, { 0x03ad, 1600 }, { 0x03c4, 8000 },
+	{ 0x03c3, 4300 }, { 0x03c2, 2600 }, { 0x03bd, 6400 },
+	{ 0x03b7, 4000 }, { 0x03ae, 1200 }, { 0x03c5, 3700 },
+	{ 0x03cd, 800 }, { 0x03c1, 4500 }, { 0x03c0, 4200 },
+	{ 0x03ba, 4100 }, { 0x03bc, 3300 }, { 0x03bb, 2800 },
+	{ 0x03c9, 1400 }, { 0x03ce, 600 }, { 0x03b4, 1700 },
+	{ 0x03b3, 1700 }, { 0x03c7, 1100 }, { 0x03b8, 1300 },
+	{ 0x03c6, 800 }, { 0x03b2, 700 }, { 0x03be, 300 },
+	{ 0x03b6, 400 }, { 0x03c8, 100 }, { 0x03ca, 50 },
+	{ 0x00ab, 60 }, { 0x00bb, 60 },
+	{ 0 }
+};
+
+static const struct cv_freq lang_common[] = {
+	{ 0x00a0, 30 }, { 0x2019, 100 }, { 0x2018, 20 }, { 0x201c, 40 },
+	{ 0x201d, 40 }, { 0x2013, 40 }, { 0x2014, 30 }, { 0x2026, 20 },
+	{ 0x2022, 5 }, { 0x20ac, 10 }, { 0x00a3, 3 }, { 0x00b0, 10 },
+	{ 0x00a7, 3 }, { 0x00b7, 3 }, { 0x00a9, 2 }, { 0x00bd, 2 },
+	{ 0x00d7, 2 }, { 0x00b2, 2 },
+	{ 0 }
+};
+
+static const struct {
+	const char *name;
+	const struct cv_freq *freq;
+} cv_langs[] = {
+	{ "danish", lang_danish },
+	{ "swedish", lang_swedish },
+	{ "german", lang_german },
+	{ "french", lang_french },
+	{ "spanish", lang_spanish },
+	{ "portuguese", lang_portuguese },
+	{ "icelandic", lang_icelandic },
+	{ "polish", lang_polish },
+	{ "czech", lang_czech },
+	{ "russian", lang_russian },
+	{ "ukrainian", lang_ukrainian },
+	{ "greek", lang_greek },
+};
+
+#define NLANGS (sizeof cv_langs / sizeof cv_langs[0])
+
+/* weight of a byte which is not in the character set */
+#define W_INVALID	(-4096)
+/* weight of a character which is not in the model, i.e. 2^-16 */
+#define W_UNKNOWN	(-256)
+/* the least weight of a character which is in the model */
+#define W_KNOWN		(-240)
+
+/*
+ * Map a lower-case letter to upper case, for the scripts used by the
+ * languages above.  Returns the codepoint unchanged if it isn't one.
+ */
+static unsigned int
+cv_upper(unsigned int cp)
+{
+
+	if (cp >= 0xe0 && cp <= 0xfe && cp != 0xf7)
+		return (cp - 0x20);
+	if (cp >= 0x100 && cp <= 0x17f)
+		return (cp - 1);
+	switch (cp) {
+	case 0x3ac:
+		return (0x386);
+	case 0x3ad: case 0x3ae: case 0x3af:
+		return (cp - 0x25);
+	case 0x3cc:
+		return (0x38c);
+	case 0x3cd: case 0x3ce:
+		return (cp - 0x3f);
+	case 0x3c2:
+		return (cp);
+	case 0x491:
+		return (0x490);
+	}
+	if ((cp >= 0x3b1 && cp <= 0x3cb) || (cp >= 0x430 && cp <= 0x44f))
+		return (cp - 0x20);
+	if (cp >= 0x450 && cp <= 0x45f)
+		return (cp - 0x50);
+	return (cp);
+}
+
+/*
+ * Look up the frequency of a character in a language, including upper
+ * case, and, if requested, common punctuation.
+ */
+static unsigned int
+cv_lang_freq(const struct cv_freq *freq, unsigned int cp, int common)
+{
+	const struct cv_freq *p;
+	unsigned int f;
+
+	for (p = freq; p->cp != 0; ++p) {
+		if (p->cp == cp)
+			return (p->f);
+		if (cv_upper(p->cp) == cp && p->cp != cp)
+			return ((f = p->f / 16) > 0 ? f : 1);
+	}
+	for (p = lang_common; common && p->cp != 0; ++p)
+		if (p->cp == cp)
+			return (p->f);
+	return (0);
+}
+
+/*
+ * Decode the codepoint a table maps a byte to, or 0 if none.
+ */
+static unsigned int
+cv_tab_cp(const struct cstab *tab, unsigned int b)
+{
+	const unsigned char *e;
+
+	e = tab->fwd[b];
+	switch (e[3]) {
+	case 1:
+		return (e[0]);
+	case 2:
+		return ((e[0] & 0x1f) << 6 | (e[1] & 0x3f));
+	case 3:
+		return ((e[0] & 0x0f) << 12 | (e[1] & 0x3f) << 6 |
+		    (e[2] & 0x3f));
+	}
+	return (0);
+}
+
+/*
+ * Sixteen times the base-2 logarithm of x, for x > 0, to within a
+ * sixteenth or so.
+ */
+static int
+cv_log2x16(uint64_t x)
+{
+	static const unsigned char frac[16] = {
+		0, 1, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 15
+	};
+	int n;
+
+	n = 63 - __builtin_clzll(x);
+	return (16 * n + frac[(n >= 4 ? x >> (n - 4) : x << (4 - n)) & 0xf]);
+}
+
+/*
+ * Build a model for every combination of candidate and language in which
+ * the candidate can represent at least 90% of the language's non-ASCII
+ * letters.  A candidate for which there is no such language gets a
+ * model which only tells valid bytes from invalid ones.
+ */
+int
+cv_detect_init(cv_ctx *ctx)
+{
+	struct cv_cand *cc = ctx->cand;
+	struct cv_model *m;
+	const struct cstab *tab;
+	const struct cv_freq *p;
+	uint64_t total, covered;
+	unsigned int b, c, cp, f, l, n;
+	int w;
+
+	if ((cc->models = calloc(cc->n * (NLANGS + 1),
+	    sizeof *cc->models)) == NULL)
+		return (-1);
+	for (c = 0; c < cc->n; ++c) {
+		tab = cc->ctx[c]->tab;
+		for (l = 0, n = cc->nmodels; l < NLANGS; ++l) {
+			for (p = cv_langs[l].freq, total = 0; p->cp != 0; ++p)
+				total += p->f + (cv_upper(p->cp) != p->cp ?
+				    (p->f / 16 > 0 ? p->f / 16 : 1) : 0);
+			for (b = 0x80, covered = 0; b < 0x100; ++b)
+				if ((cp = cv_tab_cp(tab, b)) != 0)
+					covered += cv_lang_freq(
+					    cv_langs[l].freq, cp, 0);
+			if (covered * 10 < total * 9)
+				continue;
+			for (p = lang_common; p->cp != 0; ++p)
+				total += p->f;
+			m = &cc->models[cc->nmodels++];
+			m->cand = c;
+			m->lang = cv_langs[l].name;
+			for (b = 0x80; b < 0x100; ++b) {
+				if ((cp = cv_tab_cp(tab, b)) == 0) {
+					m->w[b & 0x7f] = W_INVALID;
+				} else if ((f = cv_lang_freq(cv_langs[l].freq,
+				    cp, 1)) == 0) {
+					m->w[b & 0x7f] = W_UNKNOWN;
+				} else {
+					w = cv_log2x16(((uint64_t)f << 32) /
+					    total) - 16 * 32;
+					m->w[b & 0x7f] =
+					    w > W_KNOWN ? w : W_KNOWN;
+				}
+			}
+		}
+		if (cc->nmodels > n)
+			continue;
+		m = &cc->models[cc->nmodels++];
+		m->cand = c;
+		m->lang = NULL;
+		for (b = 0x80; b < 0x100; ++b)
+			m->w[b & 0x7f] = cv_tab_cp(tab, b) != 0 ?
+			    W_UNKNOWN : W_INVALID;
+	}
+	cc->detected = -1;
+	return (0);
+}
+
+/*
+ * Choose the most likely candidate for a string, by scoring its
+ * histogram of non-ASCII bytes against every model.  A candidate's score
+ * is that of its best model; ties go to the candidate listed first.  The
+ * confidence is the probability of the winner relative to the others,
+ * in percent, assuming they were all equally likely to begin with.
+ * Returns the index of the winner, or -1 if the string is pure ASCII.
+ */
+int
+cv_detect(cv_ctx *ctx, const unsigned char *str, size_t len)
+{
+	/* 65536 times 2^(-k/16) */
+	static const uint32_t pow2[16] = {
+		65536, 62757, 60097, 57549, 55109, 52773, 50535, 48393,
+		46341, 44376, 42495, 40693, 38968, 37316, 35734, 34219,
+	};
+	struct cv_cand *cc = ctx->cand;
+	const struct cv_model *m;
+	unsigned char bins[128];
+	int64_t best[CV_MAXCAND], s;
+	uint64_t d, sum;
+	unsigned int b, c, i, nbins;
+	int win;
+
+	cc->detected = -1;
+	cc->confidence = 0;
+	if (cv_impl_get()->hist8(str, len, cc->hist) == 0)
+		return (-1);
+	for (b = nbins = 0; b < 128; ++b)
+		if (cc->hist[b] != 0)
+			bins[nbins++] = b;
+	for (c = 0; c < cc->n; ++c)
+		best[c] = INT64_MIN;
+	for (i = 0, m = cc->models; i < cc->nmodels; ++i, ++m) {
+		for (b = 0, s = 0; b < nbins; ++b)
+			s += (int64_t)cc->hist[bins[b]] * m->w[bins[b]];
+		if (s > best[m->cand])
+			best[m->cand] = s;
+	}
+	for (b = 0; b < nbins; ++b)
+		cc->hist[bins[b]] = 0;
+	for (c = 1, win = 0; c < cc->n; ++c)
+		if (best[c] > best[win])
+			win = c;
+	for (c = 0, sum = 0; c < cc->n; ++c) {
+		d = best[win] - best[c];
+		if (d < 16 * 16)
+			sum += pow2[d % 16] >> (d / 16);
+	}
+	cc->detected = win;
+	cc->confidence = (100 * 65536 + sum / 2) / sum;
+	return (win);
+}
@@ -0,0 +1,148 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+/*
+ * Generate transcoding tables for common single-byte character sets
+ * using the build host's iconv.  Character sets that iconv does not know
+ * are skipped; they will be probed at run time if requested.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <ctype.h>
+#include <err.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cv-impl.h"
+
+static const char *charsets[] = {
+	"iso8859-1",
+	"iso8859-2",
+	"iso8859-3",
+	"iso8859-4",
+	"iso8859-5",
+	"iso8859-6",
+	"iso8859-7",
+	"iso8859-8",
+	"iso8859-9",
+	"iso8859-10",
+	"iso8859-11",
+	"iso8859-13",
+	"iso8859-14",
+	"iso8859-15",
+	"iso8859-16",
+	"cp1252",
+	"koi8-r",
+	NULL
+};
+
+/*
+ * Turn a character set name into a C identifier.
+ */
+static const char *
+ident(const char *name)
+{
+	static char buf[64];
+	size_t i;
+
+	for (i = 0; name[i] != '\0' && i < sizeof buf - 1; ++i)
+		buf[i] = isalnum((unsigned char)name[i]) ?
+		    tolower((unsigned char)name[i]) : '_';
+	buf[i] = '\0';
+	return (buf);
+}
+
+static void
+emit(const struct cstab *tab)
+{
+	unsigned int b, i, npages;
+
+	for (b = npages = 0; b < 256; ++b)
+		if (tab->revidx[b] > npages)
+			npages = tab->revidx[b];
+	printf("static const unsigned short %s_rev[%u][256] = {\n",
+	    ident(tab->name), npages ? npages : 1);
+	for (i = 0; i < npages; ++i) {
+		printf("\t{");
+		for (b = 0; b < 256; ++b)
+			printf("%s0x%03x,", b % 8 ? " " : "\n\t\t",
+			    tab->rev[i][b]);
+		printf("\n\t},\n");
+	}
+	printf("};\n\n");
+	printf("static const struct cstab %s = {\n", ident(tab->name));
+	printf("\t\"%s\",\n\t{", tab->name);
+	for (b = 0; b < 256; ++b)
+		printf("%s{ 0x%02x, 0x%02x, 0x%02x, %u },",
+		    b % 4 ? " " : "\n\t\t", tab->fwd[b][0], tab->fwd[b][1],
+		    tab->fwd[b][2], tab->fwd[b][3]);
+	printf("\n\t},\n\t{");
+	for (b = 0; b < 256; ++b)
+		printf("%s%u,", b % 16 ? " " : "\n\t\t", tab->revidx[b]);
+	printf("\n\t},\n");
+	printf("\t%s_rev,\n", ident(tab->name));
+	printf("\t0\n};\n\n");
+}
+
+int
+main(void)
+{
+	const struct cstab *tab;
+	unsigned int i;
+	int *found;
+
+	if ((found = calloc(sizeof charsets / sizeof charsets[0],
+	    sizeof *found)) == NULL)
+		err(1, "calloc()");
+	printf("/* This file was generated by mkcstab.  Do not edit. */\n\n");
+	printf("#include <stddef.h>\n\n#include \"cv-impl.h\"\n\n");
+	for (i = 0; charsets[i] != NULL; ++i) {
+		if ((tab = cstab_probe(charsets[i])) == NULL) {
+			warn("%s", charsets[i]);
+			continue;
+		}
+		emit(tab);
+		found[i] = 1;
+	}
+	printf("const struct cstab *const cstab_builtin[] = {\n");
+	for (i = 0; charsets[i] != NULL; ++i)
+		if (found[i])
+			printf("\t&%s,\n", ident(charsets[i]));
+	printf("\tNULL\n};\n\n");
+	printf("const char *const cstab_builtin_names[] = {\n");
+	for (i = 0; charsets[i] != NULL; ++i)
+		if (found[i])
+			printf("\t\"%s\",\n", charsets[i]);
+	printf("\tNULL\n};\n");
+	free(found);
+	exit(0);
+}
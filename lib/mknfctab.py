@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+#-
+# Copyright (c) 2026 The University of Oslo
+# All rights reserved.
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions
+# are met:
+# 1. Redistributions of source code must retain the above copyright
+#    notice, this list of conditions and the following disclaimer.
+# 2. Redistributions in binary form must reproduce the above copyright
+#    notice, this list of conditions and the following disclaimer in the
+#    documentation and/or other materials provided with the distribution.
+# 3. The name of the author may not be used to endorse or promote
+#    products derived from this software without specific prior written
+#    permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+# ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+# IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+# ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+# FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+# DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+# OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+# HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+# LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+# OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+# SUCH DAMAGE.
+#
+
+#
+# Generate the tables used for Unicode normalization (NFC) from the
+# Python interpreter's Unicode database.  The output is committed as
+# nfctab.c, so Python is not needed to build; run this again and commit
+# the result to move to a newer version of Unicode:
+#
+#     python3 mknfctab.py >nfctab.c
+#
+# NFC_SHIFT and NFC_LIMIT must match cv-impl.h.
+#
+
+import sys
+import unicodedata
+
+NFC_SHIFT = 5
+NFC_LIMIT = 0x30000
+
+HANGUL_S = range(0xac00, 0xd7a4)
+HANGUL_V = range(0x1161, 0x1176)
+HANGUL_T = range(0x11a8, 0x11c3)
+
+QC_YES, QC_MAYBE, QC_NO = 0, 1, 2
+
+
+def decomposition(cp):
+    """Canonical decomposition mapping of a code point, or None."""
+    d = unicodedata.decomposition(chr(cp))
+    if not d or d.startswith('<'):
+        return None
+    return [int(x, 16) for x in d.split()]
+
+
+def full_decomposition(cp):
+    d = decomposition(cp)
+    if d is None:
+        return [cp]
+    return [y for x in d for y in full_decomposition(x)]
+
+
+def main():
+    # Hangul syllables are decomposed and composed algorithmically.
+    # A code point with a canonical decomposition which survives NFC is
+    # a primary composite, and always decomposes into a pair; any other
+    # is excluded from composition and can't occur in NFC.
+    decomp = {}
+    pairs = {}
+    excluded = set()
+    for cp in range(0x110000):
+        if cp in HANGUL_S:
+            continue
+        d = decomposition(cp)
+        if d is None:
+            continue
+        decomp[cp] = full_decomposition(cp)
+        if unicodedata.normalize('NFC', chr(cp)) == chr(cp):
+            assert len(d) == 2
+            pairs[tuple(d)] = cp
+        else:
+            excluded.add(cp)
+
+    # A code point which can combine with what precedes it might or
+    # might not occur in NFC, depending on what that is.
+    maybe = set(b for a, b in pairs) | set(HANGUL_V) | set(HANGUL_T)
+
+    # two-stage table of (combining class, quick check) pairs
+    props = []
+    propidx = {}
+    blocks = []
+    blockidx = {}
+    stage1 = []
+    for b in range(NFC_LIMIT >> NFC_SHIFT):
+        block = []
+        for cp in range(b << NFC_SHIFT, (b + 1) << NFC_SHIFT):
+            qc = QC_NO if cp in excluded else \
+                QC_MAYBE if cp in maybe else QC_YES
+            p = (unicodedata.combining(chr(cp)), qc)
+            if p not in propidx:
+                propidx[p] = len(props)
+                props.append(p)
+            block.append(propidx[p])
+        block = tuple(block)
+        if block not in blockidx:
+            blockidx[block] = len(blocks)
+            blocks.append(block)
+        stage1.append(blockidx[block])
+    for cp in range(NFC_LIMIT, 0x110000):
+        assert unicodedata.combining(chr(cp)) == 0
+        assert cp not in excluded and cp not in maybe
+    assert len(props) <= 256 and len(blocks) <= 256
+
+    out = sys.stdout.write
+    out('/* This file was generated by mknfctab.py from Unicode %s.  '
+        'Do not edit. */\n\n' % unicodedata.unidata_version)
+    out('#include <stddef.h>\n\n#include "cv-impl.h"\n\n')
+
+    out('const struct nfc_prop nfc_props[%d] = {' % len(props))
+    for i, (ccc, qc) in enumerate(props):
+        out('%s{ %d, %d },' % (' ' if i % 6 else '\n\t', ccc, qc))
+    out('\n};\n\n')
+
+    out('const uint8_t nfc_stage1[%d] = {' % len(stage1))
+    for i, b in enumerate(stage1):
+        out('%s%d,' % (' ' if i % 16 else '\n\t', b))
+    out('\n};\n\n')
+
+    out('const uint8_t nfc_stage2[%d][%d] = {\n' %
+        (len(blocks), 1 << NFC_SHIFT))
+    for block in blocks:
+        out('\t{')
+        for i, p in enumerate(block):
+            out('%s%d,' % (' ' if i % 16 else '\n\t\t', p))
+        out('\n\t},\n')
+    out('};\n\n')
+
+    cps = sorted(decomp)
+    seq = []
+    idx = []
+    for cp in cps:
+        idx.append(len(seq))
+        seq.extend(decomp[cp])
+    idx.append(len(seq))
+    assert len(seq) < 65536
+    out('const size_t nfc_ndecomp = %d;\n\n' % len(cps))
+    out('const uint32_t nfc_decomp_cp[%d] = {' % len(cps))
+    for i, cp in enumerate(cps):
+        out('%s0x%05x,' % (' ' if i % 8 else '\n\t', cp))
+    out('\n};\n\n')
+    out('const uint16_t nfc_decomp_idx[%d] = {' % len(idx))
+    for i, x in enumerate(idx):
+        out('%s%d,' % (' ' if i % 10 else '\n\t', x))
+    out('\n};\n\n')
+    out('const uint32_t nfc_decomp_seq[%d] = {' % len(seq))
+    for i, cp in enumerate(seq):
+        out('%s0x%05x,' % (' ' if i % 8 else '\n\t', cp))
+    out('\n};\n\n')
+
+    out('const size_t nfc_ncomp = %d;\n\n' % len(pairs))
+    out('const uint32_t nfc_comp[%d][3] = {' % len(pairs))
+    for i, (a, b) in enumerate(sorted(pairs)):
+        out('%s{ 0x%05x, 0x%05x, 0x%05x },' %
+            (' ' if i % 2 else '\n\t', a, b, pairs[(a, b)]))
+    out('\n};\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,395 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "cv-impl.h"
+
+/*
+ * Unicode normalization form C, for strings already known to be valid
+ * UTF-8.
+ *
+ * Most strings can be judged by the quick check algorithm from UAX #15,
+ * which only needs the combining class and quick check value of each
+ * code point.  Nothing below U+0300 has either, so those are skipped by
+ * looking at the first byte.  Only a string which contains a character
+ * that might combine with what precedes it needs to be normalized in
+ * full and compared to the original.
+ */
+
+/* Hangul syllables are composed from conjoining jamo algorithmically */
+#define HANGUL_S	0xac00
+#define HANGUL_L	0x1100
+#define HANGUL_V	0x1161
+#define HANGUL_T	0x11a7
+#define HANGUL_NL	19
+#define HANGUL_NV	21
+#define HANGUL_NT	28
+#define HANGUL_NS	(HANGUL_NL * HANGUL_NV * HANGUL_NT)
+
+/* longest canonical decomposition */
+#define NFC_DECOMP_MAX	4
+
+/* names usually fit on the stack */
+#define NFC_STACK	256
+
+static inline const struct nfc_prop *
+nfc_prop(uint32_t cp)
+{
+
+	if (cp >= NFC_LIMIT)
+		return (&nfc_props[0]);
+	return (&nfc_props[nfc_stage2[nfc_stage1[cp >> NFC_SHIFT]]
+	    [cp & ((1 << NFC_SHIFT) - 1)]]);
+}
+
+/*
+ * Decode the code point at *pos, which must be the start of a valid
+ * UTF-8 sequence, and advance past it.
+ */
+static inline uint32_t
+nfc_getc(const unsigned char *s, size_t *pos)
+{
+	const unsigned char *p = s + *pos;
+
+	if (p[0] < 0x80) {
+		*pos += 1;
+		return (p[0]);
+	} else if (p[0] < 0xe0) {
+		*pos += 2;
+		return ((p[0] & 0x1fU) << 6 | (p[1] & 0x3fU));
+	} else if (p[0] < 0xf0) {
+		*pos += 3;
+		return ((p[0] & 0x0fU) << 12 | (p[1] & 0x3fU) << 6 |
+		    (p[2] & 0x3fU));
+	}
+	*pos += 4;
+	return ((p[0] & 0x07U) << 18 | (p[1] & 0x3fU) << 12 |
+	    (p[2] & 0x3fU) << 6 | (p[3] & 0x3fU));
+}
+
+static inline size_t
+nfc_putc(uint32_t cp, unsigned char *p)
+{
+
+	if (cp < 0x80) {
+		p[0] = cp;
+		return (1);
+	} else if (cp < 0x800) {
+		p[0] = 0xc0 | cp >> 6;
+		p[1] = 0x80 | (cp & 0x3f);
+		return (2);
+	} else if (cp < 0x10000) {
+		p[0] = 0xe0 | cp >> 12;
+		p[1] = 0x80 | (cp >> 6 & 0x3f);
+		p[2] = 0x80 | (cp & 0x3f);
+		return (3);
+	}
+	p[0] = 0xf0 | cp >> 18;
+	p[1] = 0x80 | (cp >> 12 & 0x3f);
+	p[2] = 0x80 | (cp >> 6 & 0x3f);
+	p[3] = 0x80 | (cp & 0x3f);
+	return (4);
+}
+
+/*
+ * Quick check: returns nfc_yes or nfc_no if the string's normalization
+ * can be decided from the properties of its code points, nfc_maybe if
+ * it can't.
+ */
+int
+nfc_check(const unsigned char *s, size_t len)
+{
+	const struct nfc_prop *p;
+	unsigned int lastccc;
+	size_t pos;
+	int ret;
+
+	for (pos = 0, lastccc = 0, ret = nfc_yes; pos < len; ) {
+		if (s[pos] < 0xcc) {
+			/* ASCII or U+0080 to U+02FF */
+			pos += s[pos] < 0x80 ? 1 : 2;
+			lastccc = 0;
+			continue;
+		}
+		p = nfc_prop(nfc_getc(s, &pos));
+		if ((p->ccc != 0 && lastccc > p->ccc) || p->qc == nfc_no)
+			return (nfc_no);
+		if (p->qc == nfc_maybe)
+			ret = nfc_maybe;
+		lastccc = p->ccc;
+	}
+	return (ret);
+}
+
+static const uint32_t *
+nfc_decomp(uint32_t cp, size_t *len)
+{
+	size_t lo, hi, mid;
+
+	for (lo = 0, hi = nfc_ndecomp; lo < hi; ) {
+		mid = lo + (hi - lo) / 2;
+		if (nfc_decomp_cp[mid] < cp)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo == nfc_ndecomp || nfc_decomp_cp[lo] != cp)
+		return (NULL);
+	*len = nfc_decomp_idx[lo + 1] - nfc_decomp_idx[lo];
+	return (&nfc_decomp_seq[nfc_decomp_idx[lo]]);
+}
+
+/*
+ * Return the primary composite of two code points, or 0 if there is
+ * none.
+ */
+static uint32_t
+nfc_compose(uint32_t a, uint32_t b)
+{
+	size_t lo, hi, mid;
+
+	if (a - HANGUL_L < HANGUL_NL && b - HANGUL_V < HANGUL_NV)
+		return (HANGUL_S +
+		    ((a - HANGUL_L) * HANGUL_NV + b - HANGUL_V) * HANGUL_NT);
+	if (a - HANGUL_S < HANGUL_NS && (a - HANGUL_S) % HANGUL_NT == 0 &&
+	    b - HANGUL_T - 1 < HANGUL_NT - 1)
+		return (a + b - HANGUL_T);
+	for (lo = 0, hi = nfc_ncomp; lo < hi; ) {
+		mid = lo + (hi - lo) / 2;
+		if (nfc_comp[mid][0] < a ||
+		    (nfc_comp[mid][0] == a && nfc_comp[mid][1] < b))
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo < nfc_ncomp && nfc_comp[lo][0] == a && nfc_comp[lo][1] == b)
+		return (nfc_comp[lo][2]);
+	return (0);
+}
+
+/*
+ * Append a code point to the decomposed string, keeping combining marks
+ * in canonical order.
+ */
+static inline void
+nfc_append(uint32_t *buf, size_t *n, uint32_t cp)
+{
+	unsigned int ccc;
+	size_t i;
+
+	i = (*n)++;
+	if ((ccc = nfc_prop(cp)->ccc) != 0)
+		for (; i > 0 && nfc_prop(buf[i - 1])->ccc > ccc; --i)
+			buf[i] = buf[i - 1];
+	buf[i] = cp;
+}
+
+/*
+ * Normalize a string to NFC, using a buffer with room for the longest
+ * possible decomposition of the input, NFC_DECOMP_MAX code points per
+ * byte.  The input is decomposed in its entirety before anything is
+ * written to the output, so they may overlap.
+ */
+static size_t
+nfc_normalize(const char *str, size_t len, char *out, size_t size,
+    uint32_t *buf)
+{
+	const unsigned char *s = (const unsigned char *)str;
+	unsigned char *o = (unsigned char *)out;
+	const uint32_t *d;
+	uint32_t cp, comp;
+	unsigned int ccc, lastccc;
+	size_t dlen, i, n, pos, starter;
+
+	/* decompose and reorder */
+	for (pos = n = 0; pos < len; ) {
+		cp = nfc_getc(s, &pos);
+		if (cp - HANGUL_S < HANGUL_NS) {
+			i = cp - HANGUL_S;
+			buf[n++] = HANGUL_L + i / (HANGUL_NV * HANGUL_NT);
+			buf[n++] = HANGUL_V + i % (HANGUL_NV * HANGUL_NT) /
+			    HANGUL_NT;
+			if (i % HANGUL_NT != 0)
+				buf[n++] = HANGUL_T + i % HANGUL_NT;
+		} else if (cp >= 0xc0 && (d = nfc_decomp(cp, &dlen)) != NULL) {
+			for (i = 0; i < dlen; ++i)
+				nfc_append(buf, &n, d[i]);
+		} else {
+			nfc_append(buf, &n, cp);
+		}
+	}
+
+	/* compose, in place */
+	if (n > 0) {
+		starter = 0;
+		lastccc = nfc_prop(buf[0])->ccc ? 256 : 0;
+		for (i = 1, pos = 1; i < n; ++i) {
+			cp = buf[i];
+			ccc = nfc_prop(cp)->ccc;
+			if ((lastccc < ccc || lastccc == 0) &&
+			    (comp = nfc_compose(buf[starter], cp)) != 0) {
+				buf[starter] = comp;
+				continue;
+			}
+			if (ccc == 0)
+				starter = pos;
+			lastccc = ccc;
+			buf[pos++] = cp;
+		}
+		n = pos;
+	}
+
+	/* encode */
+	for (i = pos = 0; i < n; ++i) {
+		if (pos + (buf[i] < 0x80 ? 1 : buf[i] < 0x800 ? 2 :
+		    buf[i] < 0x10000 ? 3 : 4) > size) {
+			errno = E2BIG;
+			return ((size_t)-1);
+		}
+		pos += nfc_putc(buf[i], o + pos);
+	}
+	if (pos < size)
+		o[pos] = '\0';
+	return (pos);
+}
+
+/*
+ * Normalize a string to NFC.  The string must be valid UTF-8.  The
+ * output never needs more than three times the length of the input
+ * plus a terminating NUL, which is added if there is room.  Returns the
+ * length of the output, or (size_t)-1 and sets errno if the output does
+ * not fit or we run out of memory.
+ */
+size_t
+cv_nfc(const char *str, size_t len, char *out, size_t size)
+{
+	uint32_t stackbuf[NFC_DECOMP_MAX * NFC_STACK], *buf;
+	size_t ret;
+
+	buf = stackbuf;
+	if (len > NFC_STACK &&
+	    (buf = malloc(NFC_DECOMP_MAX * len * sizeof *buf)) == NULL)
+		return ((size_t)-1);
+	ret = nfc_normalize(str, len, out, size, buf);
+	if (buf != stackbuf)
+		free(buf);
+	return (ret);
+}
+
+/*
+ * Return non-zero if a string, which must be valid UTF-8, is in NFC.
+ */
+int
+cv_isnfc(const char *str, size_t len)
+{
+	char stackbuf[3 * NFC_STACK + 1], *buf;
+	size_t size, n;
+	int ret;
+
+	switch (nfc_check((const unsigned char *)str, len)) {
+	case nfc_yes:
+		return (1);
+	case nfc_no:
+		return (0);
+	}
+	size = 3 * len + 1;
+	buf = stackbuf;
+	if (size > sizeof stackbuf && (buf = malloc(size)) == NULL)
+		return (1);
+	n = cv_nfc(str, len, buf, size);
+	ret = n == len && memcmp(buf, str, len) == 0;
+	if (buf != stackbuf)
+		free(buf);
+	return (ret);
+}
+
+/*
+ * Make sure that the context's scratch space has room to normalize a
+ * string of the given length.  cv_open() reserves enough for any name
+ * converted from an 8-bit encoding, so that cv_fix() does not need to
+ * allocate memory for names; anything longer grows it for good.
+ */
+int
+nfc_reserve(cv_ctx *ctx, size_t len)
+{
+	uint32_t *buf;
+	char *out;
+
+	if (len <= ctx->nfclen)
+		return (0);
+	if ((buf = realloc(ctx->nfcbuf,
+	    NFC_DECOMP_MAX * len * sizeof *buf)) == NULL)
+		return (-1);
+	ctx->nfcbuf = buf;
+	if ((out = realloc(ctx->nfcout, 3 * len + 1)) == NULL)
+		return (-1);
+	ctx->nfcout = out;
+	ctx->nfclen = len;
+	return (0);
+}
+
+/*
+ * As cv_nfc(), but using the context's scratch space.  The input and
+ * output may overlap.
+ */
+size_t
+nfc_conv(cv_ctx *ctx, const char *str, size_t len, char *out, size_t size)
+{
+
+	if (nfc_reserve(ctx, len) != 0)
+		return ((size_t)-1);
+	return (nfc_normalize(str, len, out, size, ctx->nfcbuf));
+}
+
+/*
+ * As cv_isnfc(), but using the context's scratch space.
+ */
+int
+nfc_test(cv_ctx *ctx, const char *str, size_t len)
+{
+	size_t n;
+
+	switch (nfc_check((const unsigned char *)str, len)) {
+	case nfc_yes:
+		return (1);
+	case nfc_no:
+		return (0);
+	}
+	if (nfc_reserve(ctx, len) != 0)
+		return (1);
+	n = nfc_normalize(str, len, ctx->nfcout, 3 * len + 1, ctx->nfcbuf);
+	return (n == len && memcmp(ctx->nfcout, str, len) == 0);
+}
@@ -0,0 +1,2443 @@
+/* This file was generated by mknfctab.py from Unicode 14.0.0.  Do not edit. */
+
+#include <stddef.h>
+
+#include "cv-impl.h"
+
+const struct nfc_prop nfc_props[66] = {
+	{ 0, 0 }, { 230, 1 }, { 230, 0 }, { 232, 0 }, { 220, 0 }, { 216, 1 },
+	{ 202, 0 }, { 220, 1 }, { 202, 1 }, { 1, 0 }, { 1, 1 }, { 230, 2 },
+	{ 240, 1 }, { 233, 0 }, { 234, 0 }, { 0, 2 }, { 222, 0 }, { 228, 0 },
+	{ 10, 0 }, { 11, 0 }, { 12, 0 }, { 13, 0 }, { 14, 0 }, { 15, 0 },
+	{ 16, 0 }, { 17, 0 }, { 18, 0 }, { 19, 0 }, { 20, 0 }, { 21, 0 },
+	{ 22, 0 }, { 23, 0 }, { 24, 0 }, { 25, 0 }, { 30, 0 }, { 31, 0 },
+	{ 32, 0 }, { 27, 0 }, { 28, 0 }, { 29, 0 }, { 33, 0 }, { 34, 0 },
+	{ 35, 0 }, { 36, 0 }, { 7, 1 }, { 9, 0 }, { 7, 0 }, { 0, 1 },
+	{ 84, 0 }, { 91, 1 }, { 9, 1 }, { 103, 0 }, { 107, 0 }, { 118, 0 },
+	{ 122, 0 }, { 216, 0 }, { 129, 0 }, { 130, 0 }, { 132, 0 }, { 214, 0 },
+	{ 218, 0 }, { 224, 0 }, { 8, 1 }, { 26, 0 }, { 6, 0 }, { 226, 0 },
+};
+
+const uint8_t nfc_stage1[6144] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 5, 0, 0, 0,
+	0, 0, 0, 0, 6, 0, 0, 0, 0, 0, 0, 0, 7, 8, 9, 0,
+	10, 0, 11, 12, 0, 0, 13, 14, 15, 16, 17, 0, 0, 0, 0, 18,
+	19, 20, 21, 0, 22, 0, 23, 24, 0, 25, 26, 0, 0, 27, 28, 29,
+	0, 30, 31, 0, 0, 32, 33, 0, 0, 27, 34, 0, 0, 35, 36, 0,
+	0, 32, 37, 0, 0, 32, 38, 0, 0, 39, 36, 0, 0, 0, 40, 0,
+	0, 41, 42, 0, 0, 43, 44, 0, 45, 46, 47, 48, 49, 50, 51, 0,
+	0, 52, 0, 0, 53, 0, 0, 0, 0, 0, 0, 54, 0, 55, 56, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 57, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 58, 59, 0, 0, 0, 0, 60, 0,
+	0, 0, 0, 0, 0, 61, 0, 0, 0, 62, 0, 0, 0, 0, 0, 0,
+	63, 0, 0, 64, 0, 65, 66, 0, 0, 67, 68, 69, 0, 70, 0, 71,
+	0, 72, 0, 0, 0, 0, 73, 74, 0, 0, 0, 0, 0, 0, 75, 76,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 77, 0, 78, 79, 80,
+	81, 0, 0, 0, 0, 0, 82, 83, 0, 84, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 86, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 87, 0, 0, 0, 88, 0, 0, 0, 89,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 90, 0, 0, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 92, 93, 0, 0, 94, 0, 0, 0, 0, 0, 0, 0, 0,
+	95, 96, 0, 0, 0, 0, 68, 97, 0, 98, 99, 0, 0, 100, 101, 0,
+	0, 0, 0, 0, 0, 102, 103, 104, 0, 0, 0, 0, 0, 0, 0, 33,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 105, 105, 105, 105, 105, 105, 105, 105,
+	106, 107, 105, 108, 105, 105, 109, 0, 110, 111, 112, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 114,
+	0, 0, 0, 0, 0, 0, 0, 115, 0, 0, 0, 116, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	117, 118, 0, 0, 0, 0, 0, 119, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 120, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 121, 0, 0, 0, 0, 122, 0, 123, 0, 0, 0,
+	0, 0, 95, 124, 0, 125, 0, 0, 126, 127, 0, 100, 0, 0, 128, 0,
+	0, 129, 0, 0, 0, 0, 0, 130, 0, 131, 36, 132, 0, 0, 0, 0,
+	0, 0, 133, 0, 0, 134, 135, 0, 0, 0, 0, 0, 0, 136, 137, 0,
+	0, 88, 0, 0, 0, 138, 0, 0, 0, 139, 0, 0, 0, 0, 0, 0,
+	0, 140, 0, 0, 0, 0, 0, 0, 0, 141, 142, 0, 0, 0, 0, 101,
+	0, 59, 143, 0, 144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 88, 0, 0, 0, 0, 0, 0, 0, 0, 145, 0, 146, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 147, 0, 148, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 149,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 151, 152, 153, 154, 155, 0,
+	0, 0, 156, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	157, 158, 0, 0, 0, 0, 0, 0, 0, 148, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 159, 0, 160, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 161, 0, 0, 0, 162, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105, 105,
+	163, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+const uint8_t nfc_stage2[164][32] = {
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 2, 1,
+		2, 1, 2, 1, 1, 3, 4, 4, 4, 4, 3, 5, 4, 4, 4, 4,
+	},
+	{
+		4, 6, 6, 7, 7, 7, 7, 8, 8, 4, 4, 4, 4, 7, 7, 4,
+		7, 7, 4, 4, 9, 9, 9, 9, 10, 4, 4, 4, 4, 2, 2, 2,
+	},
+	{
+		11, 11, 1, 11, 11, 12, 2, 4, 4, 4, 2, 2, 2, 4, 4, 0,
+		2, 2, 2, 4, 4, 4, 4, 2, 3, 4, 4, 2, 13, 14, 14, 13,
+	},
+	{
+		14, 14, 13, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 4, 2, 2, 2, 2, 4, 2, 2, 2, 16, 4, 2, 2, 2, 2,
+	},
+	{
+		2, 2, 4, 4, 4, 4, 4, 4, 2, 2, 4, 2, 2, 16, 17, 2,
+		18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 27, 28, 29, 30, 0, 31,
+	},
+	{
+		0, 32, 33, 0, 2, 4, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 2, 2, 2, 2, 2, 2, 2, 34, 35, 36, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 37, 38, 39, 34, 35,
+		36, 40, 41, 1, 1, 7, 4, 2, 2, 2, 2, 2, 4, 2, 2, 4,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2,
+	},
+	{
+		2, 2, 2, 4, 2, 0, 0, 2, 2, 0, 4, 2, 2, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 43, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 4, 2, 2, 4, 2, 2, 4, 4, 4, 2, 4, 4, 2, 4, 2,
+	},
+	{
+		2, 2, 4, 2, 4, 2, 4, 2, 4, 2, 2, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2,
+		2, 2, 4, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2,
+	},
+	{
+		2, 2, 2, 2, 0, 2, 2, 2, 0, 2, 2, 2, 2, 2, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 4, 4, 2, 2, 2, 2,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 4,
+		4, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	},
+	{
+		2, 2, 0, 4, 2, 2, 4, 2, 2, 4, 2, 2, 2, 4, 4, 4,
+		37, 38, 39, 2, 2, 2, 4, 2, 2, 4, 4, 2, 2, 2, 2, 2,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 44, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+		0, 2, 4, 2, 2, 0, 0, 0, 15, 15, 15, 15, 15, 15, 15, 15,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 47, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 0, 15, 15, 0, 15,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 15, 0, 0, 15, 0, 0, 0, 0, 0, 46, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 15, 0, 0, 15, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+		0, 0, 0, 0, 0, 0, 47, 47, 0, 0, 0, 0, 15, 15, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+		0, 0, 0, 0, 0, 48, 49, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0,
+		0, 0, 0, 0, 0, 47, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 45, 0, 47, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 50, 0, 0, 0, 0, 47,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 51, 51, 45, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 52, 52, 52, 52, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 53, 53, 45, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 54, 54, 54, 54, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 4, 0, 4, 0, 55, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0,
+		0, 0, 15, 0, 0, 0, 0, 15, 0, 0, 0, 0, 15, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0,
+		0, 56, 57, 15, 58, 15, 15, 0, 15, 0, 57, 57, 57, 57, 0, 0,
+	},
+	{
+		57, 15, 2, 2, 45, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0,
+	},
+	{
+		0, 0, 15, 0, 0, 0, 0, 15, 0, 0, 0, 0, 15, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0,
+		0, 0, 0, 0, 0, 0, 0, 46, 0, 45, 45, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+		47, 47, 47, 47, 47, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 47, 47, 47, 47, 47, 47, 47, 47,
+		47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47, 47,
+	},
+	{
+		47, 47, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 45, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 17, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 2, 4, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 2, 4, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 4,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 2, 2, 2, 2, 4, 4, 4, 4, 4, 4, 2, 2, 4, 0, 4,
+	},
+	{
+		4, 2, 2, 4, 4, 2, 2, 2, 2, 2, 4, 2, 2, 2, 2, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 46, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 2, 2, 2,
+		2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 45, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 45, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 2, 2, 0, 9, 4, 4, 4, 4, 4, 2, 2, 4, 4, 4, 4,
+	},
+	{
+		2, 0, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 0, 4, 0, 0,
+		0, 0, 0, 0, 2, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		2, 2, 4, 2, 2, 2, 2, 2, 2, 2, 4, 2, 2, 14, 59, 4,
+		6, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	},
+	{
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 3, 17, 17, 4, 60, 2, 13, 4, 2, 4,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 15, 0, 15, 0, 15, 0, 15, 0, 15, 0, 15, 0, 15, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 15, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 15, 0, 0, 0, 0,
+		0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 15, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 15, 15,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 15, 0, 15, 0, 0,
+	},
+	{
+		15, 15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 2, 9, 9, 2, 2, 2, 2, 9, 9, 9, 2, 2, 0, 0, 0,
+	},
+	{
+		0, 2, 0, 0, 0, 9, 9, 2, 4, 2, 9, 9, 4, 4, 4, 4,
+		2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 15, 0, 0, 0, 15, 15, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+		2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45,
+	},
+	{
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 17, 3, 16, 61, 61,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 62, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2,
+		0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 0, 2, 2, 4, 0, 0, 2, 2, 0, 0, 0, 0, 0, 2, 2,
+	},
+	{
+		0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	},
+	{
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0,
+		15, 0, 15, 0, 0, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0,
+	},
+	{
+		15, 0, 15, 0, 0, 15, 15, 0, 0, 0, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	},
+	{
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+	},
+	{
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 63, 15,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 0, 15, 15, 15, 15, 15, 0, 15, 0,
+	},
+	{
+		15, 15, 0, 15, 15, 0, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		2, 2, 2, 2, 2, 2, 2, 4, 4, 4, 4, 4, 4, 4, 2, 2,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0,
+	},
+	{
+		4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 2,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 2, 9, 4, 0, 0, 0, 0, 45,
+	},
+	{
+		0, 0, 0, 0, 0, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 4, 4, 2, 2, 2, 4, 2, 4, 4, 4,
+		4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 2, 4, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 44, 0, 0, 0, 0, 0,
+	},
+	{
+		2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 45, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 45, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 45, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 46, 0, 47, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0,
+		2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 45, 0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47, 0, 0, 47, 0, 0,
+	},
+	{
+		0, 0, 45, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 47,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45,
+	},
+	{
+		46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 45, 46, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 46, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 45, 0,
+	},
+	{
+		0, 0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 46, 0, 45, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 45, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		9, 9, 9, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		64, 64, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15,
+	},
+	{
+		15, 15, 15, 15, 15, 55, 55, 9, 9, 9, 0, 0, 0, 65, 55, 55,
+		55, 55, 55, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+	},
+	{
+		4, 4, 4, 0, 0, 2, 2, 2, 2, 2, 4, 4, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 15, 15, 15, 15, 15,
+	},
+	{
+		15, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2,
+		2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2, 2, 2, 2, 2,
+	},
+	{
+		2, 2, 0, 2, 2, 0, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+		4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 46, 0, 0, 0, 0, 0,
+		0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	},
+	{
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15,
+		15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 0, 0,
+	},
+};
+
+const size_t nfc_ndecomp = 2061;
+
+const uint32_t nfc_decomp_cp[2061] = {
+	0x000c0, 0x000c1, 0x000c2, 0x000c3, 0x000c4, 0x000c5, 0x000c7, 0x000c8,
+	0x000c9, 0x000ca, 0x000cb, 0x000cc, 0x000cd, 0x000ce, 0x000cf, 0x000d1,
+	0x000d2, 0x000d3, 0x000d4, 0x000d5, 0x000d6, 0x000d9, 0x000da, 0x000db,
+	0x000dc, 0x000dd, 0x000e0, 0x000e1, 0x000e2, 0x000e3, 0x000e4, 0x000e5,
+	0x000e7, 0x000e8, 0x000e9, 0x000ea, 0x000eb, 0x000ec, 0x000ed, 0x000ee,
+	0x000ef, 0x000f1, 0x000f2, 0x000f3, 0x000f4, 0x000f5, 0x000f6, 0x000f9,
+	0x000fa, 0x000fb, 0x000fc, 0x000fd, 0x000ff, 0x00100, 0x00101, 0x00102,
+	0x00103, 0x00104, 0x00105, 0x00106, 0x00107, 0x00108, 0x00109, 0x0010a,
+	0x0010b, 0x0010c, 0x0010d, 0x0010e, 0x0010f, 0x00112, 0x00113, 0x00114,
+	0x00115, 0x00116, 0x00117, 0x00118, 0x00119, 0x0011a, 0x0011b, 0x0011c,
+	0x0011d, 0x0011e, 0x0011f, 0x00120, 0x00121, 0x00122, 0x00123, 0x00124,
+	0x00125, 0x00128, 0x00129, 0x0012a, 0x0012b, 0x0012c, 0x0012d, 0x0012e,
+	0x0012f, 0x00130, 0x00134, 0x00135, 0x00136, 0x00137, 0x00139, 0x0013a,
+	0x0013b, 0x0013c, 0x0013d, 0x0013e, 0x00143, 0x00144, 0x00145, 0x00146,
+	0x00147, 0x00148, 0x0014c, 0x0014d, 0x0014e, 0x0014f, 0x00150, 0x00151,
+	0x00154, 0x00155, 0x00156, 0x00157, 0x00158, 0x00159, 0x0015a, 0x0015b,
+	0x0015c, 0x0015d, 0x0015e, 0x0015f, 0x00160, 0x00161, 0x00162, 0x00163,
+	0x00164, 0x00165, 0x00168, 0x00169, 0x0016a, 0x0016b, 0x0016c, 0x0016d,
+	0x0016e, 0x0016f, 0x00170, 0x00171, 0x00172, 0x00173, 0x00174, 0x00175,
+	0x00176, 0x00177, 0x00178, 0x00179, 0x0017a, 0x0017b, 0x0017c, 0x0017d,
+	0x0017e, 0x001a0, 0x001a1, 0x001af, 0x001b0, 0x001cd, 0x001ce, 0x001cf,
+	0x001d0, 0x001d1, 0x001d2, 0x001d3, 0x001d4, 0x001d5, 0x001d6, 0x001d7,
+	0x001d8, 0x001d9, 0x001da, 0x001db, 0x001dc, 0x001de, 0x001df, 0x001e0,
+	0x001e1, 0x001e2, 0x001e3, 0x001e6, 0x001e7, 0x001e8, 0x001e9, 0x001ea,
+	0x001eb, 0x001ec, 0x001ed, 0x001ee, 0x001ef, 0x001f0, 0x001f4, 0x001f5,
+	0x001f8, 0x001f9, 0x001fa, 0x001fb, 0x001fc, 0x001fd, 0x001fe, 0x001ff,
+	0x00200, 0x00201, 0x00202, 0x00203, 0x00204, 0x00205, 0x00206, 0x00207,
+	0x00208, 0x00209, 0x0020a, 0x0020b, 0x0020c, 0x0020d, 0x0020e, 0x0020f,
+	0x00210, 0x00211, 0x00212, 0x00213, 0x00214, 0x00215, 0x00216, 0x00217,
+	0x00218, 0x00219, 0x0021a, 0x0021b, 0x0021e, 0x0021f, 0x00226, 0x00227,
+	0x00228, 0x00229, 0x0022a, 0x0022b, 0x0022c, 0x0022d, 0x0022e, 0x0022f,
+	0x00230, 0x00231, 0x00232, 0x00233, 0x00340, 0x00341, 0x00343, 0x00344,
+	0x00374, 0x0037e, 0x00385, 0x00386, 0x00387, 0x00388, 0x00389, 0x0038a,
+	0x0038c, 0x0038e, 0x0038f, 0x00390, 0x003aa, 0x003ab, 0x003ac, 0x003ad,
+	0x003ae, 0x003af, 0x003b0, 0x003ca, 0x003cb, 0x003cc, 0x003cd, 0x003ce,
+	0x003d3, 0x003d4, 0x00400, 0x00401, 0x00403, 0x00407, 0x0040c, 0x0040d,
+	0x0040e, 0x00419, 0x00439, 0x00450, 0x00451, 0x00453, 0x00457, 0x0045c,
+	0x0045d, 0x0045e, 0x00476, 0x00477, 0x004c1, 0x004c2, 0x004d0, 0x004d1,
+	0x004d2, 0x004d3, 0x004d6, 0x004d7, 0x004da, 0x004db, 0x004dc, 0x004dd,
+	0x004de, 0x004df, 0x004e2, 0x004e3, 0x004e4, 0x004e5, 0x004e6, 0x004e7,
+	0x004ea, 0x004eb, 0x004ec, 0x004ed, 0x004ee, 0x004ef, 0x004f0, 0x004f1,
+	0x004f2, 0x004f3, 0x004f4, 0x004f5, 0x004f8, 0x004f9, 0x00622, 0x00623,
+	0x00624, 0x00625, 0x00626, 0x006c0, 0x006c2, 0x006d3, 0x00929, 0x00931,
+	0x00934, 0x00958, 0x00959, 0x0095a, 0x0095b, 0x0095c, 0x0095d, 0x0095e,
+	0x0095f, 0x009cb, 0x009cc, 0x009dc, 0x009dd, 0x009df, 0x00a33, 0x00a36,
+	0x00a59, 0x00a5a, 0x00a5b, 0x00a5e, 0x00b48, 0x00b4b, 0x00b4c, 0x00b5c,
+	0x00b5d, 0x00b94, 0x00bca, 0x00bcb, 0x00bcc, 0x00c48, 0x00cc0, 0x00cc7,
+	0x00cc8, 0x00cca, 0x00ccb, 0x00d4a, 0x00d4b, 0x00d4c, 0x00dda, 0x00ddc,
+	0x00ddd, 0x00dde, 0x00f43, 0x00f4d, 0x00f52, 0x00f57, 0x00f5c, 0x00f69,
+	0x00f73, 0x00f75, 0x00f76, 0x00f78, 0x00f81, 0x00f93, 0x00f9d, 0x00fa2,
+	0x00fa7, 0x00fac, 0x00fb9, 0x01026, 0x01b06, 0x01b08, 0x01b0a, 0x01b0c,
+	0x01b0e, 0x01b12, 0x01b3b, 0x01b3d, 0x01b40, 0x01b41, 0x01b43, 0x01e00,
+	0x01e01, 0x01e02, 0x01e03, 0x01e04, 0x01e05, 0x01e06, 0x01e07, 0x01e08,
+	0x01e09, 0x01e0a, 0x01e0b, 0x01e0c, 0x01e0d, 0x01e0e, 0x01e0f, 0x01e10,
+	0x01e11, 0x01e12, 0x01e13, 0x01e14, 0x01e15, 0x01e16, 0x01e17, 0x01e18,
+	0x01e19, 0x01e1a, 0x01e1b, 0x01e1c, 0x01e1d, 0x01e1e, 0x01e1f, 0x01e20,
+	0x01e21, 0x01e22, 0x01e23, 0x01e24, 0x01e25, 0x01e26, 0x01e27, 0x01e28,
+	0x01e29, 0x01e2a, 0x01e2b, 0x01e2c, 0x01e2d, 0x01e2e, 0x01e2f, 0x01e30,
+	0x01e31, 0x01e32, 0x01e33, 0x01e34, 0x01e35, 0x01e36, 0x01e37, 0x01e38,
+	0x01e39, 0x01e3a, 0x01e3b, 0x01e3c, 0x01e3d, 0x01e3e, 0x01e3f, 0x01e40,
+	0x01e41, 0x01e42, 0x01e43, 0x01e44, 0x01e45, 0x01e46, 0x01e47, 0x01e48,
+	0x01e49, 0x01e4a, 0x01e4b, 0x01e4c, 0x01e4d, 0x01e4e, 0x01e4f, 0x01e50,
+	0x01e51, 0x01e52, 0x01e53, 0x01e54, 0x01e55, 0x01e56, 0x01e57, 0x01e58,
+	0x01e59, 0x01e5a, 0x01e5b, 0x01e5c, 0x01e5d, 0x01e5e, 0x01e5f, 0x01e60,
+	0x01e61, 0x01e62, 0x01e63, 0x01e64, 0x01e65, 0x01e66, 0x01e67, 0x01e68,
+	0x01e69, 0x01e6a, 0x01e6b, 0x01e6c, 0x01e6d, 0x01e6e, 0x01e6f, 0x01e70,
+	0x01e71, 0x01e72, 0x01e73, 0x01e74, 0x01e75, 0x01e76, 0x01e77, 0x01e78,
+	0x01e79, 0x01e7a, 0x01e7b, 0x01e7c, 0x01e7d, 0x01e7e, 0x01e7f, 0x01e80,
+	0x01e81, 0x01e82, 0x01e83, 0x01e84, 0x01e85, 0x01e86, 0x01e87, 0x01e88,
+	0x01e89, 0x01e8a, 0x01e8b, 0x01e8c, 0x01e8d, 0x01e8e, 0x01e8f, 0x01e90,
+	0x01e91, 0x01e92, 0x01e93, 0x01e94, 0x01e95, 0x01e96, 0x01e97, 0x01e98,
+	0x01e99, 0x01e9b, 0x01ea0, 0x01ea1, 0x01ea2, 0x01ea3, 0x01ea4, 0x01ea5,
+	0x01ea6, 0x01ea7, 0x01ea8, 0x01ea9, 0x01eaa, 0x01eab, 0x01eac, 0x01ead,
+	0x01eae, 0x01eaf, 0x01eb0, 0x01eb1, 0x01eb2, 0x01eb3, 0x01eb4, 0x01eb5,
+	0x01eb6, 0x01eb7, 0x01eb8, 0x01eb9, 0x01eba, 0x01ebb, 0x01ebc, 0x01ebd,
+	0x01ebe, 0x01ebf, 0x01ec0, 0x01ec1, 0x01ec2, 0x01ec3, 0x01ec4, 0x01ec5,
+	0x01ec6, 0x01ec7, 0x01ec8, 0x01ec9, 0x01eca, 0x01ecb, 0x01ecc, 0x01ecd,
+	0x01ece, 0x01ecf, 0x01ed0, 0x01ed1, 0x01ed2, 0x01ed3, 0x01ed4, 0x01ed5,
+	0x01ed6, 0x01ed7, 0x01ed8, 0x01ed9, 0x01eda, 0x01edb, 0x01edc, 0x01edd,
+	0x01ede, 0x01edf, 0x01ee0, 0x01ee1, 0x01ee2, 0x01ee3, 0x01ee4, 0x01ee5,
+	0x01ee6, 0x01ee7, 0x01ee8, 0x01ee9, 0x01eea, 0x01eeb, 0x01eec, 0x01eed,
+	0x01eee, 0x01eef, 0x01ef0, 0x01ef1, 0x01ef2, 0x01ef3, 0x01ef4, 0x01ef5,
+	0x01ef6, 0x01ef7, 0x01ef8, 0x01ef9, 0x01f00, 0x01f01, 0x01f02, 0x01f03,
+	0x01f04, 0x01f05, 0x01f06, 0x01f07, 0x01f08, 0x01f09, 0x01f0a, 0x01f0b,
+	0x01f0c, 0x01f0d, 0x01f0e, 0x01f0f, 0x01f10, 0x01f11, 0x01f12, 0x01f13,
+	0x01f14, 0x01f15, 0x01f18, 0x01f19, 0x01f1a, 0x01f1b, 0x01f1c, 0x01f1d,
+	0x01f20, 0x01f21, 0x01f22, 0x01f23, 0x01f24, 0x01f25, 0x01f26, 0x01f27,
+	0x01f28, 0x01f29, 0x01f2a, 0x01f2b, 0x01f2c, 0x01f2d, 0x01f2e, 0x01f2f,
+	0x01f30, 0x01f31, 0x01f32, 0x01f33, 0x01f34, 0x01f35, 0x01f36, 0x01f37,
+	0x01f38, 0x01f39, 0x01f3a, 0x01f3b, 0x01f3c, 0x01f3d, 0x01f3e, 0x01f3f,
+	0x01f40, 0x01f41, 0x01f42, 0x01f43, 0x01f44, 0x01f45, 0x01f48, 0x01f49,
+	0x01f4a, 0x01f4b, 0x01f4c, 0x01f4d, 0x01f50, 0x01f51, 0x01f52, 0x01f53,
+	0x01f54, 0x01f55, 0x01f56, 0x01f57, 0x01f59, 0x01f5b, 0x01f5d, 0x01f5f,
+	0x01f60, 0x01f61, 0x01f62, 0x01f63, 0x01f64, 0x01f65, 0x01f66, 0x01f67,
+	0x01f68, 0x01f69, 0x01f6a, 0x01f6b, 0x01f6c, 0x01f6d, 0x01f6e, 0x01f6f,
+	0x01f70, 0x01f71, 0x01f72, 0x01f73, 0x01f74, 0x01f75, 0x01f76, 0x01f77,
+	0x01f78, 0x01f79, 0x01f7a, 0x01f7b, 0x01f7c, 0x01f7d, 0x01f80, 0x01f81,
+	0x01f82, 0x01f83, 0x01f84, 0x01f85, 0x01f86, 0x01f87, 0x01f88, 0x01f89,
+	0x01f8a, 0x01f8b, 0x01f8c, 0x01f8d, 0x01f8e, 0x01f8f, 0x01f90, 0x01f91,
+	0x01f92, 0x01f93, 0x01f94, 0x01f95, 0x01f96, 0x01f97, 0x01f98, 0x01f99,
+	0x01f9a, 0x01f9b, 0x01f9c, 0x01f9d, 0x01f9e, 0x01f9f, 0x01fa0, 0x01fa1,
+	0x01fa2, 0x01fa3, 0x01fa4, 0x01fa5, 0x01fa6, 0x01fa7, 0x01fa8, 0x01fa9,
+	0x01faa, 0x01fab, 0x01fac, 0x01fad, 0x01fae, 0x01faf, 0x01fb0, 0x01fb1,
+	0x01fb2, 0x01fb3, 0x01fb4, 0x01fb6, 0x01fb7, 0x01fb8, 0x01fb9, 0x01fba,
+	0x01fbb, 0x01fbc, 0x01fbe, 0x01fc1, 0x01fc2, 0x01fc3, 0x01fc4, 0x01fc6,
+	0x01fc7, 0x01fc8, 0x01fc9, 0x01fca, 0x01fcb, 0x01fcc, 0x01fcd, 0x01fce,
+	0x01fcf, 0x01fd0, 0x01fd1, 0x01fd2, 0x01fd3, 0x01fd6, 0x01fd7, 0x01fd8,
+	0x01fd9, 0x01fda, 0x01fdb, 0x01fdd, 0x01fde, 0x01fdf, 0x01fe0, 0x01fe1,
+	0x01fe2, 0x01fe3, 0x01fe4, 0x01fe5, 0x01fe6, 0x01fe7, 0x01fe8, 0x01fe9,
+	0x01fea, 0x01feb, 0x01fec, 0x01fed, 0x01fee, 0x01fef, 0x01ff2, 0x01ff3,
+	0x01ff4, 0x01ff6, 0x01ff7, 0x01ff8, 0x01ff9, 0x01ffa, 0x01ffb, 0x01ffc,
+	0x01ffd, 0x02000, 0x02001, 0x02126, 0x0212a, 0x0212b, 0x0219a, 0x0219b,
+	0x021ae, 0x021cd, 0x021ce, 0x021cf, 0x02204, 0x02209, 0x0220c, 0x02224,
+	0x02226, 0x02241, 0x02244, 0x02247, 0x02249, 0x02260, 0x02262, 0x0226d,
+	0x0226e, 0x0226f, 0x02270, 0x02271, 0x02274, 0x02275, 0x02278, 0x02279,
+	0x02280, 0x02281, 0x02284, 0x02285, 0x02288, 0x02289, 0x022ac, 0x022ad,
+	0x022ae, 0x022af, 0x022e0, 0x022e1, 0x022e2, 0x022e3, 0x022ea, 0x022eb,
+	0x022ec, 0x022ed, 0x02329, 0x0232a, 0x02adc, 0x0304c, 0x0304e, 0x03050,
+	0x03052, 0x03054, 0x03056, 0x03058, 0x0305a, 0x0305c, 0x0305e, 0x03060,
+	0x03062, 0x03065, 0x03067, 0x03069, 0x03070, 0x03071, 0x03073, 0x03074,
+	0x03076, 0x03077, 0x03079, 0x0307a, 0x0307c, 0x0307d, 0x03094, 0x0309e,
+	0x030ac, 0x030ae, 0x030b0, 0x030b2, 0x030b4, 0x030b6, 0x030b8, 0x030ba,
+	0x030bc, 0x030be, 0x030c0, 0x030c2, 0x030c5, 0x030c7, 0x030c9, 0x030d0,
+	0x030d1, 0x030d3, 0x030d4, 0x030d6, 0x030d7, 0x030d9, 0x030da, 0x030dc,
+	0x030dd, 0x030f4, 0x030f7, 0x030f8, 0x030f9, 0x030fa, 0x030fe, 0x0f900,
+	0x0f901, 0x0f902, 0x0f903, 0x0f904, 0x0f905, 0x0f906, 0x0f907, 0x0f908,
+	0x0f909, 0x0f90a, 0x0f90b, 0x0f90c, 0x0f90d, 0x0f90e, 0x0f90f, 0x0f910,
+	0x0f911, 0x0f912, 0x0f913, 0x0f914, 0x0f915, 0x0f916, 0x0f917, 0x0f918,
+	0x0f919, 0x0f91a, 0x0f91b, 0x0f91c, 0x0f91d, 0x0f91e, 0x0f91f, 0x0f920,
+	0x0f921, 0x0f922, 0x0f923, 0x0f924, 0x0f925, 0x0f926, 0x0f927, 0x0f928,
+	0x0f929, 0x0f92a, 0x0f92b, 0x0f92c, 0x0f92d, 0x0f92e, 0x0f92f, 0x0f930,
+	0x0f931, 0x0f932, 0x0f933, 0x0f934, 0x0f935, 0x0f936, 0x0f937, 0x0f938,
+	0x0f939, 0x0f93a, 0x0f93b, 0x0f93c, 0x0f93d, 0x0f93e, 0x0f93f, 0x0f940,
+	0x0f941, 0x0f942, 0x0f943, 0x0f944, 0x0f945, 0x0f946, 0x0f947, 0x0f948,
+	0x0f949, 0x0f94a, 0x0f94b, 0x0f94c, 0x0f94d, 0x0f94e, 0x0f94f, 0x0f950,
+	0x0f951, 0x0f952, 0x0f953, 0x0f954, 0x0f955, 0x0f956, 0x0f957, 0x0f958,
+	0x0f959, 0x0f95a, 0x0f95b, 0x0f95c, 0x0f95d, 0x0f95e, 0x0f95f, 0x0f960,
+	0x0f961, 0x0f962, 0x0f963, 0x0f964, 0x0f965, 0x0f966, 0x0f967, 0x0f968,
+	0x0f969, 0x0f96a, 0x0f96b, 0x0f96c, 0x0f96d, 0x0f96e, 0x0f96f, 0x0f970,
+	0x0f971, 0x0f972, 0x0f973, 0x0f974, 0x0f975, 0x0f976, 0x0f977, 0x0f978,
+	0x0f979, 0x0f97a, 0x0f97b, 0x0f97c, 0x0f97d, 0x0f97e, 0x0f97f, 0x0f980,
+	0x0f981, 0x0f982, 0x0f983, 0x0f984, 0x0f985, 0x0f986, 0x0f987, 0x0f988,
+	0x0f989, 0x0f98a, 0x0f98b, 0x0f98c, 0x0f98d, 0x0f98e, 0x0f98f, 0x0f990,
+	0x0f991, 0x0f992, 0x0f993, 0x0f994, 0x0f995, 0x0f996, 0x0f997, 0x0f998,
+	0x0f999, 0x0f99a, 0x0f99b, 0x0f99c, 0x0f99d, 0x0f99e, 0x0f99f, 0x0f9a0,
+	0x0f9a1, 0x0f9a2, 0x0f9a3, 0x0f9a4, 0x0f9a5, 0x0f9a6, 0x0f9a7, 0x0f9a8,
+	0x0f9a9, 0x0f9aa, 0x0f9ab, 0x0f9ac, 0x0f9ad, 0x0f9ae, 0x0f9af, 0x0f9b0,
+	0x0f9b1, 0x0f9b2, 0x0f9b3, 0x0f9b4, 0x0f9b5, 0x0f9b6, 0x0f9b7, 0x0f9b8,
+	0x0f9b9, 0x0f9ba, 0x0f9bb, 0x0f9bc, 0x0f9bd, 0x0f9be, 0x0f9bf, 0x0f9c0,
+	0x0f9c1, 0x0f9c2, 0x0f9c3, 0x0f9c4, 0x0f9c5, 0x0f9c6, 0x0f9c7, 0x0f9c8,
+	0x0f9c9, 0x0f9ca, 0x0f9cb, 0x0f9cc, 0x0f9cd, 0x0f9ce, 0x0f9cf, 0x0f9d0,
+	0x0f9d1, 0x0f9d2, 0x0f9d3, 0x0f9d4, 0x0f9d5, 0x0f9d6, 0x0f9d7, 0x0f9d8,
+	0x0f9d9, 0x0f9da, 0x0f9db, 0x0f9dc, 0x0f9dd, 0x0f9de, 0x0f9df, 0x0f9e0,
+	0x0f9e1, 0x0f9e2, 0x0f9e3, 0x0f9e4, 0x0f9e5, 0x0f9e6, 0x0f9e7, 0x0f9e8,
+	0x0f9e9, 0x0f9ea, 0x0f9eb, 0x0f9ec, 0x0f9ed, 0x0f9ee, 0x0f9ef, 0x0f9f0,
+	0x0f9f1, 0x0f9f2, 0x0f9f3, 0x0f9f4, 0x0f9f5, 0x0f9f6, 0x0f9f7, 0x0f9f8,
+	0x0f9f9, 0x0f9fa, 0x0f9fb, 0x0f9fc, 0x0f9fd, 0x0f9fe, 0x0f9ff, 0x0fa00,
+	0x0fa01, 0x0fa02, 0x0fa03, 0x0fa04, 0x0fa05, 0x0fa06, 0x0fa07, 0x0fa08,
+	0x0fa09, 0x0fa0a, 0x0fa0b, 0x0fa0c, 0x0fa0d, 0x0fa10, 0x0fa12, 0x0fa15,
+	0x0fa16, 0x0fa17, 0x0fa18, 0x0fa19, 0x0fa1a, 0x0fa1b, 0x0fa1c, 0x0fa1d,
+	0x0fa1e, 0x0fa20, 0x0fa22, 0x0fa25, 0x0fa26, 0x0fa2a, 0x0fa2b, 0x0fa2c,
+	0x0fa2d, 0x0fa2e, 0x0fa2f, 0x0fa30, 0x0fa31, 0x0fa32, 0x0fa33, 0x0fa34,
+	0x0fa35, 0x0fa36, 0x0fa37, 0x0fa38, 0x0fa39, 0x0fa3a, 0x0fa3b, 0x0fa3c,
+	0x0fa3d, 0x0fa3e, 0x0fa3f, 0x0fa40, 0x0fa41, 0x0fa42, 0x0fa43, 0x0fa44,
+	0x0fa45, 0x0fa46, 0x0fa47, 0x0fa48, 0x0fa49, 0x0fa4a, 0x0fa4b, 0x0fa4c,
+	0x0fa4d, 0x0fa4e, 0x0fa4f, 0x0fa50, 0x0fa51, 0x0fa52, 0x0fa53, 0x0fa54,
+	0x0fa55, 0x0fa56, 0x0fa57, 0x0fa58, 0x0fa59, 0x0fa5a, 0x0fa5b, 0x0fa5c,
+	0x0fa5d, 0x0fa5e, 0x0fa5f, 0x0fa60, 0x0fa61, 0x0fa62, 0x0fa63, 0x0fa64,
+	0x0fa65, 0x0fa66, 0x0fa67, 0x0fa68, 0x0fa69, 0x0fa6a, 0x0fa6b, 0x0fa6c,
+	0x0fa6d, 0x0fa70, 0x0fa71, 0x0fa72, 0x0fa73, 0x0fa74, 0x0fa75, 0x0fa76,
+	0x0fa77, 0x0fa78, 0x0fa79, 0x0fa7a, 0x0fa7b, 0x0fa7c, 0x0fa7d, 0x0fa7e,
+	0x0fa7f, 0x0fa80, 0x0fa81, 0x0fa82, 0x0fa83, 0x0fa84, 0x0fa85, 0x0fa86,
+	0x0fa87, 0x0fa88, 0x0fa89, 0x0fa8a, 0x0fa8b, 0x0fa8c, 0x0fa8d, 0x0fa8e,
+	0x0fa8f, 0x0fa90, 0x0fa91, 0x0fa92, 0x0fa93, 0x0fa94, 0x0fa95, 0x0fa96,
+	0x0fa97, 0x0fa98, 0x0fa99, 0x0fa9a, 0x0fa9b, 0x0fa9c, 0x0fa9d, 0x0fa9e,
+	0x0fa9f, 0x0faa0, 0x0faa1, 0x0faa2, 0x0faa3, 0x0faa4, 0x0faa5, 0x0faa6,
+	0x0faa7, 0x0faa8, 0x0faa9, 0x0faaa, 0x0faab, 0x0faac, 0x0faad, 0x0faae,
+	0x0faaf, 0x0fab0, 0x0fab1, 0x0fab2, 0x0fab3, 0x0fab4, 0x0fab5, 0x0fab6,
+	0x0fab7, 0x0fab8, 0x0fab9, 0x0faba, 0x0fabb, 0x0fabc, 0x0fabd, 0x0fabe,
+	0x0fabf, 0x0fac0, 0x0fac1, 0x0fac2, 0x0fac3, 0x0fac4, 0x0fac5, 0x0fac6,
+	0x0fac7, 0x0fac8, 0x0fac9, 0x0faca, 0x0facb, 0x0facc, 0x0facd, 0x0face,
+	0x0facf, 0x0fad0, 0x0fad1, 0x0fad2, 0x0fad3, 0x0fad4, 0x0fad5, 0x0fad6,
+	0x0fad7, 0x0fad8, 0x0fad9, 0x0fb1d, 0x0fb1f, 0x0fb2a, 0x0fb2b, 0x0fb2c,
+	0x0fb2d, 0x0fb2e, 0x0fb2f, 0x0fb30, 0x0fb31, 0x0fb32, 0x0fb33, 0x0fb34,
+	0x0fb35, 0x0fb36, 0x0fb38, 0x0fb39, 0x0fb3a, 0x0fb3b, 0x0fb3c, 0x0fb3e,
+	0x0fb40, 0x0fb41, 0x0fb43, 0x0fb44, 0x0fb46, 0x0fb47, 0x0fb48, 0x0fb49,
+	0x0fb4a, 0x0fb4b, 0x0fb4c, 0x0fb4d, 0x0fb4e, 0x1109a, 0x1109c, 0x110ab,
+	0x1112e, 0x1112f, 0x1134b, 0x1134c, 0x114bb, 0x114bc, 0x114be, 0x115ba,
+	0x115bb, 0x11938, 0x1d15e, 0x1d15f, 0x1d160, 0x1d161, 0x1d162, 0x1d163,
+	0x1d164, 0x1d1bb, 0x1d1bc, 0x1d1bd, 0x1d1be, 0x1d1bf, 0x1d1c0, 0x2f800,
+	0x2f801, 0x2f802, 0x2f803, 0x2f804, 0x2f805, 0x2f806, 0x2f807, 0x2f808,
+	0x2f809, 0x2f80a, 0x2f80b, 0x2f80c, 0x2f80d, 0x2f80e, 0x2f80f, 0x2f810,
+	0x2f811, 0x2f812, 0x2f813, 0x2f814, 0x2f815, 0x2f816, 0x2f817, 0x2f818,
+	0x2f819, 0x2f81a, 0x2f81b, 0x2f81c, 0x2f81d, 0x2f81e, 0x2f81f, 0x2f820,
+	0x2f821, 0x2f822, 0x2f823, 0x2f824, 0x2f825, 0x2f826, 0x2f827, 0x2f828,
+	0x2f829, 0x2f82a, 0x2f82b, 0x2f82c, 0x2f82d, 0x2f82e, 0x2f82f, 0x2f830,
+	0x2f831, 0x2f832, 0x2f833, 0x2f834, 0x2f835, 0x2f836, 0x2f837, 0x2f838,
+	0x2f839, 0x2f83a, 0x2f83b, 0x2f83c, 0x2f83d, 0x2f83e, 0x2f83f, 0x2f840,
+	0x2f841, 0x2f842, 0x2f843, 0x2f844, 0x2f845, 0x2f846, 0x2f847, 0x2f848,
+	0x2f849, 0x2f84a, 0x2f84b, 0x2f84c, 0x2f84d, 0x2f84e, 0x2f84f, 0x2f850,
+	0x2f851, 0x2f852, 0x2f853, 0x2f854, 0x2f855, 0x2f856, 0x2f857, 0x2f858,
+	0x2f859, 0x2f85a, 0x2f85b, 0x2f85c, 0x2f85d, 0x2f85e, 0x2f85f, 0x2f860,
+	0x2f861, 0x2f862, 0x2f863, 0x2f864, 0x2f865, 0x2f866, 0x2f867, 0x2f868,
+	0x2f869, 0x2f86a, 0x2f86b, 0x2f86c, 0x2f86d, 0x2f86e, 0x2f86f, 0x2f870,
+	0x2f871, 0x2f872, 0x2f873, 0x2f874, 0x2f875, 0x2f876, 0x2f877, 0x2f878,
+	0x2f879, 0x2f87a, 0x2f87b, 0x2f87c, 0x2f87d, 0x2f87e, 0x2f87f, 0x2f880,
+	0x2f881, 0x2f882, 0x2f883, 0x2f884, 0x2f885, 0x2f886, 0x2f887, 0x2f888,
+	0x2f889, 0x2f88a, 0x2f88b, 0x2f88c, 0x2f88d, 0x2f88e, 0x2f88f, 0x2f890,
+	0x2f891, 0x2f892, 0x2f893, 0x2f894, 0x2f895, 0x2f896, 0x2f897, 0x2f898,
+	0x2f899, 0x2f89a, 0x2f89b, 0x2f89c, 0x2f89d, 0x2f89e, 0x2f89f, 0x2f8a0,
+	0x2f8a1, 0x2f8a2, 0x2f8a3, 0x2f8a4, 0x2f8a5, 0x2f8a6, 0x2f8a7, 0x2f8a8,
+	0x2f8a9, 0x2f8aa, 0x2f8ab, 0x2f8ac, 0x2f8ad, 0x2f8ae, 0x2f8af, 0x2f8b0,
+	0x2f8b1, 0x2f8b2, 0x2f8b3, 0x2f8b4, 0x2f8b5, 0x2f8b6, 0x2f8b7, 0x2f8b8,
+	0x2f8b9, 0x2f8ba, 0x2f8bb, 0x2f8bc, 0x2f8bd, 0x2f8be, 0x2f8bf, 0x2f8c0,
+	0x2f8c1, 0x2f8c2, 0x2f8c3, 0x2f8c4, 0x2f8c5, 0x2f8c6, 0x2f8c7, 0x2f8c8,
+	0x2f8c9, 0x2f8ca, 0x2f8cb, 0x2f8cc, 0x2f8cd, 0x2f8ce, 0x2f8cf, 0x2f8d0,
+	0x2f8d1, 0x2f8d2, 0x2f8d3, 0x2f8d4, 0x2f8d5, 0x2f8d6, 0x2f8d7, 0x2f8d8,
+	0x2f8d9, 0x2f8da, 0x2f8db, 0x2f8dc, 0x2f8dd, 0x2f8de, 0x2f8df, 0x2f8e0,
+	0x2f8e1, 0x2f8e2, 0x2f8e3, 0x2f8e4, 0x2f8e5, 0x2f8e6, 0x2f8e7, 0x2f8e8,
+	0x2f8e9, 0x2f8ea, 0x2f8eb, 0x2f8ec, 0x2f8ed, 0x2f8ee, 0x2f8ef, 0x2f8f0,
+	0x2f8f1, 0x2f8f2, 0x2f8f3, 0x2f8f4, 0x2f8f5, 0x2f8f6, 0x2f8f7, 0x2f8f8,
+	0x2f8f9, 0x2f8fa, 0x2f8fb, 0x2f8fc, 0x2f8fd, 0x2f8fe, 0x2f8ff, 0x2f900,
+	0x2f901, 0x2f902, 0x2f903, 0x2f904, 0x2f905, 0x2f906, 0x2f907, 0x2f908,
+	0x2f909, 0x2f90a, 0x2f90b, 0x2f90c, 0x2f90d, 0x2f90e, 0x2f90f, 0x2f910,
+	0x2f911, 0x2f912, 0x2f913, 0x2f914, 0x2f915, 0x2f916, 0x2f917, 0x2f918,
+	0x2f919, 0x2f91a, 0x2f91b, 0x2f91c, 0x2f91d, 0x2f91e, 0x2f91f, 0x2f920,
+	0x2f921, 0x2f922, 0x2f923, 0x2f924, 0x2f925, 0x2f926, 0x2f927, 0x2f928,
+	0x2f929, 0x2f92a, 0x2f92b, 0x2f92c, 0x2f92d, 0x2f92e, 0x2f92f, 0x2f930,
+	0x2f931, 0x2f932, 0x2f933, 0x2f934, 0x2f935, 0x2f936, 0x2f937, 0x2f938,
+	0x2f939, 0x2f93a, 0x2f93b, 0x2f93c, 0x2f93d, 0x2f93e, 0x2f93f, 0x2f940,
+	0x2f941, 0x2f942, 0x2f943, 0x2f944, 0x2f945, 0x2f946, 0x2f947, 0x2f948,
+	0x2f949, 0x2f94a, 0x2f94b, 0x2f94c, 0x2f94d, 0x2f94e, 0x2f94f, 0x2f950,
+	0x2f951, 0x2f952, 0x2f953, 0x2f954, 0x2f955, 0x2f956, 0x2f957, 0x2f958,
+	0x2f959, 0x2f95a, 0x2f95b, 0x2f95c, 0x2f95d, 0x2f95e, 0x2f95f, 0x2f960,
+	0x2f961, 0x2f962, 0x2f963, 0x2f964, 0x2f965, 0x2f966, 0x2f967, 0x2f968,
+	0x2f969, 0x2f96a, 0x2f96b, 0x2f96c, 0x2f96d, 0x2f96e, 0x2f96f, 0x2f970,
+	0x2f971, 0x2f972, 0x2f973, 0x2f974, 0x2f975, 0x2f976, 0x2f977, 0x2f978,
+	0x2f979, 0x2f97a, 0x2f97b, 0x2f97c, 0x2f97d, 0x2f97e, 0x2f97f, 0x2f980,
+	0x2f981, 0x2f982, 0x2f983, 0x2f984, 0x2f985, 0x2f986, 0x2f987, 0x2f988,
+	0x2f989, 0x2f98a, 0x2f98b, 0x2f98c, 0x2f98d, 0x2f98e, 0x2f98f, 0x2f990,
+	0x2f991, 0x2f992, 0x2f993, 0x2f994, 0x2f995, 0x2f996, 0x2f997, 0x2f998,
+	0x2f999, 0x2f99a, 0x2f99b, 0x2f99c, 0x2f99d, 0x2f99e, 0x2f99f, 0x2f9a0,
+	0x2f9a1, 0x2f9a2, 0x2f9a3, 0x2f9a4, 0x2f9a5, 0x2f9a6, 0x2f9a7, 0x2f9a8,
+	0x2f9a9, 0x2f9aa, 0x2f9ab, 0x2f9ac, 0x2f9ad, 0x2f9ae, 0x2f9af, 0x2f9b0,
+	0x2f9b1, 0x2f9b2, 0x2f9b3, 0x2f9b4, 0x2f9b5, 0x2f9b6, 0x2f9b7, 0x2f9b8,
+	0x2f9b9, 0x2f9ba, 0x2f9bb, 0x2f9bc, 0x2f9bd, 0x2f9be, 0x2f9bf, 0x2f9c0,
+	0x2f9c1, 0x2f9c2, 0x2f9c3, 0x2f9c4, 0x2f9c5, 0x2f9c6, 0x2f9c7, 0x2f9c8,
+	0x2f9c9, 0x2f9ca, 0x2f9cb, 0x2f9cc, 0x2f9cd, 0x2f9ce, 0x2f9cf, 0x2f9d0,
+	0x2f9d1, 0x2f9d2, 0x2f9d3, 0x2f9d4, 0x2f9d5, 0x2f9d6, 0x2f9d7, 0x2f9d8,
+	0x2f9d9, 0x2f9da, 0x2f9db, 0x2f9dc, 0x2f9dd, 0x2f9de, 0x2f9df, 0x2f9e0,
+	0x2f9e1, 0x2f9e2, 0x2f9e3, 0x2f9e4, 0x2f9e5, 0x2f9e6, 0x2f9e7, 0x2f9e8,
+	0x2f9e9, 0x2f9ea, 0x2f9eb, 0x2f9ec, 0x2f9ed, 0x2f9ee, 0x2f9ef, 0x2f9f0,
+	0x2f9f1, 0x2f9f2, 0x2f9f3, 0x2f9f4, 0x2f9f5, 0x2f9f6, 0x2f9f7, 0x2f9f8,
+	0x2f9f9, 0x2f9fa, 0x2f9fb, 0x2f9fc, 0x2f9fd, 0x2f9fe, 0x2f9ff, 0x2fa00,
+	0x2fa01, 0x2fa02, 0x2fa03, 0x2fa04, 0x2fa05, 0x2fa06, 0x2fa07, 0x2fa08,
+	0x2fa09, 0x2fa0a, 0x2fa0b, 0x2fa0c, 0x2fa0d, 0x2fa0e, 0x2fa0f, 0x2fa10,
+	0x2fa11, 0x2fa12, 0x2fa13, 0x2fa14, 0x2fa15, 0x2fa16, 0x2fa17, 0x2fa18,
+	0x2fa19, 0x2fa1a, 0x2fa1b, 0x2fa1c, 0x2fa1d,
+};
+
+const uint16_t nfc_decomp_idx[2062] = {
+	0, 2, 4, 6, 8, 10, 12, 14, 16, 18,
+	20, 22, 24, 26, 28, 30, 32, 34, 36, 38,
+	40, 42, 44, 46, 48, 50, 52, 54, 56, 58,
+	60, 62, 64, 66, 68, 70, 72, 74, 76, 78,
+	80, 82, 84, 86, 88, 90, 92, 94, 96, 98,
+	100, 102, 104, 106, 108, 110, 112, 114, 116, 118,
+	120, 122, 124, 126, 128, 130, 132, 134, 136, 138,
+	140, 142, 144, 146, 148, 150, 152, 154, 156, 158,
+	160, 162, 164, 166, 168, 170, 172, 174, 176, 178,
+	180, 182, 184, 186, 188, 190, 192, 194, 196, 198,
+	200, 202, 204, 206, 208, 210, 212, 214, 216, 218,
+	220, 222, 224, 226, 228, 230, 232, 234, 236, 238,
+	240, 242, 244, 246, 248, 250, 252, 254, 256, 258,
+	260, 262, 264, 266, 268, 270, 272, 274, 276, 278,
+	280, 282, 284, 286, 288, 290, 292, 294, 296, 298,
+	300, 302, 304, 306, 308, 310, 312, 314, 316, 318,
+	320, 322, 324, 326, 328, 330, 332, 334, 336, 338,
+	340, 342, 344, 346, 349, 352, 355, 358, 361, 364,
+	367, 370, 373, 376, 379, 382, 384, 386, 388, 390,
+	392, 394, 396, 398, 401, 404, 406, 408, 410, 412,
+	414, 416, 418, 421, 424, 426, 428, 430, 432, 434,
+	436, 438, 440, 442, 444, 446, 448, 450, 452, 454,
+	456, 458, 460, 462, 464, 466, 468, 470, 472, 474,
+	476, 478, 480, 482, 484, 486, 488, 490, 492, 494,
+	496, 498, 500, 503, 506, 509, 512, 514, 516, 519,
+	522, 524, 526, 527, 528, 529, 531, 532, 533, 535,
+	537, 538, 540, 542, 544, 546, 548, 550, 553, 555,
+	557, 559, 561, 563, 565, 568, 570, 572, 574, 576,
+	578, 580, 582, 584, 586, 588, 590, 592, 594, 596,
+	598, 600, 602, 604, 606, 608, 610, 612, 614, 616,
+	618, 620, 622, 624, 626, 628, 630, 632, 634, 636,
+	638, 640, 642, 644, 646, 648, 650, 652, 654, 656,
+	658, 660, 662, 664, 666, 668, 670, 672, 674, 676,
+	678, 680, 682, 684, 686, 688, 690, 692, 694, 696,
+	698, 700, 702, 704, 706, 708, 710, 712, 714, 716,
+	718, 720, 722, 724, 726, 728, 730, 732, 734, 736,
+	738, 740, 742, 744, 746, 748, 750, 752, 754, 756,
+	758, 760, 762, 764, 766, 768, 770, 772, 774, 777,
+	779, 781, 783, 785, 787, 790, 792, 794, 796, 798,
+	800, 802, 804, 806, 808, 810, 812, 814, 816, 818,
+	820, 822, 824, 826, 828, 830, 832, 834, 836, 838,
+	840, 842, 844, 846, 848, 850, 852, 854, 856, 858,
+	860, 862, 864, 866, 869, 872, 874, 876, 878, 880,
+	882, 884, 886, 888, 890, 892, 895, 898, 901, 904,
+	906, 908, 910, 912, 915, 918, 920, 922, 924, 926,
+	928, 930, 932, 934, 936, 938, 940, 942, 944, 946,
+	948, 950, 953, 956, 958, 960, 962, 964, 966, 968,
+	970, 972, 975, 978, 980, 982, 984, 986, 988, 990,
+	992, 994, 996, 998, 1000, 1002, 1004, 1006, 1008, 1010,
+	1012, 1014, 1017, 1020, 1023, 1026, 1029, 1032, 1035, 1038,
+	1040, 1042, 1044, 1046, 1048, 1050, 1052, 1054, 1057, 1060,
+	1062, 1064, 1066, 1068, 1070, 1072, 1075, 1078, 1081, 1084,
+	1087, 1090, 1092, 1094, 1096, 1098, 1100, 1102, 1104, 1106,
+	1108, 1110, 1112, 1114, 1116, 1118, 1121, 1124, 1127, 1130,
+	1132, 1134, 1136, 1138, 1140, 1142, 1144, 1146, 1148, 1150,
+	1152, 1154, 1156, 1158, 1160, 1162, 1164, 1166, 1168, 1170,
+	1172, 1174, 1176, 1178, 1180, 1182, 1184, 1186, 1188, 1190,
+	1192, 1194, 1196, 1198, 1200, 1203, 1206, 1209, 1212, 1215,
+	1218, 1221, 1224, 1227, 1230, 1233, 1236, 1239, 1242, 1245,
+	1248, 1251, 1254, 1257, 1260, 1262, 1264, 1266, 1268, 1270,
+	1272, 1275, 1278, 1281, 1284, 1287, 1290, 1293, 1296, 1299,
+	1302, 1304, 1306, 1308, 1310, 1312, 1314, 1316, 1318, 1321,
+	1324, 1327, 1330, 1333, 1336, 1339, 1342, 1345, 1348, 1351,
+	1354, 1357, 1360, 1363, 1366, 1369, 1372, 1375, 1378, 1380,
+	1382, 1384, 1386, 1389, 1392, 1395, 1398, 1401, 1404, 1407,
+	1410, 1413, 1416, 1418, 1420, 1422, 1424, 1426, 1428, 1430,
+	1432, 1434, 1436, 1439, 1442, 1445, 1448, 1451, 1454, 1456,
+	1458, 1461, 1464, 1467, 1470, 1473, 1476, 1478, 1480, 1483,
+	1486, 1489, 1492, 1494, 1496, 1499, 1502, 1505, 1508, 1510,
+	1512, 1515, 1518, 1521, 1524, 1527, 1530, 1532, 1534, 1537,
+	1540, 1543, 1546, 1549, 1552, 1554, 1556, 1559, 1562, 1565,
+	1568, 1571, 1574, 1576, 1578, 1581, 1584, 1587, 1590, 1593,
+	1596, 1598, 1600, 1603, 1606, 1609, 1612, 1614, 1616, 1619,
+	1622, 1625, 1628, 1630, 1632, 1635, 1638, 1641, 1644, 1647,
+	1650, 1652, 1655, 1658, 1661, 1663, 1665, 1668, 1671, 1674,
+	1677, 1680, 1683, 1685, 1687, 1690, 1693, 1696, 1699, 1702,
+	1705, 1707, 1709, 1711, 1713, 1715, 1717, 1719, 1721, 1723,
+	1725, 1727, 1729, 1731, 1733, 1736, 1739, 1743, 1747, 1751,
+	1755, 1759, 1763, 1766, 1769, 1773, 1777, 1781, 1785, 1789,
+	1793, 1796, 1799, 1803, 1807, 1811, 1815, 1819, 1823, 1826,
+	1829, 1833, 1837, 1841, 1845, 1849, 1853, 1856, 1859, 1863,
+	1867, 1871, 1875, 1879, 1883, 1886, 1889, 1893, 1897, 1901,
+	1905, 1909, 1913, 1915, 1917, 1920, 1922, 1925, 1927, 1930,
+	1932, 1934, 1936, 1938, 1940, 1941, 1943, 1946, 1948, 1951,
+	1953, 1956, 1958, 1960, 1962, 1964, 1966, 1968, 1970, 1972,
+	1974, 1976, 1979, 1982, 1984, 1987, 1989, 1991, 1993, 1995,
+	1997, 1999, 2001, 2003, 2005, 2008, 2011, 2013, 2015, 2017,
+	2020, 2022, 2024, 2026, 2028, 2030, 2032, 2034, 2035, 2038,
+	2040, 2043, 2045, 2048, 2050, 2052, 2054, 2056, 2058, 2059,
+	2060, 2061, 2062, 2063, 2065, 2067, 2069, 2071, 2073, 2075,
+	2077, 2079, 2081, 2083, 2085, 2087, 2089, 2091, 2093, 2095,
+	2097, 2099, 2101, 2103, 2105, 2107, 2109, 2111, 2113, 2115,
+	2117, 2119, 2121, 2123, 2125, 2127, 2129, 2131, 2133, 2135,
+	2137, 2139, 2141, 2143, 2145, 2147, 2149, 2151, 2153, 2154,
+	2155, 2157, 2159, 2161, 2163, 2165, 2167, 2169, 2171, 2173,
+	2175, 2177, 2179, 2181, 2183, 2185, 2187, 2189, 2191, 2193,
+	2195, 2197, 2199, 2201, 2203, 2205, 2207, 2209, 2211, 2213,
+	2215, 2217, 2219, 2221, 2223, 2225, 2227, 2229, 2231, 2233,
+	2235, 2237, 2239, 2241, 2243, 2245, 2247, 2249, 2251, 2253,
+	2255, 2257, 2259, 2261, 2263, 2265, 2267, 2269, 2271, 2273,
+	2274, 2275, 2276, 2277, 2278, 2279, 2280, 2281, 2282, 2283,
+	2284, 2285, 2286, 2287, 2288, 2289, 2290, 2291, 2292, 2293,
+	2294, 2295, 2296, 2297, 2298, 2299, 2300, 2301, 2302, 2303,
+	2304, 2305, 2306, 2307, 2308, 2309, 2310, 2311, 2312, 2313,
+	2314, 2315, 2316, 2317, 2318, 2319, 2320, 2321, 2322, 2323,
+	2324, 2325, 2326, 2327, 2328, 2329, 2330, 2331, 2332, 2333,
+	2334, 2335, 2336, 2337, 2338, 2339, 2340, 2341, 2342, 2343,
+	2344, 2345, 2346, 2347, 2348, 2349, 2350, 2351, 2352, 2353,
+	2354, 2355, 2356, 2357, 2358, 2359, 2360, 2361, 2362, 2363,
+	2364, 2365, 2366, 2367, 2368, 2369, 2370, 2371, 2372, 2373,
+	2374, 2375, 2376, 2377, 2378, 2379, 2380, 2381, 2382, 2383,
+	2384, 2385, 2386, 2387, 2388, 2389, 2390, 2391, 2392, 2393,
+	2394, 2395, 2396, 2397, 2398, 2399, 2400, 2401, 2402, 2403,
+	2404, 2405, 2406, 2407, 2408, 2409, 2410, 2411, 2412, 2413,
+	2414, 2415, 2416, 2417, 2418, 2419, 2420, 2421, 2422, 2423,
+	2424, 2425, 2426, 2427, 2428, 2429, 2430, 2431, 2432, 2433,
+	2434, 2435, 2436, 2437, 2438, 2439, 2440, 2441, 2442, 2443,
+	2444, 2445, 2446, 2447, 2448, 2449, 2450, 2451, 2452, 2453,
+	2454, 2455, 2456, 2457, 2458, 2459, 2460, 2461, 2462, 2463,
+	2464, 2465, 2466, 2467, 2468, 2469, 2470, 2471, 2472, 2473,
+	2474, 2475, 2476, 2477, 2478, 2479, 2480, 2481, 2482, 2483,
+	2484, 2485, 2486, 2487, 2488, 2489, 2490, 2491, 2492, 2493,
+	2494, 2495, 2496, 2497, 2498, 2499, 2500, 2501, 2502, 2503,
+	2504, 2505, 2506, 2507, 2508, 2509, 2510, 2511, 2512, 2513,
+	2514, 2515, 2516, 2517, 2518, 2519, 2520, 2521, 2522, 2523,
+	2524, 2525, 2526, 2527, 2528, 2529, 2530, 2531, 2532, 2533,
+	2534, 2535, 2536, 2537, 2538, 2539, 2540, 2541, 2542, 2543,
+	2544, 2545, 2546, 2547, 2548, 2549, 2550, 2551, 2552, 2553,
+	2554, 2555, 2556, 2557, 2558, 2559, 2560, 2561, 2562, 2563,
+	2564, 2565, 2566, 2567, 2568, 2569, 2570, 2571, 2572, 2573,
+	2574, 2575, 2576, 2577, 2578, 2579, 2580, 2581, 2582, 2583,
+	2584, 2585, 2586, 2587, 2588, 2589, 2590, 2591, 2592, 2593,
+	2594, 2595, 2596, 2597, 2598, 2599, 2600, 2601, 2602, 2603,
+	2604, 2605, 2606, 2607, 2608, 2609, 2610, 2611, 2612, 2613,
+	2614, 2615, 2616, 2617, 2618, 2619, 2620, 2621, 2622, 2623,
+	2624, 2625, 2626, 2627, 2628, 2629, 2630, 2631, 2632, 2633,
+	2634, 2635, 2636, 2637, 2638, 2639, 2640, 2641, 2642, 2643,
+	2644, 2645, 2646, 2647, 2648, 2649, 2650, 2651, 2652, 2653,
+	2654, 2655, 2656, 2657, 2658, 2659, 2660, 2661, 2662, 2663,
+	2664, 2665, 2666, 2667, 2668, 2669, 2670, 2671, 2672, 2673,
+	2674, 2675, 2676, 2677, 2678, 2679, 2680, 2681, 2682, 2683,
+	2684, 2685, 2686, 2687, 2688, 2689, 2690, 2691, 2692, 2693,
+	2694, 2695, 2696, 2697, 2698, 2699, 2700, 2701, 2702, 2703,
+	2704, 2705, 2706, 2707, 2708, 2709, 2710, 2711, 2712, 2713,
+	2714, 2715, 2716, 2717, 2718, 2719, 2720, 2721, 2722, 2723,
+	2724, 2725, 2726, 2727, 2728, 2729, 2730, 2731, 2732, 2733,
+	2735, 2737, 2739, 2741, 2744, 2747, 2749, 2751, 2753, 2755,
+	2757, 2759, 2761, 2763, 2765, 2767, 2769, 2771, 2773, 2775,
+	2777, 2779, 2781, 2783, 2785, 2787, 2789, 2791, 2793, 2795,
+	2797, 2799, 2801, 2803, 2805, 2807, 2809, 2811, 2813, 2815,
+	2817, 2819, 2821, 2823, 2825, 2827, 2829, 2831, 2833, 2836,
+	2839, 2842, 2845, 2848, 2850, 2852, 2855, 2858, 2861, 2864,
+	2865, 2866, 2867, 2868, 2869, 2870, 2871, 2872, 2873, 2874,
+	2875, 2876, 2877, 2878, 2879, 2880, 2881, 2882, 2883, 2884,
+	2885, 2886, 2887, 2888, 2889, 2890, 2891, 2892, 2893, 2894,
+	2895, 2896, 2897, 2898, 2899, 2900, 2901, 2902, 2903, 2904,
+	2905, 2906, 2907, 2908, 2909, 2910, 2911, 2912, 2913, 2914,
+	2915, 2916, 2917, 2918, 2919, 2920, 2921, 2922, 2923, 2924,
+	2925, 2926, 2927, 2928, 2929, 2930, 2931, 2932, 2933, 2934,
+	2935, 2936, 2937, 2938, 2939, 2940, 2941, 2942, 2943, 2944,
+	2945, 2946, 2947, 2948, 2949, 2950, 2951, 2952, 2953, 2954,
+	2955, 2956, 2957, 2958, 2959, 2960, 2961, 2962, 2963, 2964,
+	2965, 2966, 2967, 2968, 2969, 2970, 2971, 2972, 2973, 2974,
+	2975, 2976, 2977, 2978, 2979, 2980, 2981, 2982, 2983, 2984,
+	2985, 2986, 2987, 2988, 2989, 2990, 2991, 2992, 2993, 2994,
+	2995, 2996, 2997, 2998, 2999, 3000, 3001, 3002, 3003, 3004,
+	3005, 3006, 3007, 3008, 3009, 3010, 3011, 3012, 3013, 3014,
+	3015, 3016, 3017, 3018, 3019, 3020, 3021, 3022, 3023, 3024,
+	3025, 3026, 3027, 3028, 3029, 3030, 3031, 3032, 3033, 3034,
+	3035, 3036, 3037, 3038, 3039, 3040, 3041, 3042, 3043, 3044,
+	3045, 3046, 3047, 3048, 3049, 3050, 3051, 3052, 3053, 3054,
+	3055, 3056, 3057, 3058, 3059, 3060, 3061, 3062, 3063, 3064,
+	3065, 3066, 3067, 3068, 3069, 3070, 3071, 3072, 3073, 3074,
+	3075, 3076, 3077, 3078, 3079, 3080, 3081, 3082, 3083, 3084,
+	3085, 3086, 3087, 3088, 3089, 3090, 3091, 3092, 3093, 3094,
+	3095, 3096, 3097, 3098, 3099, 3100, 3101, 3102, 3103, 3104,
+	3105, 3106, 3107, 3108, 3109, 3110, 3111, 3112, 3113, 3114,
+	3115, 3116, 3117, 3118, 3119, 3120, 3121, 3122, 3123, 3124,
+	3125, 3126, 3127, 3128, 3129, 3130, 3131, 3132, 3133, 3134,
+	3135, 3136, 3137, 3138, 3139, 3140, 3141, 3142, 3143, 3144,
+	3145, 3146, 3147, 3148, 3149, 3150, 3151, 3152, 3153, 3154,
+	3155, 3156, 3157, 3158, 3159, 3160, 3161, 3162, 3163, 3164,
+	3165, 3166, 3167, 3168, 3169, 3170, 3171, 3172, 3173, 3174,
+	3175, 3176, 3177, 3178, 3179, 3180, 3181, 3182, 3183, 3184,
+	3185, 3186, 3187, 3188, 3189, 3190, 3191, 3192, 3193, 3194,
+	3195, 3196, 3197, 3198, 3199, 3200, 3201, 3202, 3203, 3204,
+	3205, 3206, 3207, 3208, 3209, 3210, 3211, 3212, 3213, 3214,
+	3215, 3216, 3217, 3218, 3219, 3220, 3221, 3222, 3223, 3224,
+	3225, 3226, 3227, 3228, 3229, 3230, 3231, 3232, 3233, 3234,
+	3235, 3236, 3237, 3238, 3239, 3240, 3241, 3242, 3243, 3244,
+	3245, 3246, 3247, 3248, 3249, 3250, 3251, 3252, 3253, 3254,
+	3255, 3256, 3257, 3258, 3259, 3260, 3261, 3262, 3263, 3264,
+	3265, 3266, 3267, 3268, 3269, 3270, 3271, 3272, 3273, 3274,
+	3275, 3276, 3277, 3278, 3279, 3280, 3281, 3282, 3283, 3284,
+	3285, 3286, 3287, 3288, 3289, 3290, 3291, 3292, 3293, 3294,
+	3295, 3296, 3297, 3298, 3299, 3300, 3301, 3302, 3303, 3304,
+	3305, 3306, 3307, 3308, 3309, 3310, 3311, 3312, 3313, 3314,
+	3315, 3316, 3317, 3318, 3319, 3320, 3321, 3322, 3323, 3324,
+	3325, 3326, 3327, 3328, 3329, 3330, 3331, 3332, 3333, 3334,
+	3335, 3336, 3337, 3338, 3339, 3340, 3341, 3342, 3343, 3344,
+	3345, 3346, 3347, 3348, 3349, 3350, 3351, 3352, 3353, 3354,
+	3355, 3356, 3357, 3358, 3359, 3360, 3361, 3362, 3363, 3364,
+	3365, 3366, 3367, 3368, 3369, 3370, 3371, 3372, 3373, 3374,
+	3375, 3376, 3377, 3378, 3379, 3380, 3381, 3382, 3383, 3384,
+	3385, 3386, 3387, 3388, 3389, 3390, 3391, 3392, 3393, 3394,
+	3395, 3396, 3397, 3398, 3399, 3400, 3401, 3402, 3403, 3404,
+	3405, 3406,
+};
+
+const uint32_t nfc_decomp_seq[3406] = {
+	0x00041, 0x00300, 0x00041, 0x00301, 0x00041, 0x00302, 0x00041, 0x00303,
+	0x00041, 0x00308, 0x00041, 0x0030a, 0x00043, 0x00327, 0x00045, 0x00300,
+	0x00045, 0x00301, 0x00045, 0x00302, 0x00045, 0x00308, 0x00049, 0x00300,
+	0x00049, 0x00301, 0x00049, 0x00302, 0x00049, 0x00308, 0x0004e, 0x00303,
+	0x0004f, 0x00300, 0x0004f, 0x00301, 0x0004f, 0x00302, 0x0004f, 0x00303,
+	0x0004f, 0x00308, 0x00055, 0x00300, 0x00055, 0x00301, 0x00055, 0x00302,
+	0x00055, 0x00308, 0x00059, 0x00301, 0x00061, 0x00300, 0x00061, 0x00301,
+	0x00061, 0x00302, 0x00061, 0x00303, 0x00061, 0x00308, 0x00061, 0x0030a,
+	0x00063, 0x00327, 0x00065, 0x00300, 0x00065, 0x00301, 0x00065, 0x00302,
+	0x00065, 0x00308, 0x00069, 0x00300, 0x00069, 0x00301, 0x00069, 0x00302,
+	0x00069, 0x00308, 0x0006e, 0x00303, 0x0006f, 0x00300, 0x0006f, 0x00301,
+	0x0006f, 0x00302, 0x0006f, 0x00303, 0x0006f, 0x00308, 0x00075, 0x00300,
+	0x00075, 0x00301, 0x00075, 0x00302, 0x00075, 0x00308, 0x00079, 0x00301,
+	0x00079, 0x00308, 0x00041, 0x00304, 0x00061, 0x00304, 0x00041, 0x00306,
+	0x00061, 0x00306, 0x00041, 0x00328, 0x00061, 0x00328, 0x00043, 0x00301,
+	0x00063, 0x00301, 0x00043, 0x00302, 0x00063, 0x00302, 0x00043, 0x00307,
+	0x00063, 0x00307, 0x00043, 0x0030c, 0x00063, 0x0030c, 0x00044, 0x0030c,
+	0x00064, 0x0030c, 0x00045, 0x00304, 0x00065, 0x00304, 0x00045, 0x00306,
+	0x00065, 0x00306, 0x00045, 0x00307, 0x00065, 0x00307, 0x00045, 0x00328,
+	0x00065, 0x00328, 0x00045, 0x0030c, 0x00065, 0x0030c, 0x00047, 0x00302,
+	0x00067, 0x00302, 0x00047, 0x00306, 0x00067, 0x00306, 0x00047, 0x00307,
+	0x00067, 0x00307, 0x00047, 0x00327, 0x00067, 0x00327, 0x00048, 0x00302,
+	0x00068, 0x00302, 0x00049, 0x00303, 0x00069, 0x00303, 0x00049, 0x00304,
+	0x00069, 0x00304, 0x00049, 0x00306, 0x00069, 0x00306, 0x00049, 0x00328,
+	0x00069, 0x00328, 0x00049, 0x00307, 0x0004a, 0x00302, 0x0006a, 0x00302,
+	0x0004b, 0x00327, 0x0006b, 0x00327, 0x0004c, 0x00301, 0x0006c, 0x00301,
+	0x0004c, 0x00327, 0x0006c, 0x00327, 0x0004c, 0x0030c, 0x0006c, 0x0030c,
+	0x0004e, 0x00301, 0x0006e, 0x00301, 0x0004e, 0x00327, 0x0006e, 0x00327,
+	0x0004e, 0x0030c, 0x0006e, 0x0030c, 0x0004f, 0x00304, 0x0006f, 0x00304,
+	0x0004f, 0x00306, 0x0006f, 0x00306, 0x0004f, 0x0030b, 0x0006f, 0x0030b,
+	0x00052, 0x00301, 0x00072, 0x00301, 0x00052, 0x00327, 0x00072, 0x00327,
+	0x00052, 0x0030c, 0x00072, 0x0030c, 0x00053, 0x00301, 0x00073, 0x00301,
+	0x00053, 0x00302, 0x00073, 0x00302, 0x00053, 0x00327, 0x00073, 0x00327,
+	0x00053, 0x0030c, 0x00073, 0x0030c, 0x00054, 0x00327, 0x00074, 0x00327,
+	0x00054, 0x0030c, 0x00074, 0x0030c, 0x00055, 0x00303, 0x00075, 0x00303,
+	0x00055, 0x00304, 0x00075, 0x00304, 0x00055, 0x00306, 0x00075, 0x00306,
+	0x00055, 0x0030a, 0x00075, 0x0030a, 0x00055, 0x0030b, 0x00075, 0x0030b,
+	0x00055, 0x00328, 0x00075, 0x00328, 0x00057, 0x00302, 0x00077, 0x00302,
+	0x00059, 0x00302, 0x00079, 0x00302, 0x00059, 0x00308, 0x0005a, 0x00301,
+	0x0007a, 0x00301, 0x0005a, 0x00307, 0x0007a, 0x00307, 0x0005a, 0x0030c,
+	0x0007a, 0x0030c, 0x0004f, 0x0031b, 0x0006f, 0x0031b, 0x00055, 0x0031b,
+	0x00075, 0x0031b, 0x00041, 0x0030c, 0x00061, 0x0030c, 0x00049, 0x0030c,
+	0x00069, 0x0030c, 0x0004f, 0x0030c, 0x0006f, 0x0030c, 0x00055, 0x0030c,
+	0x00075, 0x0030c, 0x00055, 0x00308, 0x00304, 0x00075, 0x00308, 0x00304,
+	0x00055, 0x00308, 0x00301, 0x00075, 0x00308, 0x00301, 0x00055, 0x00308,
+	0x0030c, 0x00075, 0x00308, 0x0030c, 0x00055, 0x00308, 0x00300, 0x00075,
+	0x00308, 0x00300, 0x00041, 0x00308, 0x00304, 0x00061, 0x00308, 0x00304,
+	0x00041, 0x00307, 0x00304, 0x00061, 0x00307, 0x00304, 0x000c6, 0x00304,
+	0x000e6, 0x00304, 0x00047, 0x0030c, 0x00067, 0x0030c, 0x0004b, 0x0030c,
+	0x0006b, 0x0030c, 0x0004f, 0x00328, 0x0006f, 0x00328, 0x0004f, 0x00328,
+	0x00304, 0x0006f, 0x00328, 0x00304, 0x001b7, 0x0030c, 0x00292, 0x0030c,
+	0x0006a, 0x0030c, 0x00047, 0x00301, 0x00067, 0x00301, 0x0004e, 0x00300,
+	0x0006e, 0x00300, 0x00041, 0x0030a, 0x00301, 0x00061, 0x0030a, 0x00301,
+	0x000c6, 0x00301, 0x000e6, 0x00301, 0x000d8, 0x00301, 0x000f8, 0x00301,
+	0x00041, 0x0030f, 0x00061, 0x0030f, 0x00041, 0x00311, 0x00061, 0x00311,
+	0x00045, 0x0030f, 0x00065, 0x0030f, 0x00045, 0x00311, 0x00065, 0x00311,
+	0x00049, 0x0030f, 0x00069, 0x0030f, 0x00049, 0x00311, 0x00069, 0x00311,
+	0x0004f, 0x0030f, 0x0006f, 0x0030f, 0x0004f, 0x00311, 0x0006f, 0x00311,
+	0x00052, 0x0030f, 0x00072, 0x0030f, 0x00052, 0x00311, 0x00072, 0x00311,
+	0x00055, 0x0030f, 0x00075, 0x0030f, 0x00055, 0x00311, 0x00075, 0x00311,
+	0x00053, 0x00326, 0x00073, 0x00326, 0x00054, 0x00326, 0x00074, 0x00326,
+	0x00048, 0x0030c, 0x00068, 0x0030c, 0x00041, 0x00307, 0x00061, 0x00307,
+	0x00045, 0x00327, 0x00065, 0x00327, 0x0004f, 0x00308, 0x00304, 0x0006f,
+	0x00308, 0x00304, 0x0004f, 0x00303, 0x00304, 0x0006f, 0x00303, 0x00304,
+	0x0004f, 0x00307, 0x0006f, 0x00307, 0x0004f, 0x00307, 0x00304, 0x0006f,
+	0x00307, 0x00304, 0x00059, 0x00304, 0x00079, 0x00304, 0x00300, 0x00301,
+	0x00313, 0x00308, 0x00301, 0x002b9, 0x0003b, 0x000a8, 0x00301, 0x00391,
+	0x00301, 0x000b7, 0x00395, 0x00301, 0x00397, 0x00301, 0x00399, 0x00301,
+	0x0039f, 0x00301, 0x003a5, 0x00301, 0x003a9, 0x00301, 0x003b9, 0x00308,
+	0x00301, 0x00399, 0x00308, 0x003a5, 0x00308, 0x003b1, 0x00301, 0x003b5,
+	0x00301, 0x003b7, 0x00301, 0x003b9, 0x00301, 0x003c5, 0x00308, 0x00301,
+	0x003b9, 0x00308, 0x003c5, 0x00308, 0x003bf, 0x00301, 0x003c5, 0x00301,
+	0x003c9, 0x00301, 0x003d2, 0x00301, 0x003d2, 0x00308, 0x00415, 0x00300,
+	0x00415, 0x00308, 0x00413, 0x00301, 0x00406, 0x00308, 0x0041a, 0x00301,
+	0x00418, 0x00300, 0x00423, 0x00306, 0x00418, 0x00306, 0x00438, 0x00306,
+	0x00435, 0x00300, 0x00435, 0x00308, 0x00433, 0x00301, 0x00456, 0x00308,
+	0x0043a, 0x00301, 0x00438, 0x00300, 0x00443, 0x00306, 0x00474, 0x0030f,
+	0x00475, 0x0030f, 0x00416, 0x00306, 0x00436, 0x00306, 0x00410, 0x00306,
+	0x00430, 0x00306, 0x00410, 0x00308, 0x00430, 0x00308, 0x00415, 0x00306,
+	0x00435, 0x00306, 0x004d8, 0x00308, 0x004d9, 0x00308, 0x00416, 0x00308,
+	0x00436, 0x00308, 0x00417, 0x00308, 0x00437, 0x00308, 0x00418, 0x00304,
+	0x00438, 0x00304, 0x00418, 0x00308, 0x00438, 0x00308, 0x0041e, 0x00308,
+	0x0043e, 0x00308, 0x004e8, 0x00308, 0x004e9, 0x00308, 0x0042d, 0x00308,
+	0x0044d, 0x00308, 0x00423, 0x00304, 0x00443, 0x00304, 0x00423, 0x00308,
+	0x00443, 0x00308, 0x00423, 0x0030b, 0x00443, 0x0030b, 0x00427, 0x00308,
+	0x00447, 0x00308, 0x0042b, 0x00308, 0x0044b, 0x00308, 0x00627, 0x00653,
+	0x00627, 0x00654, 0x00648, 0x00654, 0x00627, 0x00655, 0x0064a, 0x00654,
+	0x006d5, 0x00654, 0x006c1, 0x00654, 0x006d2, 0x00654, 0x00928, 0x0093c,
+	0x00930, 0x0093c, 0x00933, 0x0093c, 0x00915, 0x0093c, 0x00916, 0x0093c,
+	0x00917, 0x0093c, 0x0091c, 0x0093c, 0x00921, 0x0093c, 0x00922, 0x0093c,
+	0x0092b, 0x0093c, 0x0092f, 0x0093c, 0x009c7, 0x009be, 0x009c7, 0x009d7,
+	0x009a1, 0x009bc, 0x009a2, 0x009bc, 0x009af, 0x009bc, 0x00a32, 0x00a3c,
+	0x00a38, 0x00a3c, 0x00a16, 0x00a3c, 0x00a17, 0x00a3c, 0x00a1c, 0x00a3c,
+	0x00a2b, 0x00a3c, 0x00b47, 0x00b56, 0x00b47, 0x00b3e, 0x00b47, 0x00b57,
+	0x00b21, 0x00b3c, 0x00b22, 0x00b3c, 0x00b92, 0x00bd7, 0x00bc6, 0x00bbe,
+	0x00bc7, 0x00bbe, 0x00bc6, 0x00bd7, 0x00c46, 0x00c56, 0x00cbf, 0x00cd5,
+	0x00cc6, 0x00cd5, 0x00cc6, 0x00cd6, 0x00cc6, 0x00cc2, 0x00cc6, 0x00cc2,
+	0x00cd5, 0x00d46, 0x00d3e, 0x00d47, 0x00d3e, 0x00d46, 0x00d57, 0x00dd9,
+	0x00dca, 0x00dd9, 0x00dcf, 0x00dd9, 0x00dcf, 0x00dca, 0x00dd9, 0x00ddf,
+	0x00f42, 0x00fb7, 0x00f4c, 0x00fb7, 0x00f51, 0x00fb7, 0x00f56, 0x00fb7,
+	0x00f5b, 0x00fb7, 0x00f40, 0x00fb5, 0x00f71, 0x00f72, 0x00f71, 0x00f74,
+	0x00fb2, 0x00f80, 0x00fb3, 0x00f80, 0x00f71, 0x00f80, 0x00f92, 0x00fb7,
+	0x00f9c, 0x00fb7, 0x00fa1, 0x00fb7, 0x00fa6, 0x00fb7, 0x00fab, 0x00fb7,
+	0x00f90, 0x00fb5, 0x01025, 0x0102e, 0x01b05, 0x01b35, 0x01b07, 0x01b35,
+	0x01b09, 0x01b35, 0x01b0b, 0x01b35, 0x01b0d, 0x01b35, 0x01b11, 0x01b35,
+	0x01b3a, 0x01b35, 0x01b3c, 0x01b35, 0x01b3e, 0x01b35, 0x01b3f, 0x01b35,
+	0x01b42, 0x01b35, 0x00041, 0x00325, 0x00061, 0x00325, 0x00042, 0x00307,
+	0x00062, 0x00307, 0x00042, 0x00323, 0x00062, 0x00323, 0x00042, 0x00331,
+	0x00062, 0x00331, 0x00043, 0x00327, 0x00301, 0x00063, 0x00327, 0x00301,
+	0x00044, 0x00307, 0x00064, 0x00307, 0x00044, 0x00323, 0x00064, 0x00323,
+	0x00044, 0x00331, 0x00064, 0x00331, 0x00044, 0x00327, 0x00064, 0x00327,
+	0x00044, 0x0032d, 0x00064, 0x0032d, 0x00045, 0x00304, 0x00300, 0x00065,
+	0x00304, 0x00300, 0x00045, 0x00304, 0x00301, 0x00065, 0x00304, 0x00301,
+	0x00045, 0x0032d, 0x00065, 0x0032d, 0x00045, 0x00330, 0x00065, 0x00330,
+	0x00045, 0x00327, 0x00306, 0x00065, 0x00327, 0x00306, 0x00046, 0x00307,
+	0x00066, 0x00307, 0x00047, 0x00304, 0x00067, 0x00304, 0x00048, 0x00307,
+	0x00068, 0x00307, 0x00048, 0x00323, 0x00068, 0x00323, 0x00048, 0x00308,
+	0x00068, 0x00308, 0x00048, 0x00327, 0x00068, 0x00327, 0x00048, 0x0032e,
+	0x00068, 0x0032e, 0x00049, 0x00330, 0x00069, 0x00330, 0x00049, 0x00308,
+	0x00301, 0x00069, 0x00308, 0x00301, 0x0004b, 0x00301, 0x0006b, 0x00301,
+	0x0004b, 0x00323, 0x0006b, 0x00323, 0x0004b, 0x00331, 0x0006b, 0x00331,
+	0x0004c, 0x00323, 0x0006c, 0x00323, 0x0004c, 0x00323, 0x00304, 0x0006c,
+	0x00323, 0x00304, 0x0004c, 0x00331, 0x0006c, 0x00331, 0x0004c, 0x0032d,
+	0x0006c, 0x0032d, 0x0004d, 0x00301, 0x0006d, 0x00301, 0x0004d, 0x00307,
+	0x0006d, 0x00307, 0x0004d, 0x00323, 0x0006d, 0x00323, 0x0004e, 0x00307,
+	0x0006e, 0x00307, 0x0004e, 0x00323, 0x0006e, 0x00323, 0x0004e, 0x00331,
+	0x0006e, 0x00331, 0x0004e, 0x0032d, 0x0006e, 0x0032d, 0x0004f, 0x00303,
+	0x00301, 0x0006f, 0x00303, 0x00301, 0x0004f, 0x00303, 0x00308, 0x0006f,
+	0x00303, 0x00308, 0x0004f, 0x00304, 0x00300, 0x0006f, 0x00304, 0x00300,
+	0x0004f, 0x00304, 0x00301, 0x0006f, 0x00304, 0x00301, 0x00050, 0x00301,
+	0x00070, 0x00301, 0x00050, 0x00307, 0x00070, 0x00307, 0x00052, 0x00307,
+	0x00072, 0x00307, 0x00052, 0x00323, 0x00072, 0x00323, 0x00052, 0x00323,
+	0x00304, 0x00072, 0x00323, 0x00304, 0x00052, 0x00331, 0x00072, 0x00331,
+	0x00053, 0x00307, 0x00073, 0x00307, 0x00053, 0x00323, 0x00073, 0x00323,
+	0x00053, 0x00301, 0x00307, 0x00073, 0x00301, 0x00307, 0x00053, 0x0030c,
+	0x00307, 0x00073, 0x0030c, 0x00307, 0x00053, 0x00323, 0x00307, 0x00073,
+	0x00323, 0x00307, 0x00054, 0x00307, 0x00074, 0x00307, 0x00054, 0x00323,
+	0x00074, 0x00323, 0x00054, 0x00331, 0x00074, 0x00331, 0x00054, 0x0032d,
+	0x00074, 0x0032d, 0x00055, 0x00324, 0x00075, 0x00324, 0x00055, 0x00330,
+	0x00075, 0x00330, 0x00055, 0x0032d, 0x00075, 0x0032d, 0x00055, 0x00303,
+	0x00301, 0x00075, 0x00303, 0x00301, 0x00055, 0x00304, 0x00308, 0x00075,
+	0x00304, 0x00308, 0x00056, 0x00303, 0x00076, 0x00303, 0x00056, 0x00323,
+	0x00076, 0x00323, 0x00057, 0x00300, 0x00077, 0x00300, 0x00057, 0x00301,
+	0x00077, 0x00301, 0x00057, 0x00308, 0x00077, 0x00308, 0x00057, 0x00307,
+	0x00077, 0x00307, 0x00057, 0x00323, 0x00077, 0x00323, 0x00058, 0x00307,
+	0x00078, 0x00307, 0x00058, 0x00308, 0x00078, 0x00308, 0x00059, 0x00307,
+	0x00079, 0x00307, 0x0005a, 0x00302, 0x0007a, 0x00302, 0x0005a, 0x00323,
+	0x0007a, 0x00323, 0x0005a, 0x00331, 0x0007a, 0x00331, 0x00068, 0x00331,
+	0x00074, 0x00308, 0x00077, 0x0030a, 0x00079, 0x0030a, 0x0017f, 0x00307,
+	0x00041, 0x00323, 0x00061, 0x00323, 0x00041, 0x00309, 0x00061, 0x00309,
+	0x00041, 0x00302, 0x00301, 0x00061, 0x00302, 0x00301, 0x00041, 0x00302,
+	0x00300, 0x00061, 0x00302, 0x00300, 0x00041, 0x00302, 0x00309, 0x00061,
+	0x00302, 0x00309, 0x00041, 0x00302, 0x00303, 0x00061, 0x00302, 0x00303,
+	0x00041, 0x00323, 0x00302, 0x00061, 0x00323, 0x00302, 0x00041, 0x00306,
+	0x00301, 0x00061, 0x00306, 0x00301, 0x00041, 0x00306, 0x00300, 0x00061,
+	0x00306, 0x00300, 0x00041, 0x00306, 0x00309, 0x00061, 0x00306, 0x00309,
+	0x00041, 0x00306, 0x00303, 0x00061, 0x00306, 0x00303, 0x00041, 0x00323,
+	0x00306, 0x00061, 0x00323, 0x00306, 0x00045, 0x00323, 0x00065, 0x00323,
+	0x00045, 0x00309, 0x00065, 0x00309, 0x00045, 0x00303, 0x00065, 0x00303,
+	0x00045, 0x00302, 0x00301, 0x00065, 0x00302, 0x00301, 0x00045, 0x00302,
+	0x00300, 0x00065, 0x00302, 0x00300, 0x00045, 0x00302, 0x00309, 0x00065,
+	0x00302, 0x00309, 0x00045, 0x00302, 0x00303, 0x00065, 0x00302, 0x00303,
+	0x00045, 0x00323, 0x00302, 0x00065, 0x00323, 0x00302, 0x00049, 0x00309,
+	0x00069, 0x00309, 0x00049, 0x00323, 0x00069, 0x00323, 0x0004f, 0x00323,
+	0x0006f, 0x00323, 0x0004f, 0x00309, 0x0006f, 0x00309, 0x0004f, 0x00302,
+	0x00301, 0x0006f, 0x00302, 0x00301, 0x0004f, 0x00302, 0x00300, 0x0006f,
+	0x00302, 0x00300, 0x0004f, 0x00302, 0x00309, 0x0006f, 0x00302, 0x00309,
+	0x0004f, 0x00302, 0x00303, 0x0006f, 0x00302, 0x00303, 0x0004f, 0x00323,
+	0x00302, 0x0006f, 0x00323, 0x00302, 0x0004f, 0x0031b, 0x00301, 0x0006f,
+	0x0031b, 0x00301, 0x0004f, 0x0031b, 0x00300, 0x0006f, 0x0031b, 0x00300,
+	0x0004f, 0x0031b, 0x00309, 0x0006f, 0x0031b, 0x00309, 0x0004f, 0x0031b,
+	0x00303, 0x0006f, 0x0031b, 0x00303, 0x0004f, 0x0031b, 0x00323, 0x0006f,
+	0x0031b, 0x00323, 0x00055, 0x00323, 0x00075, 0x00323, 0x00055, 0x00309,
+	0x00075, 0x00309, 0x00055, 0x0031b, 0x00301, 0x00075, 0x0031b, 0x00301,
+	0x00055, 0x0031b, 0x00300, 0x00075, 0x0031b, 0x00300, 0x00055, 0x0031b,
+	0x00309, 0x00075, 0x0031b, 0x00309, 0x00055, 0x0031b, 0x00303, 0x00075,
+	0x0031b, 0x00303, 0x00055, 0x0031b, 0x00323, 0x00075, 0x0031b, 0x00323,
+	0x00059, 0x00300, 0x00079, 0x00300, 0x00059, 0x00323, 0x00079, 0x00323,
+	0x00059, 0x00309, 0x00079, 0x00309, 0x00059, 0x00303, 0x00079, 0x00303,
+	0x003b1, 0x00313, 0x003b1, 0x00314, 0x003b1, 0x00313, 0x00300, 0x003b1,
+	0x00314, 0x00300, 0x003b1, 0x00313, 0x00301, 0x003b1, 0x00314, 0x00301,
+	0x003b1, 0x00313, 0x00342, 0x003b1, 0x00314, 0x00342, 0x00391, 0x00313,
+	0x00391, 0x00314, 0x00391, 0x00313, 0x00300, 0x00391, 0x00314, 0x00300,
+	0x00391, 0x00313, 0x00301, 0x00391, 0x00314, 0x00301, 0x00391, 0x00313,
+	0x00342, 0x00391, 0x00314, 0x00342, 0x003b5, 0x00313, 0x003b5, 0x00314,
+	0x003b5, 0x00313, 0x00300, 0x003b5, 0x00314, 0x00300, 0x003b5, 0x00313,
+	0x00301, 0x003b5, 0x00314, 0x00301, 0x00395, 0x00313, 0x00395, 0x00314,
+	0x00395, 0x00313, 0x00300, 0x00395, 0x00314, 0x00300, 0x00395, 0x00313,
+	0x00301, 0x00395, 0x00314, 0x00301, 0x003b7, 0x00313, 0x003b7, 0x00314,
+	0x003b7, 0x00313, 0x00300, 0x003b7, 0x00314, 0x00300, 0x003b7, 0x00313,
+	0x00301, 0x003b7, 0x00314, 0x00301, 0x003b7, 0x00313, 0x00342, 0x003b7,
+	0x00314, 0x00342, 0x00397, 0x00313, 0x00397, 0x00314, 0x00397, 0x00313,
+	0x00300, 0x00397, 0x00314, 0x00300, 0x00397, 0x00313, 0x00301, 0x00397,
+	0x00314, 0x00301, 0x00397, 0x00313, 0x00342, 0x00397, 0x00314, 0x00342,
+	0x003b9, 0x00313, 0x003b9, 0x00314, 0x003b9, 0x00313, 0x00300, 0x003b9,
+	0x00314, 0x00300, 0x003b9, 0x00313, 0x00301, 0x003b9, 0x00314, 0x00301,
+	0x003b9, 0x00313, 0x00342, 0x003b9, 0x00314, 0x00342, 0x00399, 0x00313,
+	0x00399, 0x00314, 0x00399, 0x00313, 0x00300, 0x00399, 0x00314, 0x00300,
+	0x00399, 0x00313, 0x00301, 0x00399, 0x00314, 0x00301, 0x00399, 0x00313,
+	0x00342, 0x00399, 0x00314, 0x00342, 0x003bf, 0x00313, 0x003bf, 0x00314,
+	0x003bf, 0x00313, 0x00300, 0x003bf, 0x00314, 0x00300, 0x003bf, 0x00313,
+	0x00301, 0x003bf, 0x00314, 0x00301, 0x0039f, 0x00313, 0x0039f, 0x00314,
+	0x0039f, 0x00313, 0x00300, 0x0039f, 0x00314, 0x00300, 0x0039f, 0x00313,
+	0x00301, 0x0039f, 0x00314, 0x00301, 0x003c5, 0x00313, 0x003c5, 0x00314,
+	0x003c5, 0x00313, 0x00300, 0x003c5, 0x00314, 0x00300, 0x003c5, 0x00313,
+	0x00301, 0x003c5, 0x00314, 0x00301, 0x003c5, 0x00313, 0x00342, 0x003c5,
+	0x00314, 0x00342, 0x003a5, 0x00314, 0x003a5, 0x00314, 0x00300, 0x003a5,
+	0x00314, 0x00301, 0x003a5, 0x00314, 0x00342, 0x003c9, 0x00313, 0x003c9,
+	0x00314, 0x003c9, 0x00313, 0x00300, 0x003c9, 0x00314, 0x00300, 0x003c9,
+	0x00313, 0x00301, 0x003c9, 0x00314, 0x00301, 0x003c9, 0x00313, 0x00342,
+	0x003c9, 0x00314, 0x00342, 0x003a9, 0x00313, 0x003a9, 0x00314, 0x003a9,
+	0x00313, 0x00300, 0x003a9, 0x00314, 0x00300, 0x003a9, 0x00313, 0x00301,
+	0x003a9, 0x00314, 0x00301, 0x003a9, 0x00313, 0x00342, 0x003a9, 0x00314,
+	0x00342, 0x003b1, 0x00300, 0x003b1, 0x00301, 0x003b5, 0x00300, 0x003b5,
+	0x00301, 0x003b7, 0x00300, 0x003b7, 0x00301, 0x003b9, 0x00300, 0x003b9,
+	0x00301, 0x003bf, 0x00300, 0x003bf, 0x00301, 0x003c5, 0x00300, 0x003c5,
+	0x00301, 0x003c9, 0x00300, 0x003c9, 0x00301, 0x003b1, 0x00313, 0x00345,
+	0x003b1, 0x00314, 0x00345, 0x003b1, 0x00313, 0x00300, 0x00345, 0x003b1,
+	0x00314, 0x00300, 0x00345, 0x003b1, 0x00313, 0x00301, 0x00345, 0x003b1,
+	0x00314, 0x00301, 0x00345, 0x003b1, 0x00313, 0x00342, 0x00345, 0x003b1,
+	0x00314, 0x00342, 0x00345, 0x00391, 0x00313, 0x00345, 0x00391, 0x00314,
+	0x00345, 0x00391, 0x00313, 0x00300, 0x00345, 0x00391, 0x00314, 0x00300,
+	0x00345, 0x00391, 0x00313, 0x00301, 0x00345, 0x00391, 0x00314, 0x00301,
+	0x00345, 0x00391, 0x00313, 0x00342, 0x00345, 0x00391, 0x00314, 0x00342,
+	0x00345, 0x003b7, 0x00313, 0x00345, 0x003b7, 0x00314, 0x00345, 0x003b7,
+	0x00313, 0x00300, 0x00345, 0x003b7, 0x00314, 0x00300, 0x00345, 0x003b7,
+	0x00313, 0x00301, 0x00345, 0x003b7, 0x00314, 0x00301, 0x00345, 0x003b7,
+	0x00313, 0x00342, 0x00345, 0x003b7, 0x00314, 0x00342, 0x00345, 0x00397,
+	0x00313, 0x00345, 0x00397, 0x00314, 0x00345, 0x00397, 0x00313, 0x00300,
+	0x00345, 0x00397, 0x00314, 0x00300, 0x00345, 0x00397, 0x00313, 0x00301,
+	0x00345, 0x00397, 0x00314, 0x00301, 0x00345, 0x00397, 0x00313, 0x00342,
+	0x00345, 0x00397, 0x00314, 0x00342, 0x00345, 0x003c9, 0x00313, 0x00345,
+	0x003c9, 0x00314, 0x00345, 0x003c9, 0x00313, 0x00300, 0x00345, 0x003c9,
+	0x00314, 0x00300, 0x00345, 0x003c9, 0x00313, 0x00301, 0x00345, 0x003c9,
+	0x00314, 0x00301, 0x00345, 0x003c9, 0x00313, 0x00342, 0x00345, 0x003c9,
+	0x00314, 0x00342, 0x00345, 0x003a9, 0x00313, 0x00345, 0x003a9, 0x00314,
+	0x00345, 0x003a9, 0x00313, 0x00300, 0x00345, 0x003a9, 0x00314, 0x00300,
+	0x00345, 0x003a9, 0x00313, 0x00301, 0x00345, 0x003a9, 0x00314, 0x00301,
+	0x00345, 0x003a9, 0x00313, 0x00342, 0x00345, 0x003a9, 0x00314, 0x00342,
+	0x00345, 0x003b1, 0x00306, 0x003b1, 0x00304, 0x003b1, 0x00300, 0x00345,
+	0x003b1, 0x00345, 0x003b1, 0x00301, 0x00345, 0x003b1, 0x00342, 0x003b1,
+	0x00342, 0x00345, 0x00391, 0x00306, 0x00391, 0x00304, 0x00391, 0x00300,
+	0x00391, 0x00301, 0x00391, 0x00345, 0x003b9, 0x000a8, 0x00342, 0x003b7,
+	0x00300, 0x00345, 0x003b7, 0x00345, 0x003b7, 0x00301, 0x00345, 0x003b7,
+	0x00342, 0x003b7, 0x00342, 0x00345, 0x00395, 0x00300, 0x00395, 0x00301,
+	0x00397, 0x00300, 0x00397, 0x00301, 0x00397, 0x00345, 0x01fbf, 0x00300,
+	0x01fbf, 0x00301, 0x01fbf, 0x00342, 0x003b9, 0x00306, 0x003b9, 0x00304,
+	0x003b9, 0x00308, 0x00300, 0x003b9, 0x00308, 0x00301, 0x003b9, 0x00342,
+	0x003b9, 0x00308, 0x00342, 0x00399, 0x00306, 0x00399, 0x00304, 0x00399,
+	0x00300, 0x00399, 0x00301, 0x01ffe, 0x00300, 0x01ffe, 0x00301, 0x01ffe,
+	0x00342, 0x003c5, 0x00306, 0x003c5, 0x00304, 0x003c5, 0x00308, 0x00300,
+	0x003c5, 0x00308, 0x00301, 0x003c1, 0x00313, 0x003c1, 0x00314, 0x003c5,
+	0x00342, 0x003c5, 0x00308, 0x00342, 0x003a5, 0x00306, 0x003a5, 0x00304,
+	0x003a5, 0x00300, 0x003a5, 0x00301, 0x003a1, 0x00314, 0x000a8, 0x00300,
+	0x000a8, 0x00301, 0x00060, 0x003c9, 0x00300, 0x00345, 0x003c9, 0x00345,
+	0x003c9, 0x00301, 0x00345, 0x003c9, 0x00342, 0x003c9, 0x00342, 0x00345,
+	0x0039f, 0x00300, 0x0039f, 0x00301, 0x003a9, 0x00300, 0x003a9, 0x00301,
+	0x003a9, 0x00345, 0x000b4, 0x02002, 0x02003, 0x003a9, 0x0004b, 0x00041,
+	0x0030a, 0x02190, 0x00338, 0x02192, 0x00338, 0x02194, 0x00338, 0x021d0,
+	0x00338, 0x021d4, 0x00338, 0x021d2, 0x00338, 0x02203, 0x00338, 0x02208,
+	0x00338, 0x0220b, 0x00338, 0x02223, 0x00338, 0x02225, 0x00338, 0x0223c,
+	0x00338, 0x02243, 0x00338, 0x02245, 0x00338, 0x02248, 0x00338, 0x0003d,
+	0x00338, 0x02261, 0x00338, 0x0224d, 0x00338, 0x0003c, 0x00338, 0x0003e,
+	0x00338, 0x02264, 0x00338, 0x02265, 0x00338, 0x02272, 0x00338, 0x02273,
+	0x00338, 0x02276, 0x00338, 0x02277, 0x00338, 0x0227a, 0x00338, 0x0227b,
+	0x00338, 0x02282, 0x00338, 0x02283, 0x00338, 0x02286, 0x00338, 0x02287,
+	0x00338, 0x022a2, 0x00338, 0x022a8, 0x00338, 0x022a9, 0x00338, 0x022ab,
+	0x00338, 0x0227c, 0x00338, 0x0227d, 0x00338, 0x02291, 0x00338, 0x02292,
+	0x00338, 0x022b2, 0x00338, 0x022b3, 0x00338, 0x022b4, 0x00338, 0x022b5,
+	0x00338, 0x03008, 0x03009, 0x02add, 0x00338, 0x0304b, 0x03099, 0x0304d,
+	0x03099, 0x0304f, 0x03099, 0x03051, 0x03099, 0x03053, 0x03099, 0x03055,
+	0x03099, 0x03057, 0x03099, 0x03059, 0x03099, 0x0305b, 0x03099, 0x0305d,
+	0x03099, 0x0305f, 0x03099, 0x03061, 0x03099, 0x03064, 0x03099, 0x03066,
+	0x03099, 0x03068, 0x03099, 0x0306f, 0x03099, 0x0306f, 0x0309a, 0x03072,
+	0x03099, 0x03072, 0x0309a, 0x03075, 0x03099, 0x03075, 0x0309a, 0x03078,
+	0x03099, 0x03078, 0x0309a, 0x0307b, 0x03099, 0x0307b, 0x0309a, 0x03046,
+	0x03099, 0x0309d, 0x03099, 0x030ab, 0x03099, 0x030ad, 0x03099, 0x030af,
+	0x03099, 0x030b1, 0x03099, 0x030b3, 0x03099, 0x030b5, 0x03099, 0x030b7,
+	0x03099, 0x030b9, 0x03099, 0x030bb, 0x03099, 0x030bd, 0x03099, 0x030bf,
+	0x03099, 0x030c1, 0x03099, 0x030c4, 0x03099, 0x030c6, 0x03099, 0x030c8,
+	0x03099, 0x030cf, 0x03099, 0x030cf, 0x0309a, 0x030d2, 0x03099, 0x030d2,
+	0x0309a, 0x030d5, 0x03099, 0x030d5, 0x0309a, 0x030d8, 0x03099, 0x030d8,
+	0x0309a, 0x030db, 0x03099, 0x030db, 0x0309a, 0x030a6, 0x03099, 0x030ef,
+	0x03099, 0x030f0, 0x03099, 0x030f1, 0x03099, 0x030f2, 0x03099, 0x030fd,
+	0x03099, 0x08c48, 0x066f4, 0x08eca, 0x08cc8, 0x06ed1, 0x04e32, 0x053e5,
+	0x09f9c, 0x09f9c, 0x05951, 0x091d1, 0x05587, 0x05948, 0x061f6, 0x07669,
+	0x07f85, 0x0863f, 0x087ba, 0x088f8, 0x0908f, 0x06a02, 0x06d1b, 0x070d9,
+	0x073de, 0x0843d, 0x0916a, 0x099f1, 0x04e82, 0x05375, 0x06b04, 0x0721b,
+	0x0862d, 0x09e1e, 0x05d50, 0x06feb, 0x085cd, 0x08964, 0x062c9, 0x081d8,
+	0x0881f, 0x05eca, 0x06717, 0x06d6a, 0x072fc, 0x090ce, 0x04f86, 0x051b7,
+	0x052de, 0x064c4, 0x06ad3, 0x07210, 0x076e7, 0x08001, 0x08606, 0x0865c,
+	0x08def, 0x09732, 0x09b6f, 0x09dfa, 0x0788c, 0x0797f, 0x07da0, 0x083c9,
+	0x09304, 0x09e7f, 0x08ad6, 0x058df, 0x05f04, 0x07c60, 0x0807e, 0x07262,
+	0x078ca, 0x08cc2, 0x096f7, 0x058d8, 0x05c62, 0x06a13, 0x06dda, 0x06f0f,
+	0x07d2f, 0x07e37, 0x0964b, 0x052d2, 0x0808b, 0x051dc, 0x051cc, 0x07a1c,
+	0x07dbe, 0x083f1, 0x09675, 0x08b80, 0x062cf, 0x06a02, 0x08afe, 0x04e39,
+	0x05be7, 0x06012, 0x07387, 0x07570, 0x05317, 0x078fb, 0x04fbf, 0x05fa9,
+	0x04e0d, 0x06ccc, 0x06578, 0x07d22, 0x053c3, 0x0585e, 0x07701, 0x08449,
+	0x08aaa, 0x06bba, 0x08fb0, 0x06c88, 0x062fe, 0x082e5, 0x063a0, 0x07565,
+	0x04eae, 0x05169, 0x051c9, 0x06881, 0x07ce7, 0x0826f, 0x08ad2, 0x091cf,
+	0x052f5, 0x05442, 0x05973, 0x05eec, 0x065c5, 0x06ffe, 0x0792a, 0x095ad,
+	0x09a6a, 0x09e97, 0x09ece, 0x0529b, 0x066c6, 0x06b77, 0x08f62, 0x05e74,
+	0x06190, 0x06200, 0x0649a, 0x06f23, 0x07149, 0x07489, 0x079ca, 0x07df4,
+	0x0806f, 0x08f26, 0x084ee, 0x09023, 0x0934a, 0x05217, 0x052a3, 0x054bd,
+	0x070c8, 0x088c2, 0x08aaa, 0x05ec9, 0x05ff5, 0x0637b, 0x06bae, 0x07c3e,
+	0x07375, 0x04ee4, 0x056f9, 0x05be7, 0x05dba, 0x0601c, 0x073b2, 0x07469,
+	0x07f9a, 0x08046, 0x09234, 0x096f6, 0x09748, 0x09818, 0x04f8b, 0x079ae,
+	0x091b4, 0x096b8, 0x060e1, 0x04e86, 0x050da, 0x05bee, 0x05c3f, 0x06599,
+	0x06a02, 0x071ce, 0x07642, 0x084fc, 0x0907c, 0x09f8d, 0x06688, 0x0962e,
+	0x05289, 0x0677b, 0x067f3, 0x06d41, 0x06e9c, 0x07409, 0x07559, 0x0786b,
+	0x07d10, 0x0985e, 0x0516d, 0x0622e, 0x09678, 0x0502b, 0x05d19, 0x06dea,
+	0x08f2a, 0x05f8b, 0x06144, 0x06817, 0x07387, 0x09686, 0x05229, 0x0540f,
+	0x05c65, 0x06613, 0x0674e, 0x068a8, 0x06ce5, 0x07406, 0x075e2, 0x07f79,
+	0x088cf, 0x088e1, 0x091cc, 0x096e2, 0x0533f, 0x06eba, 0x0541d, 0x071d0,
+	0x07498, 0x085fa, 0x096a3, 0x09c57, 0x09e9f, 0x06797, 0x06dcb, 0x081e8,
+	0x07acb, 0x07b20, 0x07c92, 0x072c0, 0x07099, 0x08b58, 0x04ec0, 0x08336,
+	0x0523a, 0x05207, 0x05ea6, 0x062d3, 0x07cd6, 0x05b85, 0x06d1e, 0x066b4,
+	0x08f3b, 0x0884c, 0x0964d, 0x0898b, 0x05ed3, 0x05140, 0x055c0, 0x0585a,
+	0x06674, 0x051de, 0x0732a, 0x076ca, 0x0793c, 0x0795e, 0x07965, 0x0798f,
+	0x09756, 0x07cbe, 0x07fbd, 0x08612, 0x08af8, 0x09038, 0x090fd, 0x098ef,
+	0x098fc, 0x09928, 0x09db4, 0x090de, 0x096b7, 0x04fae, 0x050e7, 0x0514d,
+	0x052c9, 0x052e4, 0x05351, 0x0559d, 0x05606, 0x05668, 0x05840, 0x058a8,
+	0x05c64, 0x05c6e, 0x06094, 0x06168, 0x0618e, 0x061f2, 0x0654f, 0x065e2,
+	0x06691, 0x06885, 0x06d77, 0x06e1a, 0x06f22, 0x0716e, 0x0722b, 0x07422,
+	0x07891, 0x0793e, 0x07949, 0x07948, 0x07950, 0x07956, 0x0795d, 0x0798d,
+	0x0798e, 0x07a40, 0x07a81, 0x07bc0, 0x07df4, 0x07e09, 0x07e41, 0x07f72,
+	0x08005, 0x081ed, 0x08279, 0x08279, 0x08457, 0x08910, 0x08996, 0x08b01,
+	0x08b39, 0x08cd3, 0x08d08, 0x08fb6, 0x09038, 0x096e3, 0x097ff, 0x0983b,
+	0x06075, 0x242ee, 0x08218, 0x04e26, 0x051b5, 0x05168, 0x04f80, 0x05145,
+	0x05180, 0x052c7, 0x052fa, 0x0559d, 0x05555, 0x05599, 0x055e2, 0x0585a,
+	0x058b3, 0x05944, 0x05954, 0x05a62, 0x05b28, 0x05ed2, 0x05ed9, 0x05f69,
+	0x05fad, 0x060d8, 0x0614e, 0x06108, 0x0618e, 0x06160, 0x061f2, 0x06234,
+	0x063c4, 0x0641c, 0x06452, 0x06556, 0x06674, 0x06717, 0x0671b, 0x06756,
+	0x06b79, 0x06bba, 0x06d41, 0x06edb, 0x06ecb, 0x06f22, 0x0701e, 0x0716e,
+	0x077a7, 0x07235, 0x072af, 0x0732a, 0x07471, 0x07506, 0x0753b, 0x0761d,
+	0x0761f, 0x076ca, 0x076db, 0x076f4, 0x0774a, 0x07740, 0x078cc, 0x07ab1,
+	0x07bc0, 0x07c7b, 0x07d5b, 0x07df4, 0x07f3e, 0x08005, 0x08352, 0x083ef,
+	0x08779, 0x08941, 0x08986, 0x08996, 0x08abf, 0x08af8, 0x08acb, 0x08b01,
+	0x08afe, 0x08aed, 0x08b39, 0x08b8a, 0x08d08, 0x08f38, 0x09072, 0x09199,
+	0x09276, 0x0967c, 0x096e3, 0x09756, 0x097db, 0x097ff, 0x0980b, 0x0983b,
+	0x09b12, 0x09f9c, 0x2284a, 0x22844, 0x233d5, 0x03b9d, 0x04018, 0x04039,
+	0x25249, 0x25cd0, 0x27ed3, 0x09f43, 0x09f8e, 0x005d9, 0x005b4, 0x005f2,
+	0x005b7, 0x005e9, 0x005c1, 0x005e9, 0x005c2, 0x005e9, 0x005bc, 0x005c1,
+	0x005e9, 0x005bc, 0x005c2, 0x005d0, 0x005b7, 0x005d0, 0x005b8, 0x005d0,
+	0x005bc, 0x005d1, 0x005bc, 0x005d2, 0x005bc, 0x005d3, 0x005bc, 0x005d4,
+	0x005bc, 0x005d5, 0x005bc, 0x005d6, 0x005bc, 0x005d8, 0x005bc, 0x005d9,
+	0x005bc, 0x005da, 0x005bc, 0x005db, 0x005bc, 0x005dc, 0x005bc, 0x005de,
+	0x005bc, 0x005e0, 0x005bc, 0x005e1, 0x005bc, 0x005e3, 0x005bc, 0x005e4,
+	0x005bc, 0x005e6, 0x005bc, 0x005e7, 0x005bc, 0x005e8, 0x005bc, 0x005e9,
+	0x005bc, 0x005ea, 0x005bc, 0x005d5, 0x005b9, 0x005d1, 0x005bf, 0x005db,
+	0x005bf, 0x005e4, 0x005bf, 0x11099, 0x110ba, 0x1109b, 0x110ba, 0x110a5,
+	0x110ba, 0x11131, 0x11127, 0x11132, 0x11127, 0x11347, 0x1133e, 0x11347,
+	0x11357, 0x114b9, 0x114ba, 0x114b9, 0x114b0, 0x114b9, 0x114bd, 0x115b8,
+	0x115af, 0x115b9, 0x115af, 0x11935, 0x11930, 0x1d157, 0x1d165, 0x1d158,
+	0x1d165, 0x1d158, 0x1d165, 0x1d16e, 0x1d158, 0x1d165, 0x1d16f, 0x1d158,
+	0x1d165, 0x1d170, 0x1d158, 0x1d165, 0x1d171, 0x1d158, 0x1d165, 0x1d172,
+	0x1d1b9, 0x1d165, 0x1d1ba, 0x1d165, 0x1d1b9, 0x1d165, 0x1d16e, 0x1d1ba,
+	0x1d165, 0x1d16e, 0x1d1b9, 0x1d165, 0x1d16f, 0x1d1ba, 0x1d165, 0x1d16f,
+	0x04e3d, 0x04e38, 0x04e41, 0x20122, 0x04f60, 0x04fae, 0x04fbb, 0x05002,
+	0x0507a, 0x05099, 0x050e7, 0x050cf, 0x0349e, 0x2063a, 0x0514d, 0x05154,
+	0x05164, 0x05177, 0x2051c, 0x034b9, 0x05167, 0x0518d, 0x2054b, 0x05197,
+	0x051a4, 0x04ecc, 0x051ac, 0x051b5, 0x291df, 0x051f5, 0x05203, 0x034df,
+	0x0523b, 0x05246, 0x05272, 0x05277, 0x03515, 0x052c7, 0x052c9, 0x052e4,
+	0x052fa, 0x05305, 0x05306, 0x05317, 0x05349, 0x05351, 0x0535a, 0x05373,
+	0x0537d, 0x0537f, 0x0537f, 0x0537f, 0x20a2c, 0x07070, 0x053ca, 0x053df,
+	0x20b63, 0x053eb, 0x053f1, 0x05406, 0x0549e, 0x05438, 0x05448, 0x05468,
+	0x054a2, 0x054f6, 0x05510, 0x05553, 0x05563, 0x05584, 0x05584, 0x05599,
+	0x055ab, 0x055b3, 0x055c2, 0x05716, 0x05606, 0x05717, 0x05651, 0x05674,
+	0x05207, 0x058ee, 0x057ce, 0x057f4, 0x0580d, 0x0578b, 0x05832, 0x05831,
+	0x058ac, 0x214e4, 0x058f2, 0x058f7, 0x05906, 0x0591a, 0x05922, 0x05962,
+	0x216a8, 0x216ea, 0x059ec, 0x05a1b, 0x05a27, 0x059d8, 0x05a66, 0x036ee,
+	0x036fc, 0x05b08, 0x05b3e, 0x05b3e, 0x219c8, 0x05bc3, 0x05bd8, 0x05be7,
+	0x05bf3, 0x21b18, 0x05bff, 0x05c06, 0x05f53, 0x05c22, 0x03781, 0x05c60,
+	0x05c6e, 0x05cc0, 0x05c8d, 0x21de4, 0x05d43, 0x21de6, 0x05d6e, 0x05d6b,
+	0x05d7c, 0x05de1, 0x05de2, 0x0382f, 0x05dfd, 0x05e28, 0x05e3d, 0x05e69,
+	0x03862, 0x22183, 0x0387c, 0x05eb0, 0x05eb3, 0x05eb6, 0x05eca, 0x2a392,
+	0x05efe, 0x22331, 0x22331, 0x08201, 0x05f22, 0x05f22, 0x038c7, 0x232b8,
+	0x261da, 0x05f62, 0x05f6b, 0x038e3, 0x05f9a, 0x05fcd, 0x05fd7, 0x05ff9,
+	0x06081, 0x0393a, 0x0391c, 0x06094, 0x226d4, 0x060c7, 0x06148, 0x0614c,
+	0x0614e, 0x0614c, 0x0617a, 0x0618e, 0x061b2, 0x061a4, 0x061af, 0x061de,
+	0x061f2, 0x061f6, 0x06210, 0x0621b, 0x0625d, 0x062b1, 0x062d4, 0x06350,
+	0x22b0c, 0x0633d, 0x062fc, 0x06368, 0x06383, 0x063e4, 0x22bf1, 0x06422,
+	0x063c5, 0x063a9, 0x03a2e, 0x06469, 0x0647e, 0x0649d, 0x06477, 0x03a6c,
+	0x0654f, 0x0656c, 0x2300a, 0x065e3, 0x066f8, 0x06649, 0x03b19, 0x06691,
+	0x03b08, 0x03ae4, 0x05192, 0x05195, 0x06700, 0x0669c, 0x080ad, 0x043d9,
+	0x06717, 0x0671b, 0x06721, 0x0675e, 0x06753, 0x233c3, 0x03b49, 0x067fa,
+	0x06785, 0x06852, 0x06885, 0x2346d, 0x0688e, 0x0681f, 0x06914, 0x03b9d,
+	0x06942, 0x069a3, 0x069ea, 0x06aa8, 0x236a3, 0x06adb, 0x03c18, 0x06b21,
+	0x238a7, 0x06b54, 0x03c4e, 0x06b72, 0x06b9f, 0x06bba, 0x06bbb, 0x23a8d,
+	0x21d0b, 0x23afa, 0x06c4e, 0x23cbc, 0x06cbf, 0x06ccd, 0x06c67, 0x06d16,
+	0x06d3e, 0x06d77, 0x06d41, 0x06d69, 0x06d78, 0x06d85, 0x23d1e, 0x06d34,
+	0x06e2f, 0x06e6e, 0x03d33, 0x06ecb, 0x06ec7, 0x23ed1, 0x06df9, 0x06f6e,
+	0x23f5e, 0x23f8e, 0x06fc6, 0x07039, 0x0701e, 0x0701b, 0x03d96, 0x0704a,
+	0x0707d, 0x07077, 0x070ad, 0x20525, 0x07145, 0x24263, 0x0719c, 0x243ab,
+	0x07228, 0x07235, 0x07250, 0x24608, 0x07280, 0x07295, 0x24735, 0x24814,
+	0x0737a, 0x0738b, 0x03eac, 0x073a5, 0x03eb8, 0x03eb8, 0x07447, 0x0745c,
+	0x07471, 0x07485, 0x074ca, 0x03f1b, 0x07524, 0x24c36, 0x0753e, 0x24c92,
+	0x07570, 0x2219f, 0x07610, 0x24fa1, 0x24fb8, 0x25044, 0x03ffc, 0x04008,
+	0x076f4, 0x250f3, 0x250f2, 0x25119, 0x25133, 0x0771e, 0x0771f, 0x0771f,
+	0x0774a, 0x04039, 0x0778b, 0x04046, 0x04096, 0x2541d, 0x0784e, 0x0788c,
+	0x078cc, 0x040e3, 0x25626, 0x07956, 0x2569a, 0x256c5, 0x0798f, 0x079eb,
+	0x0412f, 0x07a40, 0x07a4a, 0x07a4f, 0x2597c, 0x25aa7, 0x25aa7, 0x07aee,
+	0x04202, 0x25bab, 0x07bc6, 0x07bc9, 0x04227, 0x25c80, 0x07cd2, 0x042a0,
+	0x07ce8, 0x07ce3, 0x07d00, 0x25f86, 0x07d63, 0x04301, 0x07dc7, 0x07e02,
+	0x07e45, 0x04334, 0x26228, 0x26247, 0x04359, 0x262d9, 0x07f7a, 0x2633e,
+	0x07f95, 0x07ffa, 0x08005, 0x264da, 0x26523, 0x08060, 0x265a8, 0x08070,
+	0x2335f, 0x043d5, 0x080b2, 0x08103, 0x0440b, 0x0813e, 0x05ab5, 0x267a7,
+	0x267b5, 0x23393, 0x2339c, 0x08201, 0x08204, 0x08f9e, 0x0446b, 0x08291,
+	0x0828b, 0x0829d, 0x052b3, 0x082b1, 0x082b3, 0x082bd, 0x082e6, 0x26b3c,
+	0x082e5, 0x0831d, 0x08363, 0x083ad, 0x08323, 0x083bd, 0x083e7, 0x08457,
+	0x08353, 0x083ca, 0x083cc, 0x083dc, 0x26c36, 0x26d6b, 0x26cd5, 0x0452b,
+	0x084f1, 0x084f3, 0x08516, 0x273ca, 0x08564, 0x26f2c, 0x0455d, 0x04561,
+	0x26fb1, 0x270d2, 0x0456b, 0x08650, 0x0865c, 0x08667, 0x08669, 0x086a9,
+	0x08688, 0x0870e, 0x086e2, 0x08779, 0x08728, 0x0876b, 0x08786, 0x045d7,
+	0x087e1, 0x08801, 0x045f9, 0x08860, 0x08863, 0x27667, 0x088d7, 0x088de,
+	0x04635, 0x088fa, 0x034bb, 0x278ae, 0x27966, 0x046be, 0x046c7, 0x08aa0,
+	0x08aed, 0x08b8a, 0x08c55, 0x27ca8, 0x08cab, 0x08cc1, 0x08d1b, 0x08d77,
+	0x27f2f, 0x20804, 0x08dcb, 0x08dbc, 0x08df0, 0x208de, 0x08ed4, 0x08f38,
+	0x285d2, 0x285ed, 0x09094, 0x090f1, 0x09111, 0x2872e, 0x0911b, 0x09238,
+	0x092d7, 0x092d8, 0x0927c, 0x093f9, 0x09415, 0x28bfa, 0x0958b, 0x04995,
+	0x095b7, 0x28d77, 0x049e6, 0x096c3, 0x05db2, 0x09723, 0x29145, 0x2921a,
+	0x04a6e, 0x04a76, 0x097e0, 0x2940a, 0x04ab2, 0x29496, 0x0980b, 0x0980b,
+	0x09829, 0x295b6, 0x098e2, 0x04b33, 0x09929, 0x099a7, 0x099c2, 0x099fe,
+	0x04bce, 0x29b30, 0x09b12, 0x09c40, 0x09cfd, 0x04cce, 0x04ced, 0x09d67,
+	0x2a0ce, 0x04cf8, 0x2a105, 0x2a20e, 0x2a291, 0x09ebb, 0x04d56, 0x09ef9,
+	0x09efe, 0x09f05, 0x09f0f, 0x09f16, 0x09f3b, 0x2a600,
+};
+
+const size_t nfc_ncomp = 941;
+
+const uint32_t nfc_comp[941][3] = {
+	{ 0x0003c, 0x00338, 0x0226e }, { 0x0003d, 0x00338, 0x02260 },
+	{ 0x0003e, 0x00338, 0x0226f }, { 0x00041, 0x00300, 0x000c0 },
+	{ 0x00041, 0x00301, 0x000c1 }, { 0x00041, 0x00302, 0x000c2 },
+	{ 0x00041, 0x00303, 0x000c3 }, { 0x00041, 0x00304, 0x00100 },
+	{ 0x00041, 0x00306, 0x00102 }, { 0x00041, 0x00307, 0x00226 },
+	{ 0x00041, 0x00308, 0x000c4 }, { 0x00041, 0x00309, 0x01ea2 },
+	{ 0x00041, 0x0030a, 0x000c5 }, { 0x00041, 0x0030c, 0x001cd },
+	{ 0x00041, 0x0030f, 0x00200 }, { 0x00041, 0x00311, 0x00202 },
+	{ 0x00041, 0x00323, 0x01ea0 }, { 0x00041, 0x00325, 0x01e00 },
+	{ 0x00041, 0x00328, 0x00104 }, { 0x00042, 0x00307, 0x01e02 },
+	{ 0x00042, 0x00323, 0x01e04 }, { 0x00042, 0x00331, 0x01e06 },
+	{ 0x00043, 0x00301, 0x00106 }, { 0x00043, 0x00302, 0x00108 },
+	{ 0x00043, 0x00307, 0x0010a }, { 0x00043, 0x0030c, 0x0010c },
+	{ 0x00043, 0x00327, 0x000c7 }, { 0x00044, 0x00307, 0x01e0a },
+	{ 0x00044, 0x0030c, 0x0010e }, { 0x00044, 0x00323, 0x01e0c },
+	{ 0x00044, 0x00327, 0x01e10 }, { 0x00044, 0x0032d, 0x01e12 },
+	{ 0x00044, 0x00331, 0x01e0e }, { 0x00045, 0x00300, 0x000c8 },
+	{ 0x00045, 0x00301, 0x000c9 }, { 0x00045, 0x00302, 0x000ca },
+	{ 0x00045, 0x00303, 0x01ebc }, { 0x00045, 0x00304, 0x00112 },
+	{ 0x00045, 0x00306, 0x00114 }, { 0x00045, 0x00307, 0x00116 },
+	{ 0x00045, 0x00308, 0x000cb }, { 0x00045, 0x00309, 0x01eba },
+	{ 0x00045, 0x0030c, 0x0011a }, { 0x00045, 0x0030f, 0x00204 },
+	{ 0x00045, 0x00311, 0x00206 }, { 0x00045, 0x00323, 0x01eb8 },
+	{ 0x00045, 0x00327, 0x00228 }, { 0x00045, 0x00328, 0x00118 },
+	{ 0x00045, 0x0032d, 0x01e18 }, { 0x00045, 0x00330, 0x01e1a },
+	{ 0x00046, 0x00307, 0x01e1e }, { 0x00047, 0x00301, 0x001f4 },
+	{ 0x00047, 0x00302, 0x0011c }, { 0x00047, 0x00304, 0x01e20 },
+	{ 0x00047, 0x00306, 0x0011e }, { 0x00047, 0x00307, 0x00120 },
+	{ 0x00047, 0x0030c, 0x001e6 }, { 0x00047, 0x00327, 0x00122 },
+	{ 0x00048, 0x00302, 0x00124 }, { 0x00048, 0x00307, 0x01e22 },
+	{ 0x00048, 0x00308, 0x01e26 }, { 0x00048, 0x0030c, 0x0021e },
+	{ 0x00048, 0x00323, 0x01e24 }, { 0x00048, 0x00327, 0x01e28 },
+	{ 0x00048, 0x0032e, 0x01e2a }, { 0x00049, 0x00300, 0x000cc },
+	{ 0x00049, 0x00301, 0x000cd }, { 0x00049, 0x00302, 0x000ce },
+	{ 0x00049, 0x00303, 0x00128 }, { 0x00049, 0x00304, 0x0012a },
+	{ 0x00049, 0x00306, 0x0012c }, { 0x00049, 0x00307, 0x00130 },
+	{ 0x00049, 0x00308, 0x000cf }, { 0x00049, 0x00309, 0x01ec8 },
+	{ 0x00049, 0x0030c, 0x001cf }, { 0x00049, 0x0030f, 0x00208 },
+	{ 0x00049, 0x00311, 0x0020a }, { 0x00049, 0x00323, 0x01eca },
+	{ 0x00049, 0x00328, 0x0012e }, { 0x00049, 0x00330, 0x01e2c },
+	{ 0x0004a, 0x00302, 0x00134 }, { 0x0004b, 0x00301, 0x01e30 },
+	{ 0x0004b, 0x0030c, 0x001e8 }, { 0x0004b, 0x00323, 0x01e32 },
+	{ 0x0004b, 0x00327, 0x00136 }, { 0x0004b, 0x00331, 0x01e34 },
+	{ 0x0004c, 0x00301, 0x00139 }, { 0x0004c, 0x0030c, 0x0013d },
+	{ 0x0004c, 0x00323, 0x01e36 }, { 0x0004c, 0x00327, 0x0013b },
+	{ 0x0004c, 0x0032d, 0x01e3c }, { 0x0004c, 0x00331, 0x01e3a },
+	{ 0x0004d, 0x00301, 0x01e3e }, { 0x0004d, 0x00307, 0x01e40 },
+	{ 0x0004d, 0x00323, 0x01e42 }, { 0x0004e, 0x00300, 0x001f8 },
+	{ 0x0004e, 0x00301, 0x00143 }, { 0x0004e, 0x00303, 0x000d1 },
+	{ 0x0004e, 0x00307, 0x01e44 }, { 0x0004e, 0x0030c, 0x00147 },
+	{ 0x0004e, 0x00323, 0x01e46 }, { 0x0004e, 0x00327, 0x00145 },
+	{ 0x0004e, 0x0032d, 0x01e4a }, { 0x0004e, 0x00331, 0x01e48 },
+	{ 0x0004f, 0x00300, 0x000d2 }, { 0x0004f, 0x00301, 0x000d3 },
+	{ 0x0004f, 0x00302, 0x000d4 }, { 0x0004f, 0x00303, 0x000d5 },
+	{ 0x0004f, 0x00304, 0x0014c }, { 0x0004f, 0x00306, 0x0014e },
+	{ 0x0004f, 0x00307, 0x0022e }, { 0x0004f, 0x00308, 0x000d6 },
+	{ 0x0004f, 0x00309, 0x01ece }, { 0x0004f, 0x0030b, 0x00150 },
+	{ 0x0004f, 0x0030c, 0x001d1 }, { 0x0004f, 0x0030f, 0x0020c },
+	{ 0x0004f, 0x00311, 0x0020e }, { 0x0004f, 0x0031b, 0x001a0 },
+	{ 0x0004f, 0x00323, 0x01ecc }, { 0x0004f, 0x00328, 0x001ea },
+	{ 0x00050, 0x00301, 0x01e54 }, { 0x00050, 0x00307, 0x01e56 },
+	{ 0x00052, 0x00301, 0x00154 }, { 0x00052, 0x00307, 0x01e58 },
+	{ 0x00052, 0x0030c, 0x00158 }, { 0x00052, 0x0030f, 0x00210 },
+	{ 0x00052, 0x00311, 0x00212 }, { 0x00052, 0x00323, 0x01e5a },
+	{ 0x00052, 0x00327, 0x00156 }, { 0x00052, 0x00331, 0x01e5e },
+	{ 0x00053, 0x00301, 0x0015a }, { 0x00053, 0x00302, 0x0015c },
+	{ 0x00053, 0x00307, 0x01e60 }, { 0x00053, 0x0030c, 0x00160 },
+	{ 0x00053, 0x00323, 0x01e62 }, { 0x00053, 0x00326, 0x00218 },
+	{ 0x00053, 0x00327, 0x0015e }, { 0x00054, 0x00307, 0x01e6a },
+	{ 0x00054, 0x0030c, 0x00164 }, { 0x00054, 0x00323, 0x01e6c },
+	{ 0x00054, 0x00326, 0x0021a }, { 0x00054, 0x00327, 0x00162 },
+	{ 0x00054, 0x0032d, 0x01e70 }, { 0x00054, 0x00331, 0x01e6e },
+	{ 0x00055, 0x00300, 0x000d9 }, { 0x00055, 0x00301, 0x000da },
+	{ 0x00055, 0x00302, 0x000db }, { 0x00055, 0x00303, 0x00168 },
+	{ 0x00055, 0x00304, 0x0016a }, { 0x00055, 0x00306, 0x0016c },
+	{ 0x00055, 0x00308, 0x000dc }, { 0x00055, 0x00309, 0x01ee6 },
+	{ 0x00055, 0x0030a, 0x0016e }, { 0x00055, 0x0030b, 0x00170 },
+	{ 0x00055, 0x0030c, 0x001d3 }, { 0x00055, 0x0030f, 0x00214 },
+	{ 0x00055, 0x00311, 0x00216 }, { 0x00055, 0x0031b, 0x001af },
+	{ 0x00055, 0x00323, 0x01ee4 }, { 0x00055, 0x00324, 0x01e72 },
+	{ 0x00055, 0x00328, 0x00172 }, { 0x00055, 0x0032d, 0x01e76 },
+	{ 0x00055, 0x00330, 0x01e74 }, { 0x00056, 0x00303, 0x01e7c },
+	{ 0x00056, 0x00323, 0x01e7e }, { 0x00057, 0x00300, 0x01e80 },
+	{ 0x00057, 0x00301, 0x01e82 }, { 0x00057, 0x00302, 0x00174 },
+	{ 0x00057, 0x00307, 0x01e86 }, { 0x00057, 0x00308, 0x01e84 },
+	{ 0x00057, 0x00323, 0x01e88 }, { 0x00058, 0x00307, 0x01e8a },
+	{ 0x00058, 0x00308, 0x01e8c }, { 0x00059, 0x00300, 0x01ef2 },
+	{ 0x00059, 0x00301, 0x000dd }, { 0x00059, 0x00302, 0x00176 },
+	{ 0x00059, 0x00303, 0x01ef8 }, { 0x00059, 0x00304, 0x00232 },
+	{ 0x00059, 0x00307, 0x01e8e }, { 0x00059, 0x00308, 0x00178 },
+	{ 0x00059, 0x00309, 0x01ef6 }, { 0x00059, 0x00323, 0x01ef4 },
+	{ 0x0005a, 0x00301, 0x00179 }, { 0x0005a, 0x00302, 0x01e90 },
+	{ 0x0005a, 0x00307, 0x0017b }, { 0x0005a, 0x0030c, 0x0017d },
+	{ 0x0005a, 0x00323, 0x01e92 }, { 0x0005a, 0x00331, 0x01e94 },
+	{ 0x00061, 0x00300, 0x000e0 }, { 0x00061, 0x00301, 0x000e1 },
+	{ 0x00061, 0x00302, 0x000e2 }, { 0x00061, 0x00303, 0x000e3 },
+	{ 0x00061, 0x00304, 0x00101 }, { 0x00061, 0x00306, 0x00103 },
+	{ 0x00061, 0x00307, 0x00227 }, { 0x00061, 0x00308, 0x000e4 },
+	{ 0x00061, 0x00309, 0x01ea3 }, { 0x00061, 0x0030a, 0x000e5 },
+	{ 0x00061, 0x0030c, 0x001ce }, { 0x00061, 0x0030f, 0x00201 },
+	{ 0x00061, 0x00311, 0x00203 }, { 0x00061, 0x00323, 0x01ea1 },
+	{ 0x00061, 0x00325, 0x01e01 }, { 0x00061, 0x00328, 0x00105 },
+	{ 0x00062, 0x00307, 0x01e03 }, { 0x00062, 0x00323, 0x01e05 },
+	{ 0x00062, 0x00331, 0x01e07 }, { 0x00063, 0x00301, 0x00107 },
+	{ 0x00063, 0x00302, 0x00109 }, { 0x00063, 0x00307, 0x0010b },
+	{ 0x00063, 0x0030c, 0x0010d }, { 0x00063, 0x00327, 0x000e7 },
+	{ 0x00064, 0x00307, 0x01e0b }, { 0x00064, 0x0030c, 0x0010f },
+	{ 0x00064, 0x00323, 0x01e0d }, { 0x00064, 0x00327, 0x01e11 },
+	{ 0x00064, 0x0032d, 0x01e13 }, { 0x00064, 0x00331, 0x01e0f },
+	{ 0x00065, 0x00300, 0x000e8 }, { 0x00065, 0x00301, 0x000e9 },
+	{ 0x00065, 0x00302, 0x000ea }, { 0x00065, 0x00303, 0x01ebd },
+	{ 0x00065, 0x00304, 0x00113 }, { 0x00065, 0x00306, 0x00115 },
+	{ 0x00065, 0x00307, 0x00117 }, { 0x00065, 0x00308, 0x000eb },
+	{ 0x00065, 0x00309, 0x01ebb }, { 0x00065, 0x0030c, 0x0011b },
+	{ 0x00065, 0x0030f, 0x00205 }, { 0x00065, 0x00311, 0x00207 },
+	{ 0x00065, 0x00323, 0x01eb9 }, { 0x00065, 0x00327, 0x00229 },
+	{ 0x00065, 0x00328, 0x00119 }, { 0x00065, 0x0032d, 0x01e19 },
+	{ 0x00065, 0x00330, 0x01e1b }, { 0x00066, 0x00307, 0x01e1f },
+	{ 0x00067, 0x00301, 0x001f5 }, { 0x00067, 0x00302, 0x0011d },
+	{ 0x00067, 0x00304, 0x01e21 }, { 0x00067, 0x00306, 0x0011f },
+	{ 0x00067, 0x00307, 0x00121 }, { 0x00067, 0x0030c, 0x001e7 },
+	{ 0x00067, 0x00327, 0x00123 }, { 0x00068, 0x00302, 0x00125 },
+	{ 0x00068, 0x00307, 0x01e23 }, { 0x00068, 0x00308, 0x01e27 },
+	{ 0x00068, 0x0030c, 0x0021f }, { 0x00068, 0x00323, 0x01e25 },
+	{ 0x00068, 0x00327, 0x01e29 }, { 0x00068, 0x0032e, 0x01e2b },
+	{ 0x00068, 0x00331, 0x01e96 }, { 0x00069, 0x00300, 0x000ec },
+	{ 0x00069, 0x00301, 0x000ed }, { 0x00069, 0x00302, 0x000ee },
+	{ 0x00069, 0x00303, 0x00129 }, { 0x00069, 0x00304, 0x0012b },
+	{ 0x00069, 0x00306, 0x0012d }, { 0x00069, 0x00308, 0x000ef },
+	{ 0x00069, 0x00309, 0x01ec9 }, { 0x00069, 0x0030c, 0x001d0 },
+	{ 0x00069, 0x0030f, 0x00209 }, { 0x00069, 0x00311, 0x0020b },
+	{ 0x00069, 0x00323, 0x01ecb }, { 0x00069, 0x00328, 0x0012f },
+	{ 0x00069, 0x00330, 0x01e2d }, { 0x0006a, 0x00302, 0x00135 },
+	{ 0x0006a, 0x0030c, 0x001f0 }, { 0x0006b, 0x00301, 0x01e31 },
+	{ 0x0006b, 0x0030c, 0x001e9 }, { 0x0006b, 0x00323, 0x01e33 },
+	{ 0x0006b, 0x00327, 0x00137 }, { 0x0006b, 0x00331, 0x01e35 },
+	{ 0x0006c, 0x00301, 0x0013a }, { 0x0006c, 0x0030c, 0x0013e },
+	{ 0x0006c, 0x00323, 0x01e37 }, { 0x0006c, 0x00327, 0x0013c },
+	{ 0x0006c, 0x0032d, 0x01e3d }, { 0x0006c, 0x00331, 0x01e3b },
+	{ 0x0006d, 0x00301, 0x01e3f }, { 0x0006d, 0x00307, 0x01e41 },
+	{ 0x0006d, 0x00323, 0x01e43 }, { 0x0006e, 0x00300, 0x001f9 },
+	{ 0x0006e, 0x00301, 0x00144 }, { 0x0006e, 0x00303, 0x000f1 },
+	{ 0x0006e, 0x00307, 0x01e45 }, { 0x0006e, 0x0030c, 0x00148 },
+	{ 0x0006e, 0x00323, 0x01e47 }, { 0x0006e, 0x00327, 0x00146 },
+	{ 0x0006e, 0x0032d, 0x01e4b }, { 0x0006e, 0x00331, 0x01e49 },
+	{ 0x0006f, 0x00300, 0x000f2 }, { 0x0006f, 0x00301, 0x000f3 },
+	{ 0x0006f, 0x00302, 0x000f4 }, { 0x0006f, 0x00303, 0x000f5 },
+	{ 0x0006f, 0x00304, 0x0014d }, { 0x0006f, 0x00306, 0x0014f },
+	{ 0x0006f, 0x00307, 0x0022f }, { 0x0006f, 0x00308, 0x000f6 },
+	{ 0x0006f, 0x00309, 0x01ecf }, { 0x0006f, 0x0030b, 0x00151 },
+	{ 0x0006f, 0x0030c, 0x001d2 }, { 0x0006f, 0x0030f, 0x0020d },
+	{ 0x0006f, 0x00311, 0x0020f }, { 0x0006f, 0x0031b, 0x001a1 },
+	{ 0x0006f, 0x00323, 0x01ecd }, { 0x0006f, 0x00328, 0x001eb },
+	{ 0x00070, 0x00301, 0x01e55 }, { 0x00070, 0x00307, 0x01e57 },
+	{ 0x00072, 0x00301, 0x00155 }, { 0x00072, 0x00307, 0x01e59 },
+	{ 0x00072, 0x0030c, 0x00159 }, { 0x00072, 0x0030f, 0x00211 },
+	{ 0x00072, 0x00311, 0x00213 }, { 0x00072, 0x00323, 0x01e5b },
+	{ 0x00072, 0x00327, 0x00157 }, { 0x00072, 0x00331, 0x01e5f },
+	{ 0x00073, 0x00301, 0x0015b }, { 0x00073, 0x00302, 0x0015d },
+	{ 0x00073, 0x00307, 0x01e61 }, { 0x00073, 0x0030c, 0x00161 },
+	{ 0x00073, 0x00323, 0x01e63 }, { 0x00073, 0x00326, 0x00219 },
+	{ 0x00073, 0x00327, 0x0015f }, { 0x00074, 0x00307, 0x01e6b },
+	{ 0x00074, 0x00308, 0x01e97 }, { 0x00074, 0x0030c, 0x00165 },
+	{ 0x00074, 0x00323, 0x01e6d }, { 0x00074, 0x00326, 0x0021b },
+	{ 0x00074, 0x00327, 0x00163 }, { 0x00074, 0x0032d, 0x01e71 },
+	{ 0x00074, 0x00331, 0x01e6f }, { 0x00075, 0x00300, 0x000f9 },
+	{ 0x00075, 0x00301, 0x000fa }, { 0x00075, 0x00302, 0x000fb },
+	{ 0x00075, 0x00303, 0x00169 }, { 0x00075, 0x00304, 0x0016b },
+	{ 0x00075, 0x00306, 0x0016d }, { 0x00075, 0x00308, 0x000fc },
+	{ 0x00075, 0x00309, 0x01ee7 }, { 0x00075, 0x0030a, 0x0016f },
+	{ 0x00075, 0x0030b, 0x00171 }, { 0x00075, 0x0030c, 0x001d4 },
+	{ 0x00075, 0x0030f, 0x00215 }, { 0x00075, 0x00311, 0x00217 },
+	{ 0x00075, 0x0031b, 0x001b0 }, { 0x00075, 0x00323, 0x01ee5 },
+	{ 0x00075, 0x00324, 0x01e73 }, { 0x00075, 0x00328, 0x00173 },
+	{ 0x00075, 0x0032d, 0x01e77 }, { 0x00075, 0x00330, 0x01e75 },
+	{ 0x00076, 0x00303, 0x01e7d }, { 0x00076, 0x00323, 0x01e7f },
+	{ 0x00077, 0x00300, 0x01e81 }, { 0x00077, 0x00301, 0x01e83 },
+	{ 0x00077, 0x00302, 0x00175 }, { 0x00077, 0x00307, 0x01e87 },
+	{ 0x00077, 0x00308, 0x01e85 }, { 0x00077, 0x0030a, 0x01e98 },
+	{ 0x00077, 0x00323, 0x01e89 }, { 0x00078, 0x00307, 0x01e8b },
+	{ 0x00078, 0x00308, 0x01e8d }, { 0x00079, 0x00300, 0x01ef3 },
+	{ 0x00079, 0x00301, 0x000fd }, { 0x00079, 0x00302, 0x00177 },
+	{ 0x00079, 0x00303, 0x01ef9 }, { 0x00079, 0x00304, 0x00233 },
+	{ 0x00079, 0x00307, 0x01e8f }, { 0x00079, 0x00308, 0x000ff },
+	{ 0x00079, 0x00309, 0x01ef7 }, { 0x00079, 0x0030a, 0x01e99 },
+	{ 0x00079, 0x00323, 0x01ef5 }, { 0x0007a, 0x00301, 0x0017a },
+	{ 0x0007a, 0x00302, 0x01e91 }, { 0x0007a, 0x00307, 0x0017c },
+	{ 0x0007a, 0x0030c, 0x0017e }, { 0x0007a, 0x00323, 0x01e93 },
+	{ 0x0007a, 0x00331, 0x01e95 }, { 0x000a8, 0x00300, 0x01fed },
+	{ 0x000a8, 0x00301, 0x00385 }, { 0x000a8, 0x00342, 0x01fc1 },
+	{ 0x000c2, 0x00300, 0x01ea6 }, { 0x000c2, 0x00301, 0x01ea4 },
+	{ 0x000c2, 0x00303, 0x01eaa }, { 0x000c2, 0x00309, 0x01ea8 },
+	{ 0x000c4, 0x00304, 0x001de }, { 0x000c5, 0x00301, 0x001fa },
+	{ 0x000c6, 0x00301, 0x001fc }, { 0x000c6, 0x00304, 0x001e2 },
+	{ 0x000c7, 0x00301, 0x01e08 }, { 0x000ca, 0x00300, 0x01ec0 },
+	{ 0x000ca, 0x00301, 0x01ebe }, { 0x000ca, 0x00303, 0x01ec4 },
+	{ 0x000ca, 0x00309, 0x01ec2 }, { 0x000cf, 0x00301, 0x01e2e },
+	{ 0x000d4, 0x00300, 0x01ed2 }, { 0x000d4, 0x00301, 0x01ed0 },
+	{ 0x000d4, 0x00303, 0x01ed6 }, { 0x000d4, 0x00309, 0x01ed4 },
+	{ 0x000d5, 0x00301, 0x01e4c }, { 0x000d5, 0x00304, 0x0022c },
+	{ 0x000d5, 0x00308, 0x01e4e }, { 0x000d6, 0x00304, 0x0022a },
+	{ 0x000d8, 0x00301, 0x001fe }, { 0x000dc, 0x00300, 0x001db },
+	{ 0x000dc, 0x00301, 0x001d7 }, { 0x000dc, 0x00304, 0x001d5 },
+	{ 0x000dc, 0x0030c, 0x001d9 }, { 0x000e2, 0x00300, 0x01ea7 },
+	{ 0x000e2, 0x00301, 0x01ea5 }, { 0x000e2, 0x00303, 0x01eab },
+	{ 0x000e2, 0x00309, 0x01ea9 }, { 0x000e4, 0x00304, 0x001df },
+	{ 0x000e5, 0x00301, 0x001fb }, { 0x000e6, 0x00301, 0x001fd },
+	{ 0x000e6, 0x00304, 0x001e3 }, { 0x000e7, 0x00301, 0x01e09 },
+	{ 0x000ea, 0x00300, 0x01ec1 }, { 0x000ea, 0x00301, 0x01ebf },
+	{ 0x000ea, 0x00303, 0x01ec5 }, { 0x000ea, 0x00309, 0x01ec3 },
+	{ 0x000ef, 0x00301, 0x01e2f }, { 0x000f4, 0x00300, 0x01ed3 },
+	{ 0x000f4, 0x00301, 0x01ed1 }, { 0x000f4, 0x00303, 0x01ed7 },
+	{ 0x000f4, 0x00309, 0x01ed5 }, { 0x000f5, 0x00301, 0x01e4d },
+	{ 0x000f5, 0x00304, 0x0022d }, { 0x000f5, 0x00308, 0x01e4f },
+	{ 0x000f6, 0x00304, 0x0022b }, { 0x000f8, 0x00301, 0x001ff },
+	{ 0x000fc, 0x00300, 0x001dc }, { 0x000fc, 0x00301, 0x001d8 },
+	{ 0x000fc, 0x00304, 0x001d6 }, { 0x000fc, 0x0030c, 0x001da },
+	{ 0x00102, 0x00300, 0x01eb0 }, { 0x00102, 0x00301, 0x01eae },
+	{ 0x00102, 0x00303, 0x01eb4 }, { 0x00102, 0x00309, 0x01eb2 },
+	{ 0x00103, 0x00300, 0x01eb1 }, { 0x00103, 0x00301, 0x01eaf },
+	{ 0x00103, 0x00303, 0x01eb5 }, { 0x00103, 0x00309, 0x01eb3 },
+	{ 0x00112, 0x00300, 0x01e14 }, { 0x00112, 0x00301, 0x01e16 },
+	{ 0x00113, 0x00300, 0x01e15 }, { 0x00113, 0x00301, 0x01e17 },
+	{ 0x0014c, 0x00300, 0x01e50 }, { 0x0014c, 0x00301, 0x01e52 },
+	{ 0x0014d, 0x00300, 0x01e51 }, { 0x0014d, 0x00301, 0x01e53 },
+	{ 0x0015a, 0x00307, 0x01e64 }, { 0x0015b, 0x00307, 0x01e65 },
+	{ 0x00160, 0x00307, 0x01e66 }, { 0x00161, 0x00307, 0x01e67 },
+	{ 0x00168, 0x00301, 0x01e78 }, { 0x00169, 0x00301, 0x01e79 },
+	{ 0x0016a, 0x00308, 0x01e7a }, { 0x0016b, 0x00308, 0x01e7b },
+	{ 0x0017f, 0x00307, 0x01e9b }, { 0x001a0, 0x00300, 0x01edc },
+	{ 0x001a0, 0x00301, 0x01eda }, { 0x001a0, 0x00303, 0x01ee0 },
+	{ 0x001a0, 0x00309, 0x01ede }, { 0x001a0, 0x00323, 0x01ee2 },
+	{ 0x001a1, 0x00300, 0x01edd }, { 0x001a1, 0x00301, 0x01edb },
+	{ 0x001a1, 0x00303, 0x01ee1 }, { 0x001a1, 0x00309, 0x01edf },
+	{ 0x001a1, 0x00323, 0x01ee3 }, { 0x001af, 0x00300, 0x01eea },
+	{ 0x001af, 0x00301, 0x01ee8 }, { 0x001af, 0x00303, 0x01eee },
+	{ 0x001af, 0x00309, 0x01eec }, { 0x001af, 0x00323, 0x01ef0 },
+	{ 0x001b0, 0x00300, 0x01eeb }, { 0x001b0, 0x00301, 0x01ee9 },
+	{ 0x001b0, 0x00303, 0x01eef }, { 0x001b0, 0x00309, 0x01eed },
+	{ 0x001b0, 0x00323, 0x01ef1 }, { 0x001b7, 0x0030c, 0x001ee },
+	{ 0x001ea, 0x00304, 0x001ec }, { 0x001eb, 0x00304, 0x001ed },
+	{ 0x00226, 0x00304, 0x001e0 }, { 0x00227, 0x00304, 0x001e1 },
+	{ 0x00228, 0x00306, 0x01e1c }, { 0x00229, 0x00306, 0x01e1d },
+	{ 0x0022e, 0x00304, 0x00230 }, { 0x0022f, 0x00304, 0x00231 },
+	{ 0x00292, 0x0030c, 0x001ef }, { 0x00391, 0x00300, 0x01fba },
+	{ 0x00391, 0x00301, 0x00386 }, { 0x00391, 0x00304, 0x01fb9 },
+	{ 0x00391, 0x00306, 0x01fb8 }, { 0x00391, 0x00313, 0x01f08 },
+	{ 0x00391, 0x00314, 0x01f09 }, { 0x00391, 0x00345, 0x01fbc },
+	{ 0x00395, 0x00300, 0x01fc8 }, { 0x00395, 0x00301, 0x00388 },
+	{ 0x00395, 0x00313, 0x01f18 }, { 0x00395, 0x00314, 0x01f19 },
+	{ 0x00397, 0x00300, 0x01fca }, { 0x00397, 0x00301, 0x00389 },
+	{ 0x00397, 0x00313, 0x01f28 }, { 0x00397, 0x00314, 0x01f29 },
+	{ 0x00397, 0x00345, 0x01fcc }, { 0x00399, 0x00300, 0x01fda },
+	{ 0x00399, 0x00301, 0x0038a }, { 0x00399, 0x00304, 0x01fd9 },
+	{ 0x00399, 0x00306, 0x01fd8 }, { 0x00399, 0x00308, 0x003aa },
+	{ 0x00399, 0x00313, 0x01f38 }, { 0x00399, 0x00314, 0x01f39 },
+	{ 0x0039f, 0x00300, 0x01ff8 }, { 0x0039f, 0x00301, 0x0038c },
+	{ 0x0039f, 0x00313, 0x01f48 }, { 0x0039f, 0x00314, 0x01f49 },
+	{ 0x003a1, 0x00314, 0x01fec }, { 0x003a5, 0x00300, 0x01fea },
+	{ 0x003a5, 0x00301, 0x0038e }, { 0x003a5, 0x00304, 0x01fe9 },
+	{ 0x003a5, 0x00306, 0x01fe8 }, { 0x003a5, 0x00308, 0x003ab },
+	{ 0x003a5, 0x00314, 0x01f59 }, { 0x003a9, 0x00300, 0x01ffa },
+	{ 0x003a9, 0x00301, 0x0038f }, { 0x003a9, 0x00313, 0x01f68 },
+	{ 0x003a9, 0x00314, 0x01f69 }, { 0x003a9, 0x00345, 0x01ffc },
+	{ 0x003ac, 0x00345, 0x01fb4 }, { 0x003ae, 0x00345, 0x01fc4 },
+	{ 0x003b1, 0x00300, 0x01f70 }, { 0x003b1, 0x00301, 0x003ac },
+	{ 0x003b1, 0x00304, 0x01fb1 }, { 0x003b1, 0x00306, 0x01fb0 },
+	{ 0x003b1, 0x00313, 0x01f00 }, { 0x003b1, 0x00314, 0x01f01 },
+	{ 0x003b1, 0x00342, 0x01fb6 }, { 0x003b1, 0x00345, 0x01fb3 },
+	{ 0x003b5, 0x00300, 0x01f72 }, { 0x003b5, 0x00301, 0x003ad },
+	{ 0x003b5, 0x00313, 0x01f10 }, { 0x003b5, 0x00314, 0x01f11 },
+	{ 0x003b7, 0x00300, 0x01f74 }, { 0x003b7, 0x00301, 0x003ae },
+	{ 0x003b7, 0x00313, 0x01f20 }, { 0x003b7, 0x00314, 0x01f21 },
+	{ 0x003b7, 0x00342, 0x01fc6 }, { 0x003b7, 0x00345, 0x01fc3 },
+	{ 0x003b9, 0x00300, 0x01f76 }, { 0x003b9, 0x00301, 0x003af },
+	{ 0x003b9, 0x00304, 0x01fd1 }, { 0x003b9, 0x00306, 0x01fd0 },
+	{ 0x003b9, 0x00308, 0x003ca }, { 0x003b9, 0x00313, 0x01f30 },
+	{ 0x003b9, 0x00314, 0x01f31 }, { 0x003b9, 0x00342, 0x01fd6 },
+	{ 0x003bf, 0x00300, 0x01f78 }, { 0x003bf, 0x00301, 0x003cc },
+	{ 0x003bf, 0x00313, 0x01f40 }, { 0x003bf, 0x00314, 0x01f41 },
+	{ 0x003c1, 0x00313, 0x01fe4 }, { 0x003c1, 0x00314, 0x01fe5 },
+	{ 0x003c5, 0x00300, 0x01f7a }, { 0x003c5, 0x00301, 0x003cd },
+	{ 0x003c5, 0x00304, 0x01fe1 }, { 0x003c5, 0x00306, 0x01fe0 },
+	{ 0x003c5, 0x00308, 0x003cb }, { 0x003c5, 0x00313, 0x01f50 },
+	{ 0x003c5, 0x00314, 0x01f51 }, { 0x003c5, 0x00342, 0x01fe6 },
+	{ 0x003c9, 0x00300, 0x01f7c }, { 0x003c9, 0x00301, 0x003ce },
+	{ 0x003c9, 0x00313, 0x01f60 }, { 0x003c9, 0x00314, 0x01f61 },
+	{ 0x003c9, 0x00342, 0x01ff6 }, { 0x003c9, 0x00345, 0x01ff3 },
+	{ 0x003ca, 0x00300, 0x01fd2 }, { 0x003ca, 0x00301, 0x00390 },
+	{ 0x003ca, 0x00342, 0x01fd7 }, { 0x003cb, 0x00300, 0x01fe2 },
+	{ 0x003cb, 0x00301, 0x003b0 }, { 0x003cb, 0x00342, 0x01fe7 },
+	{ 0x003ce, 0x00345, 0x01ff4 }, { 0x003d2, 0x00301, 0x003d3 },
+	{ 0x003d2, 0x00308, 0x003d4 }, { 0x00406, 0x00308, 0x00407 },
+	{ 0x00410, 0x00306, 0x004d0 }, { 0x00410, 0x00308, 0x004d2 },
+	{ 0x00413, 0x00301, 0x00403 }, { 0x00415, 0x00300, 0x00400 },
+	{ 0x00415, 0x00306, 0x004d6 }, { 0x00415, 0x00308, 0x00401 },
+	{ 0x00416, 0x00306, 0x004c1 }, { 0x00416, 0x00308, 0x004dc },
+	{ 0x00417, 0x00308, 0x004de }, { 0x00418, 0x00300, 0x0040d },
+	{ 0x00418, 0x00304, 0x004e2 }, { 0x00418, 0x00306, 0x00419 },
+	{ 0x00418, 0x00308, 0x004e4 }, { 0x0041a, 0x00301, 0x0040c },
+	{ 0x0041e, 0x00308, 0x004e6 }, { 0x00423, 0x00304, 0x004ee },
+	{ 0x00423, 0x00306, 0x0040e }, { 0x00423, 0x00308, 0x004f0 },
+	{ 0x00423, 0x0030b, 0x004f2 }, { 0x00427, 0x00308, 0x004f4 },
+	{ 0x0042b, 0x00308, 0x004f8 }, { 0x0042d, 0x00308, 0x004ec },
+	{ 0x00430, 0x00306, 0x004d1 }, { 0x00430, 0x00308, 0x004d3 },
+	{ 0x00433, 0x00301, 0x00453 }, { 0x00435, 0x00300, 0x00450 },
+	{ 0x00435, 0x00306, 0x004d7 }, { 0x00435, 0x00308, 0x00451 },
+	{ 0x00436, 0x00306, 0x004c2 }, { 0x00436, 0x00308, 0x004dd },
+	{ 0x00437, 0x00308, 0x004df }, { 0x00438, 0x00300, 0x0045d },
+	{ 0x00438, 0x00304, 0x004e3 }, { 0x00438, 0x00306, 0x00439 },
+	{ 0x00438, 0x00308, 0x004e5 }, { 0x0043a, 0x00301, 0x0045c },
+	{ 0x0043e, 0x00308, 0x004e7 }, { 0x00443, 0x00304, 0x004ef },
+	{ 0x00443, 0x00306, 0x0045e }, { 0x00443, 0x00308, 0x004f1 },
+	{ 0x00443, 0x0030b, 0x004f3 }, { 0x00447, 0x00308, 0x004f5 },
+	{ 0x0044b, 0x00308, 0x004f9 }, { 0x0044d, 0x00308, 0x004ed },
+	{ 0x00456, 0x00308, 0x00457 }, { 0x00474, 0x0030f, 0x00476 },
+	{ 0x00475, 0x0030f, 0x00477 }, { 0x004d8, 0x00308, 0x004da },
+	{ 0x004d9, 0x00308, 0x004db }, { 0x004e8, 0x00308, 0x004ea },
+	{ 0x004e9, 0x00308, 0x004eb }, { 0x00627, 0x00653, 0x00622 },
+	{ 0x00627, 0x00654, 0x00623 }, { 0x00627, 0x00655, 0x00625 },
+	{ 0x00648, 0x00654, 0x00624 }, { 0x0064a, 0x00654, 0x00626 },
+	{ 0x006c1, 0x00654, 0x006c2 }, { 0x006d2, 0x00654, 0x006d3 },
+	{ 0x006d5, 0x00654, 0x006c0 }, { 0x00928, 0x0093c, 0x00929 },
+	{ 0x00930, 0x0093c, 0x00931 }, { 0x00933, 0x0093c, 0x00934 },
+	{ 0x009c7, 0x009be, 0x009cb }, { 0x009c7, 0x009d7, 0x009cc },
+	{ 0x00b47, 0x00b3e, 0x00b4b }, { 0x00b47, 0x00b56, 0x00b48 },
+	{ 0x00b47, 0x00b57, 0x00b4c }, { 0x00b92, 0x00bd7, 0x00b94 },
+	{ 0x00bc6, 0x00bbe, 0x00bca }, { 0x00bc6, 0x00bd7, 0x00bcc },
+	{ 0x00bc7, 0x00bbe, 0x00bcb }, { 0x00c46, 0x00c56, 0x00c48 },
+	{ 0x00cbf, 0x00cd5, 0x00cc0 }, { 0x00cc6, 0x00cc2, 0x00cca },
+	{ 0x00cc6, 0x00cd5, 0x00cc7 }, { 0x00cc6, 0x00cd6, 0x00cc8 },
+	{ 0x00cca, 0x00cd5, 0x00ccb }, { 0x00d46, 0x00d3e, 0x00d4a },
+	{ 0x00d46, 0x00d57, 0x00d4c }, { 0x00d47, 0x00d3e, 0x00d4b },
+	{ 0x00dd9, 0x00dca, 0x00dda }, { 0x00dd9, 0x00dcf, 0x00ddc },
+	{ 0x00dd9, 0x00ddf, 0x00dde }, { 0x00ddc, 0x00dca, 0x00ddd },
+	{ 0x01025, 0x0102e, 0x01026 }, { 0x01b05, 0x01b35, 0x01b06 },
+	{ 0x01b07, 0x01b35, 0x01b08 }, { 0x01b09, 0x01b35, 0x01b0a },
+	{ 0x01b0b, 0x01b35, 0x01b0c }, { 0x01b0d, 0x01b35, 0x01b0e },
+	{ 0x01b11, 0x01b35, 0x01b12 }, { 0x01b3a, 0x01b35, 0x01b3b },
+	{ 0x01b3c, 0x01b35, 0x01b3d }, { 0x01b3e, 0x01b35, 0x01b40 },
+	{ 0x01b3f, 0x01b35, 0x01b41 }, { 0x01b42, 0x01b35, 0x01b43 },
+	{ 0x01e36, 0x00304, 0x01e38 }, { 0x01e37, 0x00304, 0x01e39 },
+	{ 0x01e5a, 0x00304, 0x01e5c }, { 0x01e5b, 0x00304, 0x01e5d },
+	{ 0x01e62, 0x00307, 0x01e68 }, { 0x01e63, 0x00307, 0x01e69 },
+	{ 0x01ea0, 0x00302, 0x01eac }, { 0x01ea0, 0x00306, 0x01eb6 },
+	{ 0x01ea1, 0x00302, 0x01ead }, { 0x01ea1, 0x00306, 0x01eb7 },
+	{ 0x01eb8, 0x00302, 0x01ec6 }, { 0x01eb9, 0x00302, 0x01ec7 },
+	{ 0x01ecc, 0x00302, 0x01ed8 }, { 0x01ecd, 0x00302, 0x01ed9 },
+	{ 0x01f00, 0x00300, 0x01f02 }, { 0x01f00, 0x00301, 0x01f04 },
+	{ 0x01f00, 0x00342, 0x01f06 }, { 0x01f00, 0x00345, 0x01f80 },
+	{ 0x01f01, 0x00300, 0x01f03 }, { 0x01f01, 0x00301, 0x01f05 },
+	{ 0x01f01, 0x00342, 0x01f07 }, { 0x01f01, 0x00345, 0x01f81 },
+	{ 0x01f02, 0x00345, 0x01f82 }, { 0x01f03, 0x00345, 0x01f83 },
+	{ 0x01f04, 0x00345, 0x01f84 }, { 0x01f05, 0x00345, 0x01f85 },
+	{ 0x01f06, 0x00345, 0x01f86 }, { 0x01f07, 0x00345, 0x01f87 },
+	{ 0x01f08, 0x00300, 0x01f0a }, { 0x01f08, 0x00301, 0x01f0c },
+	{ 0x01f08, 0x00342, 0x01f0e }, { 0x01f08, 0x00345, 0x01f88 },
+	{ 0x01f09, 0x00300, 0x01f0b }, { 0x01f09, 0x00301, 0x01f0d },
+	{ 0x01f09, 0x00342, 0x01f0f }, { 0x01f09, 0x00345, 0x01f89 },
+	{ 0x01f0a, 0x00345, 0x01f8a }, { 0x01f0b, 0x00345, 0x01f8b },
+	{ 0x01f0c, 0x00345, 0x01f8c }, { 0x01f0d, 0x00345, 0x01f8d },
+	{ 0x01f0e, 0x00345, 0x01f8e }, { 0x01f0f, 0x00345, 0x01f8f },
+	{ 0x01f10, 0x00300, 0x01f12 }, { 0x01f10, 0x00301, 0x01f14 },
+	{ 0x01f11, 0x00300, 0x01f13 }, { 0x01f11, 0x00301, 0x01f15 },
+	{ 0x01f18, 0x00300, 0x01f1a }, { 0x01f18, 0x00301, 0x01f1c },
+	{ 0x01f19, 0x00300, 0x01f1b }, { 0x01f19, 0x00301, 0x01f1d },
+	{ 0x01f20, 0x00300, 0x01f22 }, { 0x01f20, 0x00301, 0x01f24 },
+	{ 0x01f20, 0x00342, 0x01f26 }, { 0x01f20, 0x00345, 0x01f90 },
+	{ 0x01f21, 0x00300, 0x01f23 }, { 0x01f21, 0x00301, 0x01f25 },
+	{ 0x01f21, 0x00342, 0x01f27 }, { 0x01f21, 0x00345, 0x01f91 },
+	{ 0x01f22, 0x00345, 0x01f92 }, { 0x01f23, 0x00345, 0x01f93 },
+	{ 0x01f24, 0x00345, 0x01f94 }, { 0x01f25, 0x00345, 0x01f95 },
+	{ 0x01f26, 0x00345, 0x01f96 }, { 0x01f27, 0x00345, 0x01f97 },
+	{ 0x01f28, 0x00300, 0x01f2a }, { 0x01f28, 0x00301, 0x01f2c },
+	{ 0x01f28, 0x00342, 0x01f2e }, { 0x01f28, 0x00345, 0x01f98 },
+	{ 0x01f29, 0x00300, 0x01f2b }, { 0x01f29, 0x00301, 0x01f2d },
+	{ 0x01f29, 0x00342, 0x01f2f }, { 0x01f29, 0x00345, 0x01f99 },
+	{ 0x01f2a, 0x00345, 0x01f9a }, { 0x01f2b, 0x00345, 0x01f9b },
+	{ 0x01f2c, 0x00345, 0x01f9c }, { 0x01f2d, 0x00345, 0x01f9d },
+	{ 0x01f2e, 0x00345, 0x01f9e }, { 0x01f2f, 0x00345, 0x01f9f },
+	{ 0x01f30, 0x00300, 0x01f32 }, { 0x01f30, 0x00301, 0x01f34 },
+	{ 0x01f30, 0x00342, 0x01f36 }, { 0x01f31, 0x00300, 0x01f33 },
+	{ 0x01f31, 0x00301, 0x01f35 }, { 0x01f31, 0x00342, 0x01f37 },
+	{ 0x01f38, 0x00300, 0x01f3a }, { 0x01f38, 0x00301, 0x01f3c },
+	{ 0x01f38, 0x00342, 0x01f3e }, { 0x01f39, 0x00300, 0x01f3b },
+	{ 0x01f39, 0x00301, 0x01f3d }, { 0x01f39, 0x00342, 0x01f3f },
+	{ 0x01f40, 0x00300, 0x01f42 }, { 0x01f40, 0x00301, 0x01f44 },
+	{ 0x01f41, 0x00300, 0x01f43 }, { 0x01f41, 0x00301, 0x01f45 },
+	{ 0x01f48, 0x00300, 0x01f4a }, { 0x01f48, 0x00301, 0x01f4c },
+	{ 0x01f49, 0x00300, 0x01f4b }, { 0x01f49, 0x00301, 0x01f4d },
+	{ 0x01f50, 0x00300, 0x01f52 }, { 0x01f50, 0x00301, 0x01f54 },
+	{ 0x01f50, 0x00342, 0x01f56 }, { 0x01f51, 0x00300, 0x01f53 },
+	{ 0x01f51, 0x00301, 0x01f55 }, { 0x01f51, 0x00342, 0x01f57 },
+	{ 0x01f59, 0x00300, 0x01f5b }, { 0x01f59, 0x00301, 0x01f5d },
+	{ 0x01f59, 0x00342, 0x01f5f }, { 0x01f60, 0x00300, 0x01f62 },
+	{ 0x01f60, 0x00301, 0x01f64 }, { 0x01f60, 0x00342, 0x01f66 },
+	{ 0x01f60, 0x00345, 0x01fa0 }, { 0x01f61, 0x00300, 0x01f63 },
+	{ 0x01f61, 0x00301, 0x01f65 }, { 0x01f61, 0x00342, 0x01f67 },
+	{ 0x01f61, 0x00345, 0x01fa1 }, { 0x01f62, 0x00345, 0x01fa2 },
+	{ 0x01f63, 0x00345, 0x01fa3 }, { 0x01f64, 0x00345, 0x01fa4 },
+	{ 0x01f65, 0x00345, 0x01fa5 }, { 0x01f66, 0x00345, 0x01fa6 },
+	{ 0x01f67, 0x00345, 0x01fa7 }, { 0x01f68, 0x00300, 0x01f6a },
+	{ 0x01f68, 0x00301, 0x01f6c }, { 0x01f68, 0x00342, 0x01f6e },
+	{ 0x01f68, 0x00345, 0x01fa8 }, { 0x01f69, 0x00300, 0x01f6b },
+	{ 0x01f69, 0x00301, 0x01f6d }, { 0x01f69, 0x00342, 0x01f6f },
+	{ 0x01f69, 0x00345, 0x01fa9 }, { 0x01f6a, 0x00345, 0x01faa },
+	{ 0x01f6b, 0x00345, 0x01fab }, { 0x01f6c, 0x00345, 0x01fac },
+	{ 0x01f6d, 0x00345, 0x01fad }, { 0x01f6e, 0x00345, 0x01fae },
+	{ 0x01f6f, 0x00345, 0x01faf }, { 0x01f70, 0x00345, 0x01fb2 },
+	{ 0x01f74, 0x00345, 0x01fc2 }, { 0x01f7c, 0x00345, 0x01ff2 },
+	{ 0x01fb6, 0x00345, 0x01fb7 }, { 0x01fbf, 0x00300, 0x01fcd },
+	{ 0x01fbf, 0x00301, 0x01fce }, { 0x01fbf, 0x00342, 0x01fcf },
+	{ 0x01fc6, 0x00345, 0x01fc7 }, { 0x01ff6, 0x00345, 0x01ff7 },
+	{ 0x01ffe, 0x00300, 0x01fdd }, { 0x01ffe, 0x00301, 0x01fde },
+	{ 0x01ffe, 0x00342, 0x01fdf }, { 0x02190, 0x00338, 0x0219a },
+	{ 0x02192, 0x00338, 0x0219b }, { 0x02194, 0x00338, 0x021ae },
+	{ 0x021d0, 0x00338, 0x021cd }, { 0x021d2, 0x00338, 0x021cf },
+	{ 0x021d4, 0x00338, 0x021ce }, { 0x02203, 0x00338, 0x02204 },
+	{ 0x02208, 0x00338, 0x02209 }, { 0x0220b, 0x00338, 0x0220c },
+	{ 0x02223, 0x00338, 0x02224 }, { 0x02225, 0x00338, 0x02226 },
+	{ 0x0223c, 0x00338, 0x02241 }, { 0x02243, 0x00338, 0x02244 },
+	{ 0x02245, 0x00338, 0x02247 }, { 0x02248, 0x00338, 0x02249 },
+	{ 0x0224d, 0x00338, 0x0226d }, { 0x02261, 0x00338, 0x02262 },
+	{ 0x02264, 0x00338, 0x02270 }, { 0x02265, 0x00338, 0x02271 },
+	{ 0x02272, 0x00338, 0x02274 }, { 0x02273, 0x00338, 0x02275 },
+	{ 0x02276, 0x00338, 0x02278 }, { 0x02277, 0x00338, 0x02279 },
+	{ 0x0227a, 0x00338, 0x02280 }, { 0x0227b, 0x00338, 0x02281 },
+	{ 0x0227c, 0x00338, 0x022e0 }, { 0x0227d, 0x00338, 0x022e1 },
+	{ 0x02282, 0x00338, 0x02284 }, { 0x02283, 0x00338, 0x02285 },
+	{ 0x02286, 0x00338, 0x02288 }, { 0x02287, 0x00338, 0x02289 },
+	{ 0x02291, 0x00338, 0x022e2 }, { 0x02292, 0x00338, 0x022e3 },
+	{ 0x022a2, 0x00338, 0x022ac }, { 0x022a8, 0x00338, 0x022ad },
+	{ 0x022a9, 0x00338, 0x022ae }, { 0x022ab, 0x00338, 0x022af },
+	{ 0x022b2, 0x00338, 0x022ea }, { 0x022b3, 0x00338, 0x022eb },
+	{ 0x022b4, 0x00338, 0x022ec }, { 0x022b5, 0x00338, 0x022ed },
+	{ 0x03046, 0x03099, 0x03094 }, { 0x0304b, 0x03099, 0x0304c },
+	{ 0x0304d, 0x03099, 0x0304e }, { 0x0304f, 0x03099, 0x03050 },
+	{ 0x03051, 0x03099, 0x03052 }, { 0x03053, 0x03099, 0x03054 },
+	{ 0x03055, 0x03099, 0x03056 }, { 0x03057, 0x03099, 0x03058 },
+	{ 0x03059, 0x03099, 0x0305a }, { 0x0305b, 0x03099, 0x0305c },
+	{ 0x0305d, 0x03099, 0x0305e }, { 0x0305f, 0x03099, 0x03060 },
+	{ 0x03061, 0x03099, 0x03062 }, { 0x03064, 0x03099, 0x03065 },
+	{ 0x03066, 0x03099, 0x03067 }, { 0x03068, 0x03099, 0x03069 },
+	{ 0x0306f, 0x03099, 0x03070 }, { 0x0306f, 0x0309a, 0x03071 },
+	{ 0x03072, 0x03099, 0x03073 }, { 0x03072, 0x0309a, 0x03074 },
+	{ 0x03075, 0x03099, 0x03076 }, { 0x03075, 0x0309a, 0x03077 },
+	{ 0x03078, 0x03099, 0x03079 }, { 0x03078, 0x0309a, 0x0307a },
+	{ 0x0307b, 0x03099, 0x0307c }, { 0x0307b, 0x0309a, 0x0307d },
+	{ 0x0309d, 0x03099, 0x0309e }, { 0x030a6, 0x03099, 0x030f4 },
+	{ 0x030ab, 0x03099, 0x030ac }, { 0x030ad, 0x03099, 0x030ae },
+	{ 0x030af, 0x03099, 0x030b0 }, { 0x030b1, 0x03099, 0x030b2 },
+	{ 0x030b3, 0x03099, 0x030b4 }, { 0x030b5, 0x03099, 0x030b6 },
+	{ 0x030b7, 0x03099, 0x030b8 }, { 0x030b9, 0x03099, 0x030ba },
+	{ 0x030bb, 0x03099, 0x030bc }, { 0x030bd, 0x03099, 0x030be },
+	{ 0x030bf, 0x03099, 0x030c0 }, { 0x030c1, 0x03099, 0x030c2 },
+	{ 0x030c4, 0x03099, 0x030c5 }, { 0x030c6, 0x03099, 0x030c7 },
+	{ 0x030c8, 0x03099, 0x030c9 }, { 0x030cf, 0x03099, 0x030d0 },
+	{ 0x030cf, 0x0309a, 0x030d1 }, { 0x030d2, 0x03099, 0x030d3 },
+	{ 0x030d2, 0x0309a, 0x030d4 }, { 0x030d5, 0x03099, 0x030d6 },
+	{ 0x030d5, 0x0309a, 0x030d7 }, { 0x030d8, 0x03099, 0x030d9 },
+	{ 0x030d8, 0x0309a, 0x030da }, { 0x030db, 0x03099, 0x030dc },
+	{ 0x030db, 0x0309a, 0x030dd }, { 0x030ef, 0x03099, 0x030f7 },
+	{ 0x030f0, 0x03099, 0x030f8 }, { 0x030f1, 0x03099, 0x030f9 },
+	{ 0x030f2, 0x03099, 0x030fa }, { 0x030fd, 0x03099, 0x030fe },
+	{ 0x11099, 0x110ba, 0x1109a }, { 0x1109b, 0x110ba, 0x1109c },
+	{ 0x110a5, 0x110ba, 0x110ab }, { 0x11131, 0x11127, 0x1112e },
+	{ 0x11132, 0x11127, 0x1112f }, { 0x11347, 0x1133e, 0x1134b },
+	{ 0x11347, 0x11357, 0x1134c }, { 0x114b9, 0x114b0, 0x114bc },
+	{ 0x114b9, 0x114ba, 0x114bb }, { 0x114b9, 0x114bd, 0x114be },
+	{ 0x115b8, 0x115af, 0x115ba }, { 0x115b9, 0x115af, 0x115bb },
+	{ 0x11935, 0x11930, 0x11938 },
+};
@@ -0,0 +1,257 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "cv-impl.h"
+
+/*
+ * Count the non-ASCII bytes in a buffer, by value, into a histogram of
+ * 128 bins, and return their total.  Only the bins for bytes which occur
+ * are touched, so the caller can clear them again cheaply.
+ *
+ * The scalar version skips ASCII eight bytes at a time.  The SIMD
+ * versions extract the high bits of a block into a mask, skip the block
+ * if it is empty, and otherwise visit only the bytes whose bit is set.
+ */
+static size_t
+hist8_scalar(const unsigned char *buf, size_t len, uint32_t *hist)
+{
+	uint64_t w;
+	size_t i, n;
+
+	for (i = n = 0; i < len; ++i) {
+		if (i + 8 <= len) {
+			memcpy(&w, buf + i, sizeof w);
+			if ((w & 0x8080808080808080ULL) == 0) {
+				i += 7;
+				continue;
+			}
+		}
+		if (buf[i] & 0x80) {
+			hist[buf[i] & 0x7f]++;
+			n++;
+		}
+	}
+	return (n);
+}
+
+static int
+supported_scalar(void)
+{
+
+	return (1);
+}
+
+#ifdef HAVE_X86_SIMD
+__attribute__((target("sse2")))
+static size_t
+hist8_sse2(const unsigned char *buf, size_t len, uint32_t *hist)
+{
+	unsigned int m;
+	size_t i, n;
+
+	for (i = n = 0; i + 16 <= len; i += 16) {
+		m = _mm_movemask_epi8(
+		    _mm_loadu_si128((const __m128i *)(buf + i)));
+		for (; m != 0; m &= m - 1, ++n)
+			hist[buf[i + __builtin_ctz(m)] & 0x7f]++;
+	}
+	return (n + hist8_scalar(buf + i, len - i, hist));
+}
+
+__attribute__((target("avx2")))
+static size_t
+hist8_avx2(const unsigned char *buf, size_t len, uint32_t *hist)
+{
+	unsigned int m;
+	size_t i, n;
+
+	for (i = n = 0; i + 32 <= len; i += 32) {
+		m = _mm256_movemask_epi8(
+		    _mm256_loadu_si256((const __m256i *)(buf + i)));
+		for (; m != 0; m &= m - 1, ++n)
+			hist[buf[i + __builtin_ctz(m)] & 0x7f]++;
+	}
+	return (n + hist8_sse2(buf + i, len - i, hist));
+}
+
+static int
+supported_sse2(void)
+{
+
+	return (__builtin_cpu_supports("sse2"));
+}
+
+static int
+supported_ssse3(void)
+{
+
+	return (__builtin_cpu_supports("ssse3"));
+}
+
+static int
+supported_avx2(void)
+{
+
+	return (__builtin_cpu_supports("avx2"));
+}
+#endif
+
+/*
+ * Available implementations, from slowest to fastest.
+ */
+static const struct cv_impl cv_impls[] = {
+	{ "scalar", supported_scalar, utf8_classify_scalar, hist8_scalar },
+#ifdef HAVE_X86_SIMD
+	{ "sse2", supported_sse2, utf8_classify_sse2, hist8_sse2 },
+	{ "ssse3", supported_ssse3, utf8_classify_ssse3, hist8_sse2 },
+	{ "avx2", supported_avx2, utf8_classify_avx2, hist8_avx2 },
+#endif
+};
+
+#define NIMPLS (sizeof cv_impls / sizeof cv_impls[0])
+
+static const char *const cv_impl_names[] = {
+	"scalar",
+#ifdef HAVE_X86_SIMD
+	"sse2",
+	"ssse3",
+	"avx2",
+#endif
+	NULL
+};
+
+/* accessed atomically, as any thread may be the first to need it */
+static const struct cv_impl *cv_impl_cur;
+
+static const struct cv_impl *
+cv_impl_find(const char *name)
+{
+	unsigned int i;
+
+	for (i = 0; i < NIMPLS; ++i)
+		if (strcmp(cv_impls[i].name, name) == 0)
+			return (&cv_impls[i]);
+	return (NULL);
+}
+
+/*
+ * Return the fastest implementation the CPU supports.
+ */
+static const struct cv_impl *
+cv_impl_best(void)
+{
+	const struct cv_impl *impl;
+	unsigned int i;
+
+	for (i = 0, impl = NULL; i < NIMPLS; ++i)
+		if (cv_impls[i].supported())
+			impl = &cv_impls[i];
+	return (impl);
+}
+
+/*
+ * Return the current implementation, selecting the fastest one the CPU
+ * supports on first use.
+ */
+const struct cv_impl *
+cv_impl_get(void)
+{
+	const struct cv_impl *impl, *best;
+
+	if ((impl = __atomic_load_n(&cv_impl_cur, __ATOMIC_ACQUIRE)) == NULL) {
+		/* unless another thread has selected one in the meantime */
+		best = cv_impl_best();
+		if (__atomic_compare_exchange_n(&cv_impl_cur, &impl, best, 0,
+		    __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE))
+			impl = best;
+	}
+	return (impl);
+}
+
+/*
+ * List all implementations included in this build.
+ */
+const char *const *
+cv_impl_list(void)
+{
+
+	return (cv_impl_names);
+}
+
+/*
+ * Check whether the CPU supports a given implementation.
+ */
+int
+cv_impl_supported(const char *name)
+{
+	const struct cv_impl *impl;
+
+	return ((impl = cv_impl_find(name)) != NULL && impl->supported());
+}
+
+/*
+ * Select a specific implementation, or the fastest one the CPU supports
+ * if name is NULL.  This affects all threads and is mostly intended for
+ * testing and benchmarking.
+ */
+int
+cv_impl_select(const char *name)
+{
+	const struct cv_impl *impl;
+
+	if (name == NULL) {
+		impl = cv_impl_best();
+	} else if ((impl = cv_impl_find(name)) == NULL) {
+		errno = ENOENT;
+		return (-1);
+	} else if (!impl->supported()) {
+		errno = ENOTSUP;
+		return (-1);
+	}
+	__atomic_store_n(&cv_impl_cur, impl, __ATOMIC_RELEASE);
+	return (0);
+}
+
+/*
+ * Return the name of the current implementation.
+ */
+const char *
+cv_impl_name(void)
+{
+
+	return (cv_impl_get()->name);
+}
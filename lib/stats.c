@@ -0,0 +1,251 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "conv-tools.h"
+
+static uint64_t
+ts2ns(const struct timespec *ts)
+{
+
+	return ((uint64_t)ts->tv_sec * 1000000000 + ts->tv_nsec);
+}
+
+static void
+cv_clock_read(const cv_clock *c, uint64_t *wall, uint64_t *cpu)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	*wall = ts2ns(&ts);
+	clock_gettime(c->process ? CLOCK_PROCESS_CPUTIME_ID :
+	    CLOCK_THREAD_CPUTIME_ID, &ts);
+	*cpu = ts2ns(&ts);
+}
+
+/*
+ * Start a clock which measures either the calling thread's CPU time or
+ * that of the entire process, in addition to wall-clock time.
+ */
+void
+cv_clock_start(cv_clock *c, int process)
+{
+
+	c->process = process;
+	cv_clock_read(c, &c->wall, &c->cpu);
+}
+
+/*
+ * Charge the time elapsed since the clock was started or last lapped to
+ * the given phase, and start a new lap.
+ */
+void
+cv_clock_lap(cv_clock *c, cv_phase *ph)
+{
+	uint64_t wall, cpu;
+
+	cv_clock_read(c, &wall, &cpu);
+	ph->wall += wall - c->wall;
+	ph->cpu += cpu - c->cpu;
+	c->wall = wall;
+	c->cpu = cpu;
+}
+
+/*
+ * A report is a list of counters followed by a list of phases, printed
+ * to stderr either as aligned text or as a single JSON object.  Item
+ * names are copied, so the caller may construct them on the fly.  If an
+ * item cannot be added, the error is remembered and returned when the
+ * report is closed, so the caller need only check the result of
+ * cv_report_open() and cv_report_close().
+ */
+struct cv_report_item {
+	char *name;
+	uintmax_t count;
+	cv_phase phase;
+	int isphase;
+};
+
+struct cv_report {
+	const char *tool;
+	int json;
+	struct cv_report_item *items;
+	size_t nitems, size;
+	int error;
+};
+
+cv_report *
+cv_report_open(const char *tool, int json)
+{
+	cv_report *r;
+
+	if ((r = calloc(1, sizeof *r)) == NULL)
+		return (NULL);
+	r->tool = tool;
+	r->json = json;
+	return (r);
+}
+
+static struct cv_report_item *
+cv_report_add(cv_report *r, const char *name)
+{
+	struct cv_report_item *tmp;
+	size_t size;
+	char *copy;
+
+	if ((copy = strdup(name)) == NULL)
+		goto fail;
+	if (r->nitems == r->size) {
+		size = r->size ? r->size * 2 : 32;
+		if ((tmp = realloc(r->items, size * sizeof *tmp)) == NULL) {
+			free(copy);
+			goto fail;
+		}
+		r->items = tmp;
+		r->size = size;
+	}
+	tmp = &r->items[r->nitems++];
+	memset(tmp, 0, sizeof *tmp);
+	tmp->name = copy;
+	return (tmp);
+fail:
+	if (r->error == 0)
+		r->error = errno;
+	return (NULL);
+}
+
+int
+cv_report_count(cv_report *r, const char *name, uintmax_t count)
+{
+	struct cv_report_item *it;
+
+	if ((it = cv_report_add(r, name)) == NULL)
+		return (-1);
+	it->count = count;
+	return (0);
+}
+
+int
+cv_report_phase(cv_report *r, const char *name, const cv_phase *ph)
+{
+	struct cv_report_item *it;
+
+	if ((it = cv_report_add(r, name)) == NULL)
+		return (-1);
+	it->phase = *ph;
+	it->isphase = 1;
+	return (0);
+}
+
+static void
+cv_report_json(const cv_report *r)
+{
+	const struct cv_report_item *it;
+	const char *sep;
+	size_t i;
+
+	fprintf(stderr, "{\"tool\":\"%s\",\"counters\":{", r->tool);
+	for (i = 0, sep = ""; i < r->nitems; ++i) {
+		it = &r->items[i];
+		if (it->isphase)
+			continue;
+		fprintf(stderr, "%s\"%s\":%ju", sep, it->name, it->count);
+		sep = ",";
+	}
+	fprintf(stderr, "},\"phases\":{");
+	for (i = 0, sep = ""; i < r->nitems; ++i) {
+		it = &r->items[i];
+		if (!it->isphase)
+			continue;
+		fprintf(stderr, "%s\"%s\":{\"wall\":%.6f,\"cpu\":%.6f}",
+		    sep, it->name, it->phase.wall / 1e9, it->phase.cpu / 1e9);
+		sep = ",";
+	}
+	fprintf(stderr, "}}\n");
+}
+
+static void
+cv_report_text(const cv_report *r)
+{
+	const struct cv_report_item *it;
+	size_t i;
+	int hdr;
+
+	for (i = 0; i < r->nitems; ++i) {
+		it = &r->items[i];
+		if (!it->isphase)
+			fprintf(stderr, "%s: %-20s %14ju\n",
+			    r->tool, it->name, it->count);
+	}
+	for (i = 0, hdr = 0; i < r->nitems; ++i) {
+		it = &r->items[i];
+		if (!it->isphase)
+			continue;
+		if (!hdr++)
+			fprintf(stderr, "%s: %-20s %14s %14s\n",
+			    r->tool, "phase", "wall (s)", "cpu (s)");
+		fprintf(stderr, "%s: %-20s %14.6f %14.6f\n", r->tool,
+		    it->name, it->phase.wall / 1e9, it->phase.cpu / 1e9);
+	}
+}
+
+/*
+ * Print the report and free it.  Returns -1 and sets errno if any item
+ * could not be added, in which case the report printed is incomplete.
+ */
+int
+cv_report_close(cv_report *r)
+{
+	int error;
+
+	if (r->json)
+		cv_report_json(r);
+	else
+		cv_report_text(r);
+	while (r->nitems > 0)
+		free(r->items[--r->nitems].name);
+	free(r->items);
+	error = r->error;
+	free(r);
+	if (error != 0) {
+		errno = error;
+		return (-1);
+	}
+	return (0);
+}
@@ -0,0 +1,527 @@
+/*-
+ * Copyright (c) 2026 The University of Oslo
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ * 3. The name of the author may not be used to endorse or promote
+ *    products derived from this software without specific prior written
+ *    permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE AUTHOR AND CONTRIBUTORS ``AS IS'' AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED.  IN NO EVENT SHALL THE AUTHOR OR CONTRIBUTORS BE LIABLE
+ * FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+ * DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+ * OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+ * HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+ * LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY
+ * OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF
+ * SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <stdint.h>
+#include <string.h>
+
+#include "cv-impl.h"
+
+/*
+ * UTF-8 validation.
+ *
+ * The scalar validator is a DFA in the style of Bjoern Hoehrmann's
+ * decoder.  Each byte is mapped to one of twelve character classes, and
+ * the next state is looked up from the current state and the class.
+ * States are premultiplied by the number of classes so that the lookup
+ * is a single addition.
+ *
+ * Encoded surrogates (U+D800 through U+DFFF) are accepted, as they
+ * always have been; overlong sequences, sequences longer than four
+ * bytes and codepoints above U+10FFFF are rejected.
+ */
+enum {
+	U8_ACCEPT = 0,		/* between sequences */
+	U8_REJECT = 12,		/* invalid (sink) */
+	U8_CONT1 = 24,		/* one more continuation byte */
+	U8_CONT2 = 36,		/* two more continuation bytes */
+	U8_CONT3 = 48,		/* three more continuation bytes */
+	U8_E0 = 60,		/* after E0: A0-BF, then one more */
+	U8_F0 = 72,		/* after F0: 90-BF, then two more */
+	U8_F4 = 84,		/* after F4: 80-8F, then two more */
+};
+
+/*
+ * Character classes:
+ *
+ *   0: 00-7f    1: 80-8f    2: 90-9f    3: a0-bf
+ *   4: c0-c1    5: c2-df    6: e0       7: e1-ef
+ *   8: f0       9: f1-f3   10: f4      11: f5-ff
+ */
+static const unsigned char utf8_class[256] = {
+#define C16(c) c, c, c, c, c, c, c, c, c, c, c, c, c, c, c, c
+	C16(0), C16(0), C16(0), C16(0), C16(0), C16(0), C16(0), C16(0),
+	C16(1), C16(2), C16(3), C16(3),
+	4, 4, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5, 5,
+	C16(5),
+	6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+	8, 9, 9, 9, 10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+#undef C16
+};
+
+#define R U8_REJECT
+static const unsigned char utf8_trans[96] = {
+	/* U8_ACCEPT */
+	U8_ACCEPT, R, R, R, R, U8_CONT1,
+	U8_E0, U8_CONT2, U8_F0, U8_CONT3, U8_F4, R,
+	/* U8_REJECT */
+	R, R, R, R, R, R, R, R, R, R, R, R,
+	/* U8_CONT1 */
+	R, U8_ACCEPT, U8_ACCEPT, U8_ACCEPT, R, R, R, R, R, R, R, R,
+	/* U8_CONT2 */
+	R, U8_CONT1, U8_CONT1, U8_CONT1, R, R, R, R, R, R, R, R,
+	/* U8_CONT3 */
+	R, U8_CONT2, U8_CONT2, U8_CONT2, R, R, R, R, R, R, R, R,
+	/* U8_E0 */
+	R, R, R, U8_CONT1, R, R, R, R, R, R, R, R,
+	/* U8_F0 */
+	R, R, U8_CONT2, U8_CONT2, R, R, R, R, R, R, R, R,
+	/* U8_F4 */
+	R, U8_CONT2, R, R, R, R, R, R, R, R, R, R,
+};
+#undef R
+
+void
+utf8_init(struct utf8_state *st)
+{
+
+	st->state = U8_ACCEPT;
+	st->hi = 0;
+}
+
+/*
+ * Feed a chunk of a string to the validator.
+ */
+void
+utf8_feed(struct utf8_state *st, const unsigned char *str, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len && st->state != U8_REJECT; ++i) {
+		st->hi |= str[i];
+		st->state = utf8_trans[st->state + utf8_class[str[i]]];
+	}
+}
+
+/*
+ * Classify what we've seen so far: returns
+ *
+ *  CV_NC_UTF8 if the string is valid UTF-8
+ *  CV_NC_ASCII if the string contains no 8-bit characters
+ *  CV_NC_8BIT if the string contains 8-bit characters but is not valid UTF-8
+ */
+cv_nameclass
+utf8_result(const struct utf8_state *st)
+{
+
+	/* invalid or incomplete multibyte sequence */
+	if (st->state != U8_ACCEPT)
+		return (CV_NC_8BIT);
+	/*
+	 * We reached the end with no errors; this was either valid UTF-8
+	 * or pure 7-bit ASCII.
+	 */
+	return ((st->hi & 0x80) ? CV_NC_UTF8 : CV_NC_ASCII);
+}
+
+/*
+ * Scalar classifier: skip ASCII eight bytes at a time, then run the DFA
+ * over the rest.
+ */
+cv_nameclass
+utf8_classify_scalar(const unsigned char *str, size_t len)
+{
+	unsigned int state, hi;
+	uint64_t w;
+	size_t i;
+
+	for (i = 0; i + 8 <= len; i += 8) {
+		memcpy(&w, str + i, sizeof w);
+		if (w & 0x8080808080808080ULL)
+			break;
+	}
+	for (state = U8_ACCEPT, hi = 0; i < len; ++i) {
+		hi |= str[i];
+		state = utf8_trans[state + utf8_class[str[i]]];
+	}
+	if (state != U8_ACCEPT)
+		return (CV_NC_8BIT);
+	return ((hi & 0x80) ? CV_NC_UTF8 : CV_NC_ASCII);
+}
+
+/*
+ * Classify a string and, if it is 8-bit or WTF-8, transcode it to UTF-8
+ * using the given table.
+ *
+ * As we run the DFA, we decode each complete sequence and look up the
+ * codepoint in the reverse table.  If every codepoint maps to a byte and
+ * those bytes in turn form valid UTF-8, the string is WTF-8, and those
+ * bytes, which we have been writing to the output as we went, are the
+ * repaired string.  ASCII is skipped eight bytes at a time and only
+ * copied to the output when the next sequence is mapped.  If the DFA
+ * rejects the string, it is 8-bit, and we transcode it from the start
+ * using the forward table; only the part before the first invalid
+ * sequence is read twice.
+ *
+ * The output must have room for three times the length of the input
+ * plus a terminating NUL.  If out is NULL, the string is only
+ * classified.  On return, *outlen is the length of the output, 0 if the
+ * string did not need to be converted, or (size_t)-1 if it contained a
+ * byte which is not part of the character set.
+ */
+cv_nameclass
+utf8_fix(const struct cstab *tab, const unsigned char *str, size_t len,
+    unsigned char *out, size_t *outlen)
+{
+	const unsigned char *p, *end, *seq, *mark;
+	unsigned char *op;
+	unsigned int state, wstate, hi, whi, cp, c, r;
+	int wtf;
+	uint64_t w;
+
+	p = mark = seq = str;
+	end = str + len;
+	op = out;
+	state = wstate = U8_ACCEPT;
+	hi = whi = cp = 0;
+	wtf = 1;
+	while (p < end) {
+		if (state == U8_ACCEPT) {
+			/* skip ASCII between sequences */
+			seq = p;
+			while (end - p >= 8) {
+				memcpy(&w, p, sizeof w);
+				if (w & 0x8080808080808080ULL)
+					break;
+				p += 8;
+			}
+			while (p < end && *p < 0x80)
+				++p;
+			/* ASCII can't complete a sequence in the output */
+			if (p > seq && wstate != U8_ACCEPT)
+				wtf = 0;
+			if (p == end)
+				break;
+			seq = p;
+			c = *p++;
+			cp = c & (c >= 0xf0 ? 0x07 : c >= 0xe0 ? 0x0f : 0x1f);
+		} else {
+			c = *p++;
+			cp = cp << 6 | (c & 0x3f);
+		}
+		hi |= c;
+		state = utf8_trans[state + utf8_class[c]];
+		if (state == U8_REJECT)
+			goto eightbit;
+		if (state != U8_ACCEPT || !wtf)
+			continue;
+
+		/* complete sequence: map it back to the 8-bit charset */
+		if (cp > 0xffff || (r = tab->revidx[cp >> 8]) == 0 ||
+		    (r = tab->rev[r - 1][cp & 0xff]) == 0) {
+			wtf = 0;
+			continue;
+		}
+		c = r & 0xff;
+		whi |= c;
+		wstate = utf8_trans[wstate + utf8_class[c]];
+		if (wstate == U8_REJECT) {
+			wtf = 0;
+			continue;
+		}
+		if (out != NULL) {
+			memcpy(op, mark, seq - mark);
+			op += seq - mark;
+			*op++ = c;
+			mark = p;
+		}
+	}
+	if (state != U8_ACCEPT)
+		goto eightbit;
+	if (outlen != NULL)
+		*outlen = 0;
+	if (!(hi & 0x80))
+		return (CV_NC_ASCII);
+	if (!wtf || wstate != U8_ACCEPT || !(whi & 0x80))
+		return (CV_NC_UTF8);
+	if (out != NULL) {
+		memcpy(op, mark, end - mark);
+		op += end - mark;
+		*op = '\0';
+		*outlen = op - out;
+	}
+	return (CV_NC_WTF8);
+
+eightbit:
+	if (out == NULL)
+		return (CV_NC_8BIT);
+	for (p = str, op = out; p < end; ++p) {
+		if (*p < 0x80) {
+			*op++ = *p;
+		} else if ((r = tab->fwd[*p][3]) > 0) {
+			memcpy(op, tab->fwd[*p], 3);
+			op += r;
+		} else {
+			*outlen = (size_t)-1;
+			return (CV_NC_8BIT);
+		}
+	}
+	*op = '\0';
+	*outlen = op - out;
+	return (CV_NC_8BIT);
+}
+
+#ifdef HAVE_X86_SIMD
+/*
+ * SSE2 classifier: skip ASCII sixteen bytes at a time, and run the DFA
+ * over each block which contains 8-bit bytes or follows an incomplete
+ * sequence.
+ */
+__attribute__((target("sse2")))
+cv_nameclass
+utf8_classify_sse2(const unsigned char *str, size_t len)
+{
+	unsigned int state, hi;
+	size_t i, j;
+
+	for (i = 0, state = U8_ACCEPT, hi = 0; i + 16 <= len; i += 16) {
+		if (state == U8_ACCEPT && _mm_movemask_epi8(
+		    _mm_loadu_si128((const __m128i *)(str + i))) == 0)
+			continue;
+		for (j = i; j < i + 16; ++j) {
+			hi |= str[j];
+			state = utf8_trans[state + utf8_class[str[j]]];
+		}
+		if (state == U8_REJECT)
+			return (CV_NC_8BIT);
+	}
+	for (; i < len; ++i) {
+		hi |= str[i];
+		state = utf8_trans[state + utf8_class[str[i]]];
+	}
+	if (state != U8_ACCEPT)
+		return (CV_NC_8BIT);
+	return ((hi & 0x80) ? CV_NC_UTF8 : CV_NC_ASCII);
+}
+
+/*
+ * Lookup-table validation, as described by John Keiser and Daniel Lemire
+ * in "Validating UTF-8 In Less Than One Instruction Per Byte" and used in
+ * simdutf.  The high and low nibbles of each byte and the high nibble of
+ * the following byte are used to look up a bit mask of possible errors
+ * in three 16-entry tables; if the AND of the three is non-zero, there is
+ * an error.  The only legitimate non-zero result is TWO_CONTS, which is
+ * then checked against the positions where the third or fourth byte of a
+ * multibyte sequence is expected.
+ *
+ * To match the scalar validator, the SURROGATE error is not used.
+ */
+#define U8_TOO_SHORT	(1 << 0) /* 11______ 0_______ or 11______ 11______ */
+#define U8_TOO_LONG	(1 << 1) /* 0_______ 10______ */
+#define U8_OVERLONG_3	(1 << 2) /* 11100000 100_____ */
+#define U8_TOO_LARGE	(1 << 3) /* 11110100 1001____ and up */
+#define U8_OVERLONG_2	(1 << 5) /* 1100000_ 10______ */
+#define U8_TOO_LARGE_1000 (1 << 6) /* 11110101 1000____ and up */
+#define U8_OVERLONG_4	(1 << 6) /* 11110000 1000____ */
+#define U8_TWO_CONTS	(1 << 7) /* 10______ 10______ */
+#define U8_CARRY	(U8_TOO_SHORT | U8_TOO_LONG | U8_TWO_CONTS)
+
+#define U8_BYTE_1_HIGH							\
+	U8_TOO_LONG, U8_TOO_LONG, U8_TOO_LONG, U8_TOO_LONG,		\
+	U8_TOO_LONG, U8_TOO_LONG, U8_TOO_LONG, U8_TOO_LONG,		\
+	U8_TWO_CONTS, U8_TWO_CONTS, U8_TWO_CONTS, U8_TWO_CONTS,		\
+	U8_TOO_SHORT | U8_OVERLONG_2,					\
+	U8_TOO_SHORT,							\
+	U8_TOO_SHORT | U8_OVERLONG_3,					\
+	U8_TOO_SHORT | U8_TOO_LARGE | U8_TOO_LARGE_1000 | U8_OVERLONG_4
+
+#define U8_BYTE_1_LOW							\
+	U8_CARRY | U8_OVERLONG_3 | U8_OVERLONG_2 | U8_OVERLONG_4,	\
+	U8_CARRY | U8_OVERLONG_2,					\
+	U8_CARRY,							\
+	U8_CARRY,							\
+	U8_CARRY | U8_TOO_LARGE,					\
+	U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,			\
+	U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,			\
+	U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,			\
+	U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,			\
+	U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,			\
+	U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,			\
+	U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,			\
+	U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,			\
+	U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,			\
+	U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000,			\
+	U8_CARRY | U8_TOO_LARGE | U8_TOO_LARGE_1000
+
+#define U8_BYTE_2_HIGH							\
+	U8_TOO_SHORT, U8_TOO_SHORT, U8_TOO_SHORT, U8_TOO_SHORT,		\
+	U8_TOO_SHORT, U8_TOO_SHORT, U8_TOO_SHORT, U8_TOO_SHORT,		\
+	U8_TOO_LONG | U8_OVERLONG_2 | U8_TWO_CONTS | U8_OVERLONG_3 |	\
+	    U8_TOO_LARGE_1000 | U8_OVERLONG_4,				\
+	U8_TOO_LONG | U8_OVERLONG_2 | U8_TWO_CONTS | U8_OVERLONG_3 |	\
+	    U8_TOO_LARGE,						\
+	U8_TOO_LONG | U8_OVERLONG_2 | U8_TWO_CONTS | U8_TOO_LARGE,	\
+	U8_TOO_LONG | U8_OVERLONG_2 | U8_TWO_CONTS | U8_TOO_LARGE,	\
+	U8_TOO_SHORT, U8_TOO_SHORT, U8_TOO_SHORT, U8_TOO_SHORT
+
+/*
+ * A sequence which starts in one of the last three bytes of a block is
+ * incomplete if its first byte is greater than this.
+ */
+#define U8_INCOMPLETE							\
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,			\
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,			\
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,			\
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xf0 - 1, 0xe0 - 1, 0xc0 - 1
+
+static const int8_t u8_byte_1_high[32] = { U8_BYTE_1_HIGH, U8_BYTE_1_HIGH };
+static const int8_t u8_byte_1_low[32] = { U8_BYTE_1_LOW, U8_BYTE_1_LOW };
+static const int8_t u8_byte_2_high[32] = { U8_BYTE_2_HIGH, U8_BYTE_2_HIGH };
+static const uint8_t u8_incomplete[32] = { U8_INCOMPLETE };
+
+__attribute__((target("ssse3")))
+static inline __m128i
+utf8_block_ssse3(__m128i in, __m128i prev)
+{
+	__m128i prev1, prev2, prev3, lo4, sc, must23;
+
+	lo4 = _mm_set1_epi8(0x0f);
+	prev1 = _mm_alignr_epi8(in, prev, 15);
+	sc = _mm_and_si128(_mm_and_si128(
+	    _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)u8_byte_1_high),
+		_mm_and_si128(_mm_srli_epi16(prev1, 4), lo4)),
+	    _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)u8_byte_1_low),
+		_mm_and_si128(prev1, lo4))),
+	    _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)u8_byte_2_high),
+		_mm_and_si128(_mm_srli_epi16(in, 4), lo4)));
+	prev2 = _mm_alignr_epi8(in, prev, 14);
+	prev3 = _mm_alignr_epi8(in, prev, 13);
+	must23 = _mm_or_si128(
+	    _mm_subs_epu8(prev2, _mm_set1_epi8((char)(0xe0 - 0x80))),
+	    _mm_subs_epu8(prev3, _mm_set1_epi8((char)(0xf0 - 0x80))));
+	return (_mm_xor_si128(
+	    _mm_and_si128(must23, _mm_set1_epi8((char)0x80)), sc));
+}
+
+__attribute__((target("ssse3")))
+cv_nameclass
+utf8_classify_ssse3(const unsigned char *str, size_t len)
+{
+	__m128i in, prev, err, incomplete, hi;
+	unsigned char tail[16];
+	size_t i;
+
+	if (len < 16)
+		return (utf8_classify_scalar(str, len));
+	prev = err = incomplete = hi = _mm_setzero_si128();
+	for (i = 0; i < len; i += 16) {
+		if (i + 16 <= len) {
+			in = _mm_loadu_si128((const __m128i *)(str + i));
+		} else {
+			/* pad with ASCII, which catches an incomplete end */
+			memset(tail, 0, sizeof tail);
+			memcpy(tail, str + i, len - i);
+			in = _mm_loadu_si128((const __m128i *)tail);
+		}
+		if (_mm_movemask_epi8(in) == 0) {
+			/* ASCII block, only check the previous block's end */
+			err = _mm_or_si128(err, incomplete);
+		} else {
+			hi = _mm_or_si128(hi, in);
+			err = _mm_or_si128(err, utf8_block_ssse3(in, prev));
+			incomplete = _mm_subs_epu8(in, _mm_loadu_si128(
+			    (const __m128i *)(u8_incomplete + 16)));
+		}
+		prev = in;
+	}
+	err = _mm_or_si128(err, incomplete);
+	if (_mm_movemask_epi8(_mm_cmpeq_epi8(err,
+	    _mm_setzero_si128())) != 0xffff)
+		return (CV_NC_8BIT);
+	return (_mm_movemask_epi8(hi) ? CV_NC_UTF8 : CV_NC_ASCII);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i
+utf8_block_avx2(__m256i in, __m256i prev)
+{
+	__m256i prev1, prev2, prev3, lo4, sc, must23, shifted;
+
+	lo4 = _mm256_set1_epi8(0x0f);
+	shifted = _mm256_permute2x128_si256(prev, in, 0x21);
+	prev1 = _mm256_alignr_epi8(in, shifted, 15);
+	sc = _mm256_and_si256(_mm256_and_si256(
+	    _mm256_shuffle_epi8(
+		_mm256_loadu_si256((const __m256i *)u8_byte_1_high),
+		_mm256_and_si256(_mm256_srli_epi16(prev1, 4), lo4)),
+	    _mm256_shuffle_epi8(
+		_mm256_loadu_si256((const __m256i *)u8_byte_1_low),
+		_mm256_and_si256(prev1, lo4))),
+	    _mm256_shuffle_epi8(
+		_mm256_loadu_si256((const __m256i *)u8_byte_2_high),
+		_mm256_and_si256(_mm256_srli_epi16(in, 4), lo4)));
+	prev2 = _mm256_alignr_epi8(in, shifted, 14);
+	prev3 = _mm256_alignr_epi8(in, shifted, 13);
+	must23 = _mm256_or_si256(
+	    _mm256_subs_epu8(prev2, _mm256_set1_epi8((char)(0xe0 - 0x80))),
+	    _mm256_subs_epu8(prev3, _mm256_set1_epi8((char)(0xf0 - 0x80))));
+	return (_mm256_xor_si256(
+	    _mm256_and_si256(must23, _mm256_set1_epi8((char)0x80)), sc));
+}
+
+__attribute__((target("avx2")))
+cv_nameclass
+utf8_classify_avx2(const unsigned char *str, size_t len)
+{
+	__m256i in, prev, err, incomplete, hi;
+	unsigned char tail[32];
+	size_t i;
+
+	if (len < 32)
+		return (utf8_classify_scalar(str, len));
+	prev = err = incomplete = hi = _mm256_setzero_si256();
+	for (i = 0; i < len; i += 32) {
+		if (i + 32 <= len) {
+			in = _mm256_loadu_si256((const __m256i *)(str + i));
+		} else {
+			/* pad with ASCII, which catches an incomplete end */
+			memset(tail, 0, sizeof tail);
+			memcpy(tail, str + i, len - i);
+			in = _mm256_loadu_si256((const __m256i *)tail);
+		}
+		if (_mm256_movemask_epi8(in) == 0) {
+			/* ASCII block, only check the previous block's end */
+			err = _mm256_or_si256(err, incomplete);
+		} else {
+			hi = _mm256_or_si256(hi, in);
+			err = _mm256_or_si256(err, utf8_block_avx2(in, prev));
+			incomplete = _mm256_subs_epu8(in, _mm256_loadu_si256(
+			    (const __m256i *)u8_incomplete));
+		}
+		prev = in;
+	}
+	err = _mm256_or_si256(err, incomplete);
+	if (!_mm256_testz_si256(err, err))
+		return (CV_NC_8BIT);
+	return (_mm256_movemask_epi8(hi) ? CV_NC_UTF8 : CV_NC_ASCII);
+}
+#endif